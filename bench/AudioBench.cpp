@@ -0,0 +1,80 @@
+#include "Benchmark.hpp"
+#include "AudioMixer.hpp"
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+const size_t CLIP_FRAMES = AudioMixer::OUTPUT_SAMPLE_RATE * 4;
+const size_t BUFFERS_PER_CLIP = CLIP_FRAMES / MixerStream::BUFFER_FRAMES;
+
+// Tono mono de 4 segundos, como los efectos del juego
+std::vector<std::int16_t> MakeToneSamples() {
+    std::vector<std::int16_t> samples(CLIP_FRAMES);
+    for (size_t i = 0; i < samples.size(); i++) {
+        samples[i] = static_cast<std::int16_t>(8000.0 * std::sin(i * 0.05));
+    }
+    return samples;
+}
+
+void StartVoices(AudioMixer& mixer, int voiceCount) {
+    mixer.StopAll();
+    for (int voice = 0; voice < voiceCount; voice++) {
+        mixer.PlayClip("tone", 0.5f);
+    }
+}
+
+const char* SimdLevelName(AudioMixer::SimdLevel level) {
+    switch (level) {
+        case AudioMixer::SimdLevel::AVX2:
+            return "avx2";
+        case AudioMixer::SimdLevel::SSE2:
+            return "sse2";
+        default:
+            return "scalar";
+    }
+}
+
+} // namespace
+
+void RegisterAudioBenchmarks(BenchmarkRunner& runner) {
+    const AudioMixer::SimdLevel levels[] = {
+        AudioMixer::SimdLevel::SCALAR,
+        AudioMixer::SimdLevel::SSE2,
+        AudioMixer::SimdLevel::AVX2
+    };
+    const int voiceCounts[] = { 0, 1, 4, 8, 16 };
+
+    for (AudioMixer::SimdLevel level : levels) {
+        if (static_cast<int>(level) > static_cast<int>(AudioMixer::DetectSimdLevel())) {
+            continue;
+        }
+
+        // Coste de un buffer de 1024 frames estéreo según las voces activas
+        for (int voiceCount : voiceCounts) {
+            runner.AddBenchmark("AudioMixer::Mix/voices:" + std::to_string(voiceCount) + "/" + SimdLevelName(level),
+                                [level, voiceCount]() -> BenchmarkFunction {
+                auto mixer = std::make_shared<AudioMixer>();
+                mixer->SetSimdLevel(level);
+                std::vector<std::int16_t> tone = MakeToneSamples();
+                mixer->AddClip("tone", tone.data(), tone.size(), 1, AudioMixer::OUTPUT_SAMPLE_RATE);
+
+                auto output = std::make_shared<std::vector<std::int16_t>>(
+                    MixerStream::BUFFER_FRAMES * AudioMixer::OUTPUT_CHANNELS);
+
+                return [mixer, output, voiceCount](std::uint64_t iterations) {
+                    for (std::uint64_t i = 0; i < iterations; i++) {
+                        // Reiniciar las voces antes de que terminen
+                        if (i % (BUFFERS_PER_CLIP - 1) == 0) {
+                            StartVoices(*mixer, voiceCount);
+                        }
+                        mixer->Mix(output->data(), MixerStream::BUFFER_FRAMES);
+                        DoNotOptimize(output->data());
+                    }
+                };
+            });
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#include "Benchmark.hpp"
+#include "BatchEnvironment.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+const size_t ACTION_ROUNDS = 64;    // Steps distintos antes de repetir acciones
+
+// Entorno con acciones aleatorias pregeneradas (generarlas no entra en la medida)
+struct BatchFixture {
+    BatchEnvironment environment;
+    std::vector<std::int8_t> actions;
+    size_t round;
+
+    BatchFixture(size_t gameCount, int width, int height, BatchEnvironment::SimdLevel level)
+        : environment(gameCount, width, height), actions(gameCount * ACTION_ROUNDS), round(0) {
+        environment.SetSimdLevel(level);
+        std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+        for (std::int8_t& action : actions) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            // Mitad de los pasos sin giro: partidas algo más largas que al azar puro
+            int value = static_cast<int>(state % 8);
+            action = static_cast<std::int8_t>(value < 4 ? value : BatchEnvironment::NO_ACTION);
+        }
+    }
+};
+
+void AddBatchBenchmark(BenchmarkRunner& runner, size_t gameCount, int width, int height,
+                       BatchEnvironment::SimdLevel level) {
+    std::string name = "BatchEnvironment::Step/" + std::to_string(gameCount) + "x" + std::to_string(width) + "x" +
+                       std::to_string(height) + (level == BatchEnvironment::SimdLevel::AVX2 ? "/avx2" : "/scalar");
+
+    // Una iteración = un paso de una partida (ns por paso; 10 ns = 100M pasos/s)
+    runner.AddBenchmark(name, [gameCount, width, height, level]() -> BenchmarkFunction {
+        auto fixture = std::make_shared<BatchFixture>(gameCount, width, height, level);
+        return [fixture, gameCount](std::uint64_t iterations) {
+            for (std::uint64_t done = 0; done < iterations; done += gameCount) {
+                fixture->environment.Step(&fixture->actions[fixture->round * gameCount]);
+                fixture->round = (fixture->round + 1) % ACTION_ROUNDS;
+            }
+            DoNotOptimize(fixture->environment.GetRewards());
+        };
+    });
+}
+
+} // namespace
+
+void RegisterBatchBenchmarks(BenchmarkRunner& runner) {
+    for (BatchEnvironment::SimdLevel level : { BatchEnvironment::SimdLevel::SCALAR, BatchEnvironment::SimdLevel::AVX2 }) {
+        if (level > BatchEnvironment::DetectSimdLevel()) continue;
+
+        // Tablero pequeño (cabe en caché) y el del juego (50x35)
+        AddBatchBenchmark(runner, 4096, 16, 16, level);
+        AddBatchBenchmark(runner, 4096, 50, 35, level);
+    }
+}
@@ -0,0 +1,27 @@
+#include "BenchFixtures.hpp"
+
+Snake BuildSerpentineSnake(int length, int gridWidth, int gridHeight) {
+    Snake snake(2, 0);
+
+    int maxCells = gridWidth * gridHeight;
+    if (length > maxCells) {
+        length = maxCells;
+    }
+
+    while (static_cast<int>(snake.GetSegments().size()) < length) {
+        const Position& head = snake.GetHead();
+        Direction direction;
+
+        if (head.y % 2 == 0) {
+            direction = (head.x < gridWidth - 1) ? Direction::RIGHT : Direction::DOWN;
+        } else {
+            direction = (head.x > 0) ? Direction::LEFT : Direction::DOWN;
+        }
+
+        snake.ChangeDirection(direction);
+        snake.Grow();
+        snake.Update();
+    }
+
+    return snake;
+}
@@ -0,0 +1,19 @@
+#ifndef BENCH_FIXTURES_HPP
+#define BENCH_FIXTURES_HPP
+
+#include "Snake.hpp"
+
+// Dimensiones de la grilla del juego (ver Game.hpp)
+const int BENCH_GRID_WIDTH = 50;
+const int BENCH_GRID_HEIGHT = 35;
+
+/**
+ * @brief Construye una serpiente de la longitud pedida en zigzag
+ *
+ * Recorre la grilla fila por fila (derecha, baja, izquierda, baja...)
+ * usando solo la API pública de Snake, de modo que el cuerpo nunca
+ * se cruza consigo mismo y ocupa exactamente `length` celdas.
+ */
+Snake BuildSerpentineSnake(int length, int gridWidth = BENCH_GRID_WIDTH, int gridHeight = BENCH_GRID_HEIGHT);
+
+#endif // BENCH_FIXTURES_HPP
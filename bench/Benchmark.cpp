@@ -0,0 +1,202 @@
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+BenchmarkRunner::BenchmarkRunner()
+    : repetitions(10), warmupRepetitions(2), minTimeMs(20.0) {
+}
+
+void BenchmarkRunner::AddBenchmark(const std::string& name, BenchmarkFactory factory) {
+    benchmarks.emplace_back(name, std::move(factory));
+}
+
+std::vector<BenchmarkResult> BenchmarkRunner::RunAll() {
+    std::vector<BenchmarkResult> results;
+
+    for (const auto& entry : benchmarks) {
+        if (!filter.empty() && entry.first.find(filter) == std::string::npos) {
+            continue;
+        }
+        results.push_back(RunBenchmark(entry.first, entry.second));
+    }
+
+    return results;
+}
+
+void BenchmarkRunner::ListBenchmarks() const {
+    for (const auto& entry : benchmarks) {
+        std::cout << entry.first << std::endl;
+    }
+}
+
+void BenchmarkRunner::PrintResults(const std::vector<BenchmarkResult>& results) {
+    std::printf("%-48s %14s %12s %12s %12s %10s\n",
+                "Benchmark", "Iterations", "Median ns", "Min ns", "Max ns", "Stddev");
+    for (const auto& result : results) {
+        std::printf("%-48s %14llu %12.2f %12.2f %12.2f %9.1f%%\n",
+                    result.name.c_str(),
+                    static_cast<unsigned long long>(result.iterations),
+                    result.medianNs, result.minNs, result.maxNs,
+                    result.meanNs > 0.0 ? 100.0 * result.stddevNs / result.meanNs : 0.0);
+    }
+}
+
+bool BenchmarkRunner::WriteJson(const std::string& path, const std::vector<BenchmarkResult>& results) {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Failed to write benchmark results: " << path << std::endl;
+        return false;
+    }
+
+    file << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& result = results[i];
+        char line[512];
+        std::snprintf(line, sizeof(line),
+                      "    {\"name\": \"%s\", \"iterations\": %llu, \"repetitions\": %d, "
+                      "\"median_ns\": %.3f, \"mean_ns\": %.3f, \"min_ns\": %.3f, "
+                      "\"max_ns\": %.3f, \"stddev_ns\": %.3f}%s\n",
+                      result.name.c_str(),
+                      static_cast<unsigned long long>(result.iterations),
+                      result.repetitions, result.medianNs, result.meanNs,
+                      result.minNs, result.maxNs, result.stddevNs,
+                      (i + 1 < results.size()) ? "," : "");
+        file << line;
+    }
+    file << "  ]\n}\n";
+
+    return static_cast<bool>(file);
+}
+
+bool BenchmarkRunner::LoadBaseline(const std::string& path, std::map<std::string, double>& baseline) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+
+    // El formato es el que produce WriteJson: un objeto por línea,
+    // así que basta con extraer "name" y "median_ns" de cada línea
+    std::string line;
+    while (std::getline(file, line)) {
+        const std::string nameKey = "\"name\": \"";
+        const std::string medianKey = "\"median_ns\": ";
+
+        size_t namePos = line.find(nameKey);
+        size_t medianPos = line.find(medianKey);
+        if (namePos == std::string::npos || medianPos == std::string::npos) {
+            continue;
+        }
+
+        namePos += nameKey.size();
+        size_t nameEnd = line.find('"', namePos);
+        if (nameEnd == std::string::npos) {
+            continue;
+        }
+
+        baseline[line.substr(namePos, nameEnd - namePos)] =
+            std::strtod(line.c_str() + medianPos + medianKey.size(), nullptr);
+    }
+
+    return true;
+}
+
+int BenchmarkRunner::CompareWithBaseline(const std::vector<BenchmarkResult>& results,
+                                         const std::map<std::string, double>& baseline,
+                                         double thresholdPercent) {
+    int regressions = 0;
+
+    std::printf("\n%-48s %12s %12s %9s\n", "Benchmark", "Baseline ns", "Current ns", "Change");
+    for (const auto& result : results) {
+        auto it = baseline.find(result.name);
+        if (it == baseline.end() || it->second <= 0.0) {
+            std::printf("%-48s %12s %12.2f %9s\n", result.name.c_str(), "-", result.medianNs, "new");
+            continue;
+        }
+
+        double change = 100.0 * (result.medianNs - it->second) / it->second;
+        bool regressed = change > thresholdPercent;
+        if (regressed) {
+            regressions++;
+        }
+
+        std::printf("%-48s %12.2f %12.2f %+8.1f%%%s\n",
+                    result.name.c_str(), it->second, result.medianNs, change,
+                    regressed ? "  REGRESSION" : "");
+    }
+
+    return regressions;
+}
+
+// Métodos privados
+BenchmarkResult BenchmarkRunner::RunBenchmark(const std::string& name, const BenchmarkFactory& factory) const {
+    BenchmarkFunction function = factory();
+    std::uint64_t iterations = CalibrateIterations(function);
+
+    // Calentamiento: caches, predictores de saltos y asignaciones perezosas
+    for (int i = 0; i < warmupRepetitions; i++) {
+        MeasureNs(function, iterations);
+    }
+
+    std::vector<double> samples;
+    samples.reserve(repetitions);
+    for (int i = 0; i < repetitions; i++) {
+        samples.push_back(MeasureNs(function, iterations) / static_cast<double>(iterations));
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    BenchmarkResult result;
+    result.name = name;
+    result.iterations = iterations;
+    result.repetitions = repetitions;
+    result.minNs = samples.front();
+    result.maxNs = samples.back();
+
+    size_t middle = samples.size() / 2;
+    result.medianNs = (samples.size() % 2 == 0)
+        ? 0.5 * (samples[middle - 1] + samples[middle])
+        : samples[middle];
+
+    double sum = 0.0;
+    for (double sample : samples) {
+        sum += sample;
+    }
+    result.meanNs = sum / samples.size();
+
+    double variance = 0.0;
+    for (double sample : samples) {
+        variance += (sample - result.meanNs) * (sample - result.meanNs);
+    }
+    result.stddevNs = std::sqrt(variance / samples.size());
+
+    return result;
+}
+
+std::uint64_t BenchmarkRunner::CalibrateIterations(const BenchmarkFunction& function) const {
+    const double targetNs = minTimeMs * 1e6;
+    std::uint64_t iterations = 1;
+
+    // Duplicar (o escalar) hasta que una repetición supere el tiempo mínimo
+    while (true) {
+        double elapsed = MeasureNs(function, iterations);
+        if (elapsed >= targetNs || iterations >= (1ULL << 40)) {
+            return iterations;
+        }
+
+        double factor = (elapsed > 0.0) ? (targetNs * 1.2) / elapsed : 10.0;
+        factor = std::min(std::max(factor, 2.0), 100.0);
+        iterations = static_cast<std::uint64_t>(iterations * factor);
+    }
+}
+
+double BenchmarkRunner::MeasureNs(const BenchmarkFunction& function, std::uint64_t iterations) {
+    auto start = std::chrono::steady_clock::now();
+    function(iterations);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
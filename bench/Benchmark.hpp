@@ -0,0 +1,113 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Función medida por el harness
+ *
+ * Recibe el número de iteraciones a ejecutar; el harness divide
+ * el tiempo total entre ese número para obtener ns por operación.
+ */
+using BenchmarkFunction = std::function<void(std::uint64_t iterations)>;
+
+/**
+ * @brief Prepara el estado de un caso fuera de la medición
+ *
+ * Se invoca una vez antes de calibrar; la función devuelta captura
+ * el estado ya construido (serpientes, renderers, etc.).
+ */
+using BenchmarkFactory = std::function<BenchmarkFunction()>;
+
+/**
+ * @brief Resultado de un caso de benchmark
+ */
+struct BenchmarkResult {
+    std::string name;
+    std::uint64_t iterations;   // Iteraciones por repetición
+    int repetitions;
+    double medianNs;            // ns por operación (mediana de las repeticiones)
+    double meanNs;
+    double minNs;
+    double maxNs;
+    double stddevNs;
+};
+
+/**
+ * @brief Harness de microbenchmarks
+ *
+ * Calibra el número de iteraciones para que cada repetición dure al menos
+ * minTimeMs, descarta las repeticiones de calentamiento y reporta
+ * estadísticas sobre las repeticiones medidas.
+ */
+class BenchmarkRunner {
+private:
+    std::vector<std::pair<std::string, BenchmarkFactory>> benchmarks;
+    std::string filter;
+    int repetitions;
+    int warmupRepetitions;
+    double minTimeMs;
+
+public:
+    BenchmarkRunner();
+
+    // Métodos de registro (verbos)
+    void AddBenchmark(const std::string& name, BenchmarkFactory factory);
+    std::vector<BenchmarkResult> RunAll();
+    void ListBenchmarks() const;
+
+    // Métodos de reporte
+    static void PrintResults(const std::vector<BenchmarkResult>& results);
+    static bool WriteJson(const std::string& path, const std::vector<BenchmarkResult>& results);
+    static bool LoadBaseline(const std::string& path, std::map<std::string, double>& baseline);
+    static int CompareWithBaseline(const std::vector<BenchmarkResult>& results,
+                                   const std::map<std::string, double>& baseline,
+                                   double thresholdPercent);
+
+    // Setters
+    void SetFilter(const std::string& value) { filter = value; }
+    void SetRepetitions(int value) { repetitions = value; }
+    void SetWarmupRepetitions(int value) { warmupRepetitions = value; }
+    void SetMinTimeMs(double value) { minTimeMs = value; }
+
+private:
+    // Métodos privados auxiliares
+    BenchmarkResult RunBenchmark(const std::string& name, const BenchmarkFactory& factory) const;
+    std::uint64_t CalibrateIterations(const BenchmarkFunction& function) const;
+    static double MeasureNs(const BenchmarkFunction& function, std::uint64_t iterations);
+};
+
+/**
+ * @brief Evita que el compilador elimine un cálculo cuyo resultado no se usa
+ */
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Barrera de compilador para forzar escrituras a memoria
+ */
+inline void ClobberMemory() {
+    asm volatile("" : : : "memory");
+}
+
+// Registro de suites (una por área del juego)
+void RegisterSnakeBenchmarks(BenchmarkRunner& runner);
+void RegisterFoodBenchmarks(BenchmarkRunner& runner);
+void RegisterInputBenchmarks(BenchmarkRunner& runner);
+void RegisterRenderBenchmarks(BenchmarkRunner& runner);
+void RegisterAudioBenchmarks(BenchmarkRunner& runner);
+void RegisterRulesBenchmarks(BenchmarkRunner& runner);
+void RegisterLeaderboardBenchmarks(BenchmarkRunner& runner);
+void RegisterMetricsBenchmarks(BenchmarkRunner& runner);
+void RegisterBatchBenchmarks(BenchmarkRunner& runner);
+void RegisterObservationBenchmarks(BenchmarkRunner& runner);
+void RegisterPolicyBenchmarks(BenchmarkRunner& runner);
+void RegisterSearchBenchmarks(BenchmarkRunner& runner);
+
+#endif // BENCHMARK_HPP
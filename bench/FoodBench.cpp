@@ -0,0 +1,27 @@
+#include "Benchmark.hpp"
+#include "BenchFixtures.hpp"
+#include "Food.hpp"
+#include <algorithm>
+#include <memory>
+#include <string>
+
+void RegisterFoodBenchmarks(BenchmarkRunner& runner) {
+    const int fillPercents[] = { 0, 50, 90 };
+
+    for (int fillPercent : fillPercents) {
+        int cells = BENCH_GRID_WIDTH * BENCH_GRID_HEIGHT;
+        int length = std::max(3, cells * fillPercent / 100);
+
+        runner.AddBenchmark("Food::GenerateNewPosition/fill:" + std::to_string(fillPercent) + "%",
+                            [length]() -> BenchmarkFunction {
+            auto snake = std::make_shared<Snake>(BuildSerpentineSnake(length));
+            auto food = std::make_shared<Food>();
+            return [snake, food](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; i++) {
+                    food->GenerateNewPosition(BENCH_GRID_WIDTH, BENCH_GRID_HEIGHT, *snake);
+                }
+                DoNotOptimize(food->GetPosition());
+            };
+        });
+    }
+}
@@ -0,0 +1,78 @@
+#include "Benchmark.hpp"
+#include "InputHandler.hpp"
+#include <memory>
+#include <vector>
+
+namespace {
+
+std::shared_ptr<InputHandler> MakeInputHandler() {
+    // Sin instancia de Game las acciones se resuelven pero no modifican estado,
+    // así que se mide solo el costo de búsqueda y despacho
+    auto inputHandler = std::make_shared<InputHandler>();
+    inputHandler->Initialize(nullptr);
+    return inputHandler;
+}
+
+void AddKeyPressBenchmark(BenchmarkRunner& runner, const std::string& name, sf::Keyboard::Key key) {
+    runner.AddBenchmark(name, [key]() -> BenchmarkFunction {
+        auto inputHandler = MakeInputHandler();
+        return [inputHandler, key](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                inputHandler->ProcessKeyPressed(key);
+                ClobberMemory();
+            }
+        };
+    });
+}
+
+// Ráfaga típica: pulsar y soltar teclas de dirección, de acción y sin asignar
+std::vector<sf::Event> MakeEventStream() {
+    const sf::Keyboard::Key keys[] = {
+        sf::Keyboard::Up, sf::Keyboard::Left, sf::Keyboard::W, sf::Keyboard::D,
+        sf::Keyboard::Space, sf::Keyboard::F5, sf::Keyboard::LShift, sf::Keyboard::Down,
+    };
+
+    std::vector<sf::Event> events;
+    for (sf::Keyboard::Key key : keys) {
+        sf::Event event;
+        event.type = sf::Event::KeyPressed;
+        event.key.code = key;
+        events.push_back(event);
+        event.type = sf::Event::KeyReleased;
+        events.push_back(event);
+    }
+    return events;
+}
+
+} // namespace
+
+void RegisterInputBenchmarks(BenchmarkRunner& runner) {
+    AddKeyPressBenchmark(runner, "InputHandler::ProcessKeyPressed/direction", sf::Keyboard::Up);
+    AddKeyPressBenchmark(runner, "InputHandler::ProcessKeyPressed/action", sf::Keyboard::Space);
+    AddKeyPressBenchmark(runner, "InputHandler::ProcessKeyPressed/unmapped", sf::Keyboard::F5);
+
+    // Una iteración = un evento despachado
+    runner.AddBenchmark("InputHandler::ProcessEvent/mixed", []() -> BenchmarkFunction {
+        auto inputHandler = MakeInputHandler();
+        auto events = std::make_shared<std::vector<sf::Event>>(MakeEventStream());
+        return [inputHandler, events](std::uint64_t iterations) {
+            const size_t count = events->size();
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                inputHandler->ProcessEvent((*events)[i % count]);
+                ClobberMemory();
+            }
+        };
+    });
+
+    runner.AddBenchmark("InputHandler::IsAnyKeyPressed", []() -> BenchmarkFunction {
+        auto inputHandler = MakeInputHandler();
+        inputHandler->ProcessKeyPressed(sf::Keyboard::Up);
+        inputHandler->ProcessKeyReleased(sf::Keyboard::Up);
+        return [inputHandler](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                bool pressed = inputHandler->IsAnyKeyPressed();
+                DoNotOptimize(pressed);
+            }
+        };
+    });
+}
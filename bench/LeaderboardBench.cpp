@@ -0,0 +1,126 @@
+#include "Benchmark.hpp"
+#include "Leaderboard.hpp"
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace {
+
+const size_t RECORD_COUNT = 10000000;
+
+// Puntuaciones sintéticas con el reparto de ScoreRecovery (múltiplos de 10 hasta 19990)
+std::vector<ScoreRecord> GenerateRecords(size_t count) {
+    std::vector<ScoreRecord> records(count);
+    std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (size_t i = 0; i < count; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        records[i].sequence = i + 1;
+        records[i].score = static_cast<std::int32_t>(state % 2000) * 10;
+    }
+    return records;
+}
+
+// Compartidas por todos los casos: generar 10M entradas cuesta más que medirlas
+std::shared_ptr<const std::vector<ScoreRecord>> GetRecords() {
+    static std::shared_ptr<const std::vector<ScoreRecord>> records =
+        std::make_shared<const std::vector<ScoreRecord>>(GenerateRecords(RECORD_COUNT));
+    return records;
+}
+
+std::shared_ptr<Leaderboard> BuildLeaderboard() {
+    auto leaderboard = std::make_shared<Leaderboard>();
+    leaderboard->Build(*GetRecords());
+    return leaderboard;
+}
+
+} // namespace
+
+void RegisterLeaderboardBenchmarks(BenchmarkRunner& runner) {
+    // Una iteración = indexar las 10M puntuaciones (lo que hace Game al abrir el almacén)
+    runner.AddBenchmark("Leaderboard::Build/10M", []() -> BenchmarkFunction {
+        auto records = GetRecords();
+        auto leaderboard = std::make_shared<Leaderboard>();
+        return [records, leaderboard](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                leaderboard->Build(*records);
+                DoNotOptimize(leaderboard->GetCount());
+            }
+        };
+    });
+
+    runner.AddBenchmark("Leaderboard::Insert/10M", []() -> BenchmarkFunction {
+        auto leaderboard = BuildLeaderboard();
+        return [leaderboard](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                leaderboard->Insert(static_cast<int>((i * 7919) % 20000));
+            }
+            DoNotOptimize(leaderboard->GetCount());
+        };
+    });
+
+    runner.AddBenchmark("Leaderboard::GetRank/10M", []() -> BenchmarkFunction {
+        auto leaderboard = BuildLeaderboard();
+        return [leaderboard](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                DoNotOptimize(leaderboard->GetRank(static_cast<int>((i * 7919) % 20000)));
+            }
+        };
+    });
+
+    runner.AddBenchmark("Leaderboard::GetScoreAtRank/10M", []() -> BenchmarkFunction {
+        auto leaderboard = BuildLeaderboard();
+        return [leaderboard](std::uint64_t iterations) {
+            std::uint64_t count = leaderboard->GetCount();
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                DoNotOptimize(leaderboard->GetScoreAtRank(1 + (i * 2654435761ULL) % count));
+            }
+        };
+    });
+
+    runner.AddBenchmark("Leaderboard::GetTopScores/10M/k=10", []() -> BenchmarkFunction {
+        auto leaderboard = BuildLeaderboard();
+        auto scores = std::make_shared<std::vector<int>>();
+        return [leaderboard, scores](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                leaderboard->GetTopScores(10, *scores);
+                DoNotOptimize(scores->data());
+            }
+        };
+    });
+
+    // Referencia: vector ordenado (búsqueda binaria para el puesto, inserción O(n))
+    runner.AddBenchmark("SortedVector::GetRank/10M", []() -> BenchmarkFunction {
+        auto sorted = std::make_shared<std::vector<int>>();
+        sorted->reserve(RECORD_COUNT);
+        for (const ScoreRecord& record : *GetRecords()) {
+            sorted->push_back(record.score);
+        }
+        std::sort(sorted->begin(), sorted->end());
+        return [sorted](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                int score = static_cast<int>((i * 7919) % 20000);
+                auto above = sorted->end() - std::upper_bound(sorted->begin(), sorted->end(), score);
+                DoNotOptimize(above);
+            }
+        };
+    });
+
+    runner.AddBenchmark("SortedVector::Insert/10M", []() -> BenchmarkFunction {
+        auto sorted = std::make_shared<std::vector<int>>();
+        sorted->reserve(RECORD_COUNT * 2);
+        for (const ScoreRecord& record : *GetRecords()) {
+            sorted->push_back(record.score);
+        }
+        std::sort(sorted->begin(), sorted->end());
+        return [sorted](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                int score = static_cast<int>((i * 7919) % 20000);
+                sorted->insert(std::upper_bound(sorted->begin(), sorted->end(), score), score);
+            }
+            DoNotOptimize(sorted->size());
+        };
+    });
+}
@@ -0,0 +1,34 @@
+#include "Benchmark.hpp"
+#include "Metrics.hpp"
+#include <atomic>
+#include <memory>
+
+void RegisterMetricsBenchmarks(BenchmarkRunner& runner) {
+    runner.AddBenchmark("Metrics::Increment", []() -> BenchmarkFunction {
+        return [](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                Metrics::Increment(MetricCounter::FRAMES);
+                ClobberMemory();
+            }
+        };
+    });
+
+    runner.AddBenchmark("Metrics::Observe", []() -> BenchmarkFunction {
+        return [](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                Metrics::Observe(MetricHistogram::FRAME_TIME, i & 4095);
+                ClobberMemory();
+            }
+        };
+    });
+
+    // Referencia: un contador atómico único para todos los hilos
+    runner.AddBenchmark("SharedAtomic::fetch_add", []() -> BenchmarkFunction {
+        auto counter = std::make_shared<std::atomic<std::uint64_t>>(0);
+        return [counter](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                counter->fetch_add(1, std::memory_order_relaxed);
+            }
+        };
+    });
+}
@@ -0,0 +1,92 @@
+#include "Benchmark.hpp"
+#include "ObservationEncoder.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int WARMUP_STEPS = 500;       // Serpientes con algo de cuerpo antes de medir
+
+// Entorno avanzado con acciones al azar; el estado no cambia durante la medida
+struct ObservationFixture {
+    BatchEnvironment environment;
+    std::unique_ptr<ObservationEncoder> encoder;
+    std::vector<std::uint8_t> bytes;
+    std::vector<float> floats;
+
+    ObservationFixture(size_t gameCount, int width, int height) : environment(gameCount, width, height) {
+        std::vector<std::int8_t> actions(gameCount);
+        std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+        for (int step = 0; step < WARMUP_STEPS; step++) {
+            for (std::int8_t& action : actions) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                int value = static_cast<int>(state % 8);
+                action = static_cast<std::int8_t>(value < 4 ? value : BatchEnvironment::NO_ACTION);
+            }
+            environment.Step(actions.data());
+        }
+    }
+};
+
+std::string BoardName(size_t gameCount, int width, int height) {
+    return std::to_string(gameCount) + "x" + std::to_string(width) + "x" + std::to_string(height);
+}
+
+void AddEncoderBenchmark(BenchmarkRunner& runner, size_t gameCount, int width, int height,
+                         ObservationEncoder::Format format, int radius, BatchEnvironment::SimdLevel level) {
+    std::string name = "ObservationEncoder::Encode/" + BoardName(gameCount, width, height) +
+                       (radius ? "/view" + std::to_string(radius) : "/full") +
+                       (format == ObservationEncoder::Format::BITS ? "/bits" : "/uint8") +
+                       (level == BatchEnvironment::SimdLevel::AVX2 ? "/avx2" : "/scalar");
+
+    // Una iteración = la observación de una partida
+    runner.AddBenchmark(name, [gameCount, width, height, format, radius, level]() -> BenchmarkFunction {
+        auto fixture = std::make_shared<ObservationFixture>(gameCount, width, height);
+        fixture->encoder = std::make_unique<ObservationEncoder>(fixture->environment, format, radius);
+        fixture->encoder->SetSimdLevel(level);
+        fixture->bytes.resize(gameCount * fixture->encoder->GetObservationSize());
+        return [fixture, gameCount](std::uint64_t iterations) {
+            for (std::uint64_t done = 0; done < iterations; done += gameCount) {
+                fixture->encoder->Encode(fixture->environment, fixture->bytes.data());
+            }
+            DoNotOptimize(fixture->bytes.data());
+        };
+    });
+}
+
+// Referencia: las observaciones float de BatchEnvironment (3 planos, 4 bytes por celda)
+void AddFloatBenchmark(BenchmarkRunner& runner, size_t gameCount, int width, int height) {
+    std::string name = "BatchEnvironment::EncodeObservations/" + BoardName(gameCount, width, height) + "/float";
+
+    runner.AddBenchmark(name, [gameCount, width, height]() -> BenchmarkFunction {
+        auto fixture = std::make_shared<ObservationFixture>(gameCount, width, height);
+        fixture->floats.resize(gameCount * fixture->environment.GetObservationSize());
+        return [fixture, gameCount](std::uint64_t iterations) {
+            for (std::uint64_t done = 0; done < iterations; done += gameCount) {
+                fixture->environment.EncodeObservations(fixture->floats.data());
+            }
+            DoNotOptimize(fixture->floats.data());
+        };
+    });
+}
+
+} // namespace
+
+void RegisterObservationBenchmarks(BenchmarkRunner& runner) {
+    const int boards[][3] = { { 256, 50, 35 }, { 16, 256, 256 } };    // Partidas, ancho, alto
+
+    for (const auto& board : boards) {
+        AddFloatBenchmark(runner, board[0], board[1], board[2]);
+        for (BatchEnvironment::SimdLevel level : { BatchEnvironment::SimdLevel::SCALAR, BatchEnvironment::SimdLevel::AVX2 }) {
+            if (level > BatchEnvironment::DetectSimdLevel()) continue;
+
+            for (ObservationEncoder::Format format : { ObservationEncoder::Format::UINT8, ObservationEncoder::Format::BITS }) {
+                AddEncoderBenchmark(runner, board[0], board[1], board[2], format, 0, level);
+                AddEncoderBenchmark(runner, board[0], board[1], board[2], format, 7, level);
+            }
+        }
+    }
+}
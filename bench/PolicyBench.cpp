@@ -0,0 +1,92 @@
+#include "Benchmark.hpp"
+#include "GameSimulation.hpp"
+#include "InputSource.hpp"
+#include "ObservationEncoder.hpp"
+#include "PolicyNetwork.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int VIEW_RADIUS = 5;
+
+// Red de referencia: vista 11x11, convolución de 8 canales, 64 ocultas y 4 salidas
+std::shared_ptr<PolicyNetwork> CreateNetwork() {
+    auto network = std::make_shared<PolicyNetwork>();
+    int side = 2 * VIEW_RADIUS + 1;
+    network->Configure(ObservationEncoder::PLANE_COUNT, side, side,
+                       { PolicyLayer(PolicyLayerType::CONV3X3, 8), PolicyLayer(PolicyLayerType::DENSE, 64),
+                         PolicyLayer(PolicyLayerType::DENSE, PolicyNetwork::ACTION_COUNT, false) });
+    network->InitializeRandom(1);
+    return network;
+}
+
+struct PolicyFixture {
+    std::shared_ptr<PolicyNetwork> network;
+    PolicyWorkspace workspace;
+    std::vector<float> inputs;
+    std::vector<std::int8_t> actions;
+
+    PolicyFixture(size_t batch) : network(CreateNetwork()), inputs(batch * network->GetInputSize()), actions(batch) {
+        // Entradas dispersas de 0 y 1, como las observaciones reales
+        std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+        for (float& value : inputs) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            value = (state % 8 == 0) ? 1.0f : 0.0f;
+        }
+    }
+};
+
+void AddForwardBenchmark(BenchmarkRunner& runner, size_t batch, BatchEnvironment::SimdLevel level) {
+    std::string name = "PolicyNetwork::SelectActions/" + std::to_string(batch) +
+                       (level == BatchEnvironment::SimdLevel::AVX2 ? "/avx2" : "/scalar");
+
+    // Una iteración = un lote; el coste por decisión es ns / tamaño del lote
+    runner.AddBenchmark(name, [batch, level]() -> BenchmarkFunction {
+        auto fixture = std::make_shared<PolicyFixture>(batch);
+        fixture->network->SetSimdLevel(level);
+        return [fixture, batch](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                fixture->network->SelectActions(fixture->inputs.data(), batch, fixture->actions.data(),
+                                                fixture->workspace);
+            }
+            DoNotOptimize(fixture->actions.data());
+        };
+    });
+}
+
+// Camino del juego: vista desde GameSimulation, conversión e inferencia de una partida
+struct PolicyGame {
+    GameSimulation simulation;
+    PolicyInputSource source;
+
+    PolicyGame() : simulation(50, 35), source(CreateNetwork()) {
+        simulation.Reset(1);
+    }
+};
+
+} // namespace
+
+void RegisterPolicyBenchmarks(BenchmarkRunner& runner) {
+    for (BatchEnvironment::SimdLevel level : { BatchEnvironment::SimdLevel::SCALAR, BatchEnvironment::SimdLevel::AVX2 }) {
+        if (level > BatchEnvironment::DetectSimdLevel()) continue;
+
+        for (size_t batch : { 1, 32, 1024 }) {
+            AddForwardBenchmark(runner, batch, level);
+        }
+    }
+
+    // Una iteración = una decisión en una partida del juego (lote de 1)
+    runner.AddBenchmark("PolicyInputSource::NextDirection", []() -> BenchmarkFunction {
+        auto game = std::make_shared<PolicyGame>();
+        return [game](std::uint64_t iterations) {
+            DirectionInput input;
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                DoNotOptimize(game->source.NextDirection(game->simulation, input));
+            }
+        };
+    });
+}
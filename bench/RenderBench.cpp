@@ -0,0 +1,145 @@
+#include "Benchmark.hpp"
+#include "BenchFixtures.hpp"
+#include "Food.hpp"
+#include "GameRenderer.hpp"
+#include "SoftwareRasterizer.hpp"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int FRAME_WIDTH = 1200;
+const int FRAME_HEIGHT = 900;
+
+// Imagen sintética: bordes transparentes, anillo semitransparente y centro opaco,
+// para ejercitar los tres caminos de la mezcla alfa
+RasterImage MakeSpriteImage(int size, std::uint8_t tint) {
+    std::vector<std::uint8_t> pixels(static_cast<size_t>(size) * size * 4);
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            int edge = std::min(std::min(x, y), std::min(size - 1 - x, size - 1 - y));
+            std::uint8_t* pixel = &pixels[(static_cast<size_t>(y) * size + x) * 4];
+            pixel[0] = tint;
+            pixel[1] = static_cast<std::uint8_t>(x * 255 / size);
+            pixel[2] = static_cast<std::uint8_t>(y * 255 / size);
+            pixel[3] = (edge == 0) ? 0 : (edge < size / 4 ? 160 : 255);
+        }
+    }
+
+    RasterImage image;
+    SoftwareRasterizer::CreateImage(pixels.data(), size, size, image);
+    return image;
+}
+
+RasterImage MakeOpaqueImage(int width, int height) {
+    std::vector<std::uint8_t> pixels(static_cast<size_t>(width) * height * 4, 255);
+    for (size_t i = 0; i < pixels.size(); i += 4) {
+        pixels[i] = static_cast<std::uint8_t>(i / 4);
+    }
+
+    RasterImage image;
+    SoftwareRasterizer::CreateImage(pixels.data(), width, height, image);
+    return image;
+}
+
+void LoadSyntheticAssets(GameRenderer& renderer) {
+    const char* spriteNames[] = {
+        "snake_head", "snake_head_right", "snake_head_left", "snake_head_back",
+        "snake_body", "snake_body_vertical", "snake_segment", "food"
+    };
+
+    for (const char* name : spriteNames) {
+        renderer.AddImage(name, MakeSpriteImage(64, 40));
+    }
+    for (int digit = 0; digit <= 9; digit++) {
+        renderer.AddImage("num_" + std::to_string(digit), MakeSpriteImage(96, 200));
+    }
+    renderer.AddImage("background", MakeOpaqueImage(1600, 1200));
+}
+
+const char* SimdLevelName(SoftwareRasterizer::SimdLevel level) {
+    switch (level) {
+        case SoftwareRasterizer::SimdLevel::AVX2:
+            return "avx2";
+        case SoftwareRasterizer::SimdLevel::SSE2:
+            return "sse2";
+        default:
+            return "scalar";
+    }
+}
+
+} // namespace
+
+void RegisterRenderBenchmarks(BenchmarkRunner& runner) {
+    const int lengths[] = { 3, 100, 1000 };
+
+    // Construcción del lote de sprites de la serpiente (sin ventana ni GPU)
+    for (int length : lengths) {
+        runner.AddBenchmark("GameRenderer::BuildSnakeBatch/length:" + std::to_string(length),
+                            [length]() -> BenchmarkFunction {
+            auto snake = std::make_shared<Snake>(BuildSerpentineSnake(length));
+            auto renderer = std::make_shared<GameRenderer>();
+            auto batch = std::make_shared<std::vector<SpriteCommand>>();
+            return [snake, renderer, batch](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; i++) {
+                    renderer->BuildSnakeBatch(*snake, *batch);
+                    DoNotOptimize(batch->data());
+                }
+            };
+        });
+    }
+
+    const SoftwareRasterizer::SimdLevel levels[] = {
+        SoftwareRasterizer::SimdLevel::SCALAR,
+        SoftwareRasterizer::SimdLevel::SSE2,
+        SoftwareRasterizer::SimdLevel::AVX2
+    };
+
+    for (SoftwareRasterizer::SimdLevel level : levels) {
+        if (static_cast<int>(level) > static_cast<int>(SoftwareRasterizer::DetectSimdLevel())) {
+            continue;
+        }
+
+        // Mezcla alfa de una fila de 1200 píxeles semitransparentes
+        runner.AddBenchmark(std::string("SoftwareRasterizer::FillRect/blend/") + SimdLevelName(level),
+                            [level]() -> BenchmarkFunction {
+            auto rasterizer = std::make_shared<SoftwareRasterizer>();
+            rasterizer->Initialize(FRAME_WIDTH, FRAME_HEIGHT);
+            rasterizer->SetSimdLevel(level);
+            return [rasterizer](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; i++) {
+                    rasterizer->FillRect(0, 0, FRAME_WIDTH, 1, sf::Color(0, 0, 0, 128));
+                    ClobberMemory();
+                }
+            };
+        });
+
+        // Frame completo de juego a 1200x900 con el backend por software
+        runner.AddBenchmark(std::string("GameRenderer::HeadlessFrame/length:100/") + SimdLevelName(level),
+                            [level]() -> BenchmarkFunction {
+            auto renderer = std::make_shared<GameRenderer>();
+            renderer->InitializeHeadless(FRAME_WIDTH, FRAME_HEIGHT);
+            renderer->GetRasterizer()->SetSimdLevel(level);
+            LoadSyntheticAssets(*renderer);
+
+            auto snake = std::make_shared<Snake>(BuildSerpentineSnake(100));
+            auto food = std::make_shared<Food>();
+            food->SetPosition(Position(25, 30));
+
+            return [renderer, snake, food](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; i++) {
+                    renderer->Clear();
+                    renderer->RenderBackground();
+                    renderer->RenderGameBounds();
+                    renderer->RenderFood(*food);
+                    renderer->RenderSnake(*snake);
+                    renderer->RenderScore(1230);
+                    renderer->Present();
+                    DoNotOptimize(renderer->GetRasterizer()->GetPixels());
+                }
+            };
+        });
+    }
+}
@@ -0,0 +1,50 @@
+#include "Benchmark.hpp"
+#include "GameSimulation.hpp"
+#include "InputSource.hpp"
+#include <memory>
+#include <string>
+
+namespace {
+
+// Partida conducida por el bot: serpientes largas, como en una sesión real
+struct BotGame {
+    GameSimulation simulation;
+    BotInputSource bot;
+    std::uint32_t seed;
+
+    explicit BotGame(const GameRules& rules) : simulation(50, 35), seed(1) {
+        simulation.SetRules(rules);
+        simulation.Reset(seed);
+    }
+};
+
+const std::uint64_t MAX_ROUND_TICKS = 20000;
+
+} // namespace
+
+void RegisterRulesBenchmarks(BenchmarkRunner& runner) {
+    for (int variant = 0; variant < 8; variant++) {
+        GameRules rules;
+        rules.wrapWalls = (variant & 4) != 0;
+        rules.selfCollision = (variant & 2) == 0;
+        rules.multiCellGrowth = (variant & 1) != 0;
+
+        // Una iteración = un tick con su entrada
+        runner.AddBenchmark("GameSimulation::Tick/" + rules.ToString(), [rules]() -> BenchmarkFunction {
+            auto game = std::make_shared<BotGame>(rules);
+            return [game](std::uint64_t iterations) {
+                GameSimulation& simulation = game->simulation;
+                DirectionInput input;
+                for (std::uint64_t i = 0; i < iterations; i++) {
+                    game->bot.Apply(simulation, input);
+                    TickResult result = simulation.Tick();
+                    DoNotOptimize(result);
+
+                    if (simulation.IsGameOver() || simulation.GetTickCount() >= MAX_ROUND_TICKS) {
+                        simulation.Reset(++game->seed);
+                    }
+                }
+            };
+        });
+    }
+}
@@ -0,0 +1,117 @@
+#include "Benchmark.hpp"
+#include "BenchFixtures.hpp"
+#include "TranspositionTable.hpp"
+#include "ZobristHash.hpp"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+const size_t KEY_COUNT = 1 << 20;
+
+std::vector<std::uint64_t> CreateKeys(std::uint64_t seed) {
+    std::vector<std::uint64_t> keys(KEY_COUNT);
+    std::uint64_t state = seed;
+    for (std::uint64_t& key : keys) {
+        state += 0x9E3779B97F4A7C15ULL;
+        std::uint64_t value = (state ^ (state >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        key = value ^ (value >> 31);
+    }
+    return keys;
+}
+
+// Tabla con la mitad de su capacidad (o KEY_COUNT claves) ya guardada. Los
+// dos tamaños son potencias de 2: el índice de la clave es una máscara, no un módulo
+struct TableFixture {
+    TranspositionTable table;
+    std::vector<std::uint64_t> storedKeys;
+    std::vector<std::uint64_t> missingKeys;
+    size_t storedCount;
+
+    explicit TableFixture(size_t sizeBytes)
+        : table(sizeBytes), storedKeys(CreateKeys(1)), missingKeys(CreateKeys(2)),
+          storedCount(std::min(KEY_COUNT, table.GetCapacity() / 2)) {
+        for (size_t index = 0; index < storedCount; index++) {
+            table.Store(storedKeys[index], TranspositionEntry(static_cast<std::int32_t>(index), 4));
+        }
+    }
+};
+
+void AddTableBenchmarks(BenchmarkRunner& runner, const std::string& sizeName, size_t sizeBytes) {
+    // Claves en orden aleatorio: cada acceso es una línea de caché distinta
+    runner.AddBenchmark("TranspositionTable::Probe/hit/" + sizeName, [sizeBytes]() -> BenchmarkFunction {
+        auto fixture = std::make_shared<TableFixture>(sizeBytes);
+        return [fixture](std::uint64_t iterations) {
+            TranspositionEntry entry;
+            size_t hits = 0;
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                hits += fixture->table.Probe(fixture->storedKeys[i & (fixture->storedCount - 1)], entry);
+            }
+            DoNotOptimize(hits);
+        };
+    });
+
+    runner.AddBenchmark("TranspositionTable::Probe/miss/" + sizeName, [sizeBytes]() -> BenchmarkFunction {
+        auto fixture = std::make_shared<TableFixture>(sizeBytes);
+        return [fixture](std::uint64_t iterations) {
+            TranspositionEntry entry;
+            size_t hits = 0;
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                hits += fixture->table.Probe(fixture->missingKeys[i & (KEY_COUNT - 1)], entry);
+            }
+            DoNotOptimize(hits);
+        };
+    });
+
+    runner.AddBenchmark("TranspositionTable::Store/" + sizeName, [sizeBytes]() -> BenchmarkFunction {
+        auto fixture = std::make_shared<TableFixture>(sizeBytes);
+        return [fixture](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; i++) {
+                fixture->table.Store(fixture->missingKeys[i & (KEY_COUNT - 1)],
+                                     TranspositionEntry(static_cast<std::int32_t>(i), static_cast<int>(i & 15)));
+            }
+            DoNotOptimize(fixture->table.GetBucketCount());
+        };
+    });
+}
+
+} // namespace
+
+void RegisterSearchBenchmarks(BenchmarkRunner& runner) {
+    auto keys = std::make_shared<ZobristHash>(BENCH_GRID_WIDTH, BENCH_GRID_HEIGHT);
+
+    for (int length : { 3, 100, 1000 }) {
+        std::string suffix = "/length:" + std::to_string(length);
+
+        // Movimiento con vuelta (la cabeza no sale de la grilla), sin y con hash incremental
+        for (bool isHashed : { false, true }) {
+            runner.AddBenchmark(std::string("ZobristHash::Move/") + (isHashed ? "hashed" : "plain") + suffix,
+                                [length, isHashed, keys]() -> BenchmarkFunction {
+                Snake snake = BuildSerpentineSnake(length);
+                snake.SetZobristHash(isHashed ? keys.get() : nullptr);
+                return [snake, keys](std::uint64_t iterations) mutable {
+                    for (std::uint64_t i = 0; i < iterations; i++) {
+                        snake.Move();
+                        snake.WrapHead(BENCH_GRID_WIDTH, BENCH_GRID_HEIGHT);
+                    }
+                    DoNotOptimize(snake.GetHash());
+                };
+            });
+        }
+
+        // Lo que costaría rehacer el hash en cada nodo sin la actualización incremental
+        runner.AddBenchmark("ZobristHash::ComputeSnake" + suffix, [length, keys]() -> BenchmarkFunction {
+            return [snake = BuildSerpentineSnake(length), keys](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; i++) {
+                    DoNotOptimize(keys->ComputeSnake(snake));
+                }
+            };
+        });
+    }
+
+    AddTableBenchmarks(runner, "256KiB", 256 * 1024);
+    AddTableBenchmarks(runner, "256MiB", 256 * 1024 * 1024);
+}
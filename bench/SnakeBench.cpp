@@ -0,0 +1,40 @@
+#include "Benchmark.hpp"
+#include "BenchFixtures.hpp"
+#include <string>
+
+void RegisterSnakeBenchmarks(BenchmarkRunner& runner) {
+    const int lengths[] = { 3, 100, 1000 };
+
+    for (int length : lengths) {
+        std::string suffix = "/length:" + std::to_string(length);
+
+        runner.AddBenchmark("Snake::Move" + suffix, [length]() -> BenchmarkFunction {
+            return [snake = BuildSerpentineSnake(length)](std::uint64_t iterations) mutable {
+                for (std::uint64_t i = 0; i < iterations; i++) {
+                    snake.Move();
+                }
+                DoNotOptimize(snake.GetHead());
+            };
+        });
+
+        runner.AddBenchmark("Snake::CheckSelfCollision" + suffix, [length]() -> BenchmarkFunction {
+            return [snake = BuildSerpentineSnake(length)](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; i++) {
+                    bool collided = snake.CheckSelfCollision();
+                    DoNotOptimize(collided);
+                }
+            };
+        });
+
+        // Peor caso: la posición no pertenece a la serpiente
+        runner.AddBenchmark("Snake::CheckCollisionAt" + suffix, [length]() -> BenchmarkFunction {
+            return [snake = BuildSerpentineSnake(length)](std::uint64_t iterations) {
+                Position outside(-1, -1);
+                for (std::uint64_t i = 0; i < iterations; i++) {
+                    bool collided = snake.CheckCollisionAt(outside);
+                    DoNotOptimize(collided);
+                }
+            };
+        });
+    }
+}
@@ -0,0 +1,101 @@
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace {
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --filter <text>        Run only benchmarks whose name contains <text>\n"
+              << "  --repetitions <n>      Measured repetitions per benchmark (default 10)\n"
+              << "  --warmup <n>           Warm-up repetitions per benchmark (default 2)\n"
+              << "  --min-time <ms>        Minimum duration of one repetition (default 20)\n"
+              << "  --json <file>          Write results as JSON\n"
+              << "  --baseline <file>      Compare against a stored JSON baseline\n"
+              << "  --threshold <percent>  Allowed slowdown before failing (default 10)\n"
+              << "  --list                 List benchmark names and exit\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchmarkRunner runner;
+    std::string jsonPath;
+    std::string baselinePath;
+    double thresholdPercent = 10.0;
+    bool listOnly = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--filter" && hasValue) {
+            runner.SetFilter(argv[++i]);
+        } else if (arg == "--repetitions" && hasValue) {
+            runner.SetRepetitions(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--warmup" && hasValue) {
+            runner.SetWarmupRepetitions(std::max(0, std::atoi(argv[++i])));
+        } else if (arg == "--min-time" && hasValue) {
+            runner.SetMinTimeMs(std::atof(argv[++i]));
+        } else if (arg == "--json" && hasValue) {
+            jsonPath = argv[++i];
+        } else if (arg == "--baseline" && hasValue) {
+            baselinePath = argv[++i];
+        } else if (arg == "--threshold" && hasValue) {
+            thresholdPercent = std::atof(argv[++i]);
+        } else if (arg == "--list") {
+            listOnly = true;
+        } else {
+            PrintUsage(argv[0]);
+            return (arg == "--help") ? 0 : 2;
+        }
+    }
+
+    RegisterSnakeBenchmarks(runner);
+    RegisterFoodBenchmarks(runner);
+    RegisterInputBenchmarks(runner);
+    RegisterRenderBenchmarks(runner);
+    RegisterAudioBenchmarks(runner);
+    RegisterRulesBenchmarks(runner);
+    RegisterLeaderboardBenchmarks(runner);
+    RegisterMetricsBenchmarks(runner);
+    RegisterBatchBenchmarks(runner);
+    RegisterObservationBenchmarks(runner);
+    RegisterPolicyBenchmarks(runner);
+    RegisterSearchBenchmarks(runner);
+
+    if (listOnly) {
+        runner.ListBenchmarks();
+        return 0;
+    }
+
+    std::vector<BenchmarkResult> results = runner.RunAll();
+    BenchmarkRunner::PrintResults(results);
+
+    if (!jsonPath.empty() && !BenchmarkRunner::WriteJson(jsonPath, results)) {
+        return 1;
+    }
+
+    if (!baselinePath.empty()) {
+        std::map<std::string, double> baseline;
+        if (!BenchmarkRunner::LoadBaseline(baselinePath, baseline)) {
+            // Sin línea base no hay con qué comparar: la puerta falla en vez de pasar en silencio
+            std::cerr << "Failed to load baseline: " << baselinePath
+                      << " (run 'make bench-baseline' to record one)" << std::endl;
+            return 1;
+        }
+
+        int regressions = BenchmarkRunner::CompareWithBaseline(results, baseline, thresholdPercent);
+        if (regressions > 0) {
+            std::cerr << regressions << " benchmark(s) regressed more than "
+                      << thresholdPercent << "%" << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+#ifndef ASSET_LOADER_HPP
+#define ASSET_LOADER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class ThreadPool;
+
+/**
+ * @brief Tipos de asset que se decodifican en segundo plano
+ */
+enum class AssetType {
+    IMAGE,
+    SOUND
+};
+
+/**
+ * @brief Asset decodificado en memoria de CPU, listo para subir
+ *
+ * Las imágenes quedan como sf::Image y los sonidos como muestras PCM;
+ * la creación de texturas y buffers de OpenAL ocurre después en el
+ * hilo principal (GameRenderer::FinishLoading, AudioManager::FinishLoading).
+ */
+struct DecodedAsset {
+    AssetType type;
+    std::string name;
+    std::string path;
+    bool isLoaded;
+
+    sf::Image image;                    // AssetType::IMAGE
+    sf::Vector2i targetSize;            // Tamaño con el que se dibuja; (0, 0) = original
+    std::vector<sf::Int16> samples;     // AssetType::SOUND
+    unsigned int channelCount;
+    unsigned int sampleRate;
+
+    DecodedAsset(AssetType t, const std::string& assetName, const std::string& assetPath)
+        : type(t), name(assetName), path(assetPath), isLoaded(false), channelCount(0), sampleRate(0) {}
+};
+
+/**
+ * @brief Decodifica imágenes y audio en paralelo sobre un ThreadPool
+ *
+ * Los componentes registran sus assets con AddImage/AddSound, Start lanza
+ * una tarea por asset y el hilo principal consulta GetProgress para dibujar
+ * la pantalla de carga mientras tanto.
+ */
+class AssetLoader {
+private:
+    std::vector<std::unique_ptr<DecodedAsset>> assets;  // Direcciones estables para los workers
+    std::atomic<size_t> completedCount;
+    std::mutex mutex;
+    std::condition_variable assetCompleted;
+    bool isDownscalingImages;
+
+public:
+    AssetLoader();
+    ~AssetLoader();
+
+    // Métodos de registro (verbos)
+    void AddImage(const std::string& name, const std::string& path, const sf::Vector2i& targetSize = sf::Vector2i());
+    void AddSound(const std::string& name, const std::string& path);
+
+    // Métodos de carga
+    void Start(ThreadPool& pool);
+    void LoadAll();
+    bool WaitFor(std::chrono::milliseconds timeout);
+
+    // Getters
+    bool IsFinished() const { return completedCount.load() == assets.size(); }
+    float GetProgress() const;
+    size_t GetCompletedCount() const { return completedCount.load(); }
+    size_t GetTotalCount() const { return assets.size(); }
+    const std::vector<std::unique_ptr<DecodedAsset>>& GetAssets() const { return assets; }
+
+    // Setters
+    void SetDownscaleImages(bool enabled) { isDownscalingImages = enabled; }   // Reducir a targetSize en el worker
+
+    // Métodos de decodificación
+    static bool DecodeImage(DecodedAsset& asset);
+    static bool DecodeSound(DecodedAsset& asset);
+    static void DownscaleImage(DecodedAsset& asset);
+
+private:
+    // Métodos privados auxiliares
+    void DecodeAsset(DecodedAsset& asset);
+};
+
+#endif // ASSET_LOADER_HPP
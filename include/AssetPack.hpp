@@ -0,0 +1,126 @@
+#ifndef ASSET_PACK_HPP
+#define ASSET_PACK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+struct RasterImage;
+
+/**
+ * @brief Tipos de entrada de un pack de assets
+ */
+enum class PackEntryType : std::uint32_t {
+    IMAGE_RGBA = 1,     // Píxeles RGBA de 8 bits, ya decodificados
+    SOUND_PCM16 = 2,    // Muestras de 16 bits intercaladas
+    RAW_FILE = 3        // Archivo original (música en streaming)
+};
+
+/**
+ * @brief Cabecera del pack (orden de bytes nativo)
+ */
+struct PackHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t entryCount;
+};
+
+/**
+ * @brief Entrada de la tabla de contenidos
+ * 
+ * Para IMAGE_RGBA, width/height son las dimensiones en píxeles; para
+ * SOUND_PCM16 son el número de canales y la frecuencia de muestreo.
+ */
+struct PackEntry {
+    char name[48];
+    std::uint32_t type;
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint32_t reserved;
+    std::uint64_t offset;       // Desde el inicio del archivo, alineado a PACK_ALIGNMENT
+    std::uint64_t size;         // Bytes
+};
+
+static_assert(sizeof(PackHeader) == 16, "PackHeader must be 16 bytes");
+static_assert(sizeof(PackEntry) == 80, "PackEntry must be 80 bytes");
+
+/**
+ * @brief Pack de assets pre-decodificados, mapeado en memoria
+ * 
+ * Formato: PackHeader, tabla de PackEntry y los datos de cada entrada
+ * alineados a 64 bytes. Los nombres llevan prefijo por tipo
+ * ("image/", "sound/", "music/"). En POSIX el archivo se mapea con
+ * mmap y las texturas se suben directamente desde el mapeo; en otras
+ * plataformas se lee completo a memoria.
+ */
+class AssetPack {
+public:
+    static constexpr const char* DEFAULT_PATH = "assets/assets.pak";
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr size_t PACK_ALIGNMENT = 64;
+    
+private:
+    const std::uint8_t* data;
+    size_t size;
+    bool isMapped;
+    std::vector<std::uint8_t> buffer;   // Solo sin mmap
+    std::map<std::string, const PackEntry*> entries;
+    
+public:
+    AssetPack();
+    ~AssetPack();
+    
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+    
+    // Métodos principales (verbos)
+    bool Open(const std::string& path);
+    void Close();
+    
+    // Métodos de consulta
+    const PackEntry* Find(const std::string& name) const;
+    const std::uint8_t* GetEntryData(const PackEntry& entry) const { return data + entry.offset; }
+    
+    // Getters
+    bool IsOpen() const { return data != nullptr; }
+    bool IsMemoryMapped() const { return isMapped; }
+    size_t GetSize() const { return size; }
+    size_t GetEntryCount() const { return entries.size(); }
+    
+private:
+    // Métodos privados auxiliares
+    bool ValidateAndIndex(const std::string& path);
+};
+
+/**
+ * @brief Construye un archivo de pack (herramienta SnakePack)
+ */
+class AssetPackBuilder {
+private:
+    struct PendingEntry {
+        PackEntry entry;
+        std::vector<std::uint8_t> bytes;
+    };
+    
+    std::vector<PendingEntry> pending;
+    
+public:
+    // Métodos de construcción (verbos)
+    bool AddImage(const std::string& name, const RasterImage& image);
+    bool AddSound(const std::string& name, const std::vector<std::int16_t>& samples,
+                  unsigned int channelCount, unsigned int sampleRate);
+    bool AddFile(const std::string& name, const std::string& path);
+    bool Write(const std::string& path) const;
+    
+    // Getters
+    size_t GetEntryCount() const { return pending.size(); }
+    
+private:
+    // Métodos privados auxiliares
+    bool AddEntry(const std::string& name, PackEntryType type, std::uint32_t width, std::uint32_t height,
+                  std::vector<std::uint8_t> bytes);
+};
+
+#endif // ASSET_PACK_HPP
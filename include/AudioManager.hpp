@@ -2,13 +2,53 @@
 #define AUDIO_MANAGER_HPP
 
 #include <SFML/Audio.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <string>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
 #include <SFML/Audio.hpp>
 #include <SFML/Network.hpp>
+#include "AudioMixer.hpp"
+#include "SpscRing.hpp"
+
+class AssetLoader;
+class AssetPack;
+
+/**
+ * @brief Tipos de petición de audio que el juego envía al hilo de audio
+ */
+enum class AudioCommandType : std::uint8_t {
+    PLAY_SOUND,
+    STOP_SOUND,
+    STOP_ALL_SOUNDS,
+    PLAY_MUSIC,
+    STOP_MUSIC,
+    PAUSE_MUSIC,
+    RESUME_MUSIC,
+    SET_MUSIC_VOLUME,
+    SET_SOUND_VOLUME
+};
+
+/**
+ * @brief Petición de audio de tamaño fijo (sin memoria dinámica)
+ */
+struct AudioCommand {
+    std::int64_t triggerTime;   // Ticks de steady_clock al pedir un efecto (0 = sin medir)
+    AudioCommandType type;
+    bool loop;
+    float value;                // Volumen, según el tipo
+    char name[26];              // Efecto o pista, terminado en '\0'
+};
 
 /**
  * @brief Clase encargada de la gestión de audio del juego
@@ -18,14 +58,26 @@
  */
 class AudioManager {
 private:
-    std::map<std::string, sf::SoundBuffer> soundBuffers;
-    std::map<std::string, sf::Sound> sounds;
+    std::unique_ptr<AudioMixer> mixer;              // Efectos de sonido (polifonía)
+    std::unique_ptr<MixerStream> mixerStream;       // Única fuente de OpenAL para los efectos
     std::map<std::string, sf::Music> musicTracks;
     sf::Music* currentMusic;
     bool isMusicEnabled;
     bool areSoundEffectsEnabled;
     float musicVolume;
     float soundVolume;
+    bool isLowLatency;                      // Bloques de mezcla cortos
+    std::string assetDirectory;             // Los sonidos están en <assetDirectory>/music
+    
+    // Hilo de audio: el hilo del juego solo encola comandos (productor único)
+    SpscRing<AudioCommand, 256> commands;
+    std::thread audioThread;
+    std::atomic<bool> isAudioThreadRunning;
+    std::mutex wakeMutex;
+    std::condition_variable wakeAudioThread;
+    std::atomic<bool> isAudioThreadWaiting;     // Solo se despierta si está dormido
+    std::atomic<bool> isMusicPlaying;       // Publicado por el hilo de audio
+    std::atomic<std::uint64_t> droppedCommands;
     
 public:
     AudioManager();
@@ -34,6 +86,11 @@ public:
     // Métodos de inicialización (verbos)
     bool Initialize();
     bool LoadAudioAssets();
+    void QueueAssets(AssetLoader& loader) const;
+    bool FinishLoading(const AssetLoader& loader);
+    bool LoadFromPack(const AssetPack& pack);
+    bool StartAudioThread();
+    void StopAudioThread();
     void Cleanup();
     
     // Métodos de música
@@ -50,6 +107,7 @@ public:
     // Métodos de carga
     bool LoadSoundEffect(const std::string& name, const std::string& filename);
     bool LoadMusic(const std::string& name, const std::string& filename);
+    bool LoadMusicFromMemory(const std::string& name, const void* data, size_t size);
     void UnloadSoundEffect(const std::string& soundName);
     void UnloadMusic(const std::string& musicName);
     
@@ -74,16 +132,29 @@ public:
     bool AreSoundEffectsEnabled() const { return areSoundEffectsEnabled; }
     float GetMusicVolume() const { return musicVolume; }
     float GetSoundVolume() const { return soundVolume; }
-    bool IsMusicPlaying() const;
+    bool IsMusicPlaying() const { return isMusicPlaying.load(std::memory_order_relaxed); }
+    bool IsAudioThreadRunning() const { return isAudioThreadRunning.load(); }
+    bool IsLowLatencyMode() const { return isLowLatency; }
+    sf::Time GetOutputLatency() const;
+    std::uint64_t GetDroppedCommandCount() const { return droppedCommands.load(); }
+    AudioMixer* GetMixer() const { return mixer.get(); }
+    std::vector<std::pair<std::string, std::string>> GetMusicFiles() const;
     
     // Setters
     void SetMusicEnabled(bool enabled) { isMusicEnabled = enabled; }
     void SetSoundEffectsEnabled(bool enabled) { areSoundEffectsEnabled = enabled; }
+    void SetLowLatencyMode(bool enabled);
+    void SetAssetDirectory(const std::string& directory) { assetDirectory = directory; }
     
 private:
     // Métodos privados auxiliares
     bool LoadGameSounds();
     bool LoadGameMusic();
+    void Post(AudioCommandType type, const std::string& name = "", float value = 0.0f, bool loop = false);
+    void Execute(const AudioCommand& command);
+    void RunAudioThread();
+    std::chrono::microseconds GetTimeUntilMusicEnds() const;     // 0 = esperar sin plazo
+    void CreateMixerStream();
     void ValidateVolume(float& volume);
     std::string GetFullAudioPath(const std::string& filename) const;
 };
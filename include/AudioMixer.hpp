@@ -0,0 +1,146 @@
+#ifndef AUDIO_MIXER_HPP
+#define AUDIO_MIXER_HPP
+
+#include <SFML/Audio.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Histogram.hpp"
+
+/**
+ * @brief Efecto de sonido pre-decodificado en el formato del mezclador
+ *
+ * Muestras float intercaladas en estéreo a OUTPUT_SAMPLE_RATE.
+ */
+struct AudioClip {
+    std::vector<float> samples;
+    size_t frameCount;
+
+    AudioClip() : frameCount(0) {}
+};
+
+/**
+ * @brief Mezclador por software con un número fijo de voces
+ *
+ * Cada PlayClip ocupa una voz libre (o roba la más antigua), de modo que
+ * un mismo efecto puede sonar varias veces a la vez. Mix suma las voces
+ * activas con su ganancia usando SSE/AVX y convierte a 16 bits con
+ * saturación; no depende de OpenAL, así que puede medirse por separado.
+ *
+ * Con el seguimiento de latencia activo, cada voz guarda el instante en
+ * que se pidió el efecto y Mix registra, al entregar su primer bloque,
+ * los microsegundos transcurridos en un Histogram.
+ */
+class AudioMixer {
+public:
+    static const unsigned int OUTPUT_CHANNELS = 2;
+    static const unsigned int OUTPUT_SAMPLE_RATE = 44100;
+    static const size_t MAX_VOICES = 16;
+
+    enum class SimdLevel {
+        SCALAR,
+        SSE2,
+        AVX2
+    };
+
+    using MixFunction = void (*)(float* output, const float* input, size_t sampleCount, float gain);
+    using ConvertFunction = void (*)(const float* input, std::int16_t* output, size_t sampleCount);
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+private:
+    struct Voice {
+        const AudioClip* clip;
+        size_t position;            // En frames
+        float gain;
+        std::uint64_t startOrder;   // Para robar la voz más antigua
+        TimePoint triggerTime;      // Momento de la petición (seguimiento de latencia)
+    };
+
+    std::map<std::string, AudioClip> clips;
+    std::array<Voice, MAX_VOICES> voices;
+    std::vector<float> accumulator;
+    std::uint64_t nextStartOrder;
+    float masterGain;
+    SimdLevel simdLevel;
+    MixFunction mixVoice;
+    ConvertFunction convertToInt16;
+    std::atomic<bool> isLatencyTracking;
+    Histogram triggerLatency;       // Petición -> primer bloque entregado, en µs
+    mutable std::mutex mutex;       // Mix corre en el hilo de audio
+
+public:
+    AudioMixer();
+    ~AudioMixer();
+
+    // Métodos de clips (verbos)
+    bool AddClip(const std::string& name, const std::int16_t* samples, size_t sampleCount,
+                 unsigned int channelCount, unsigned int sampleRate);
+    void RemoveClip(const std::string& name);
+    void RemoveAllClips();
+
+    // Métodos de reproducción
+    bool PlayClip(const std::string& name, float gain = 1.0f, TimePoint triggerTime = TimePoint());
+    void StopClip(const std::string& name);
+    void StopAll();
+
+    // Métodos de mezcla
+    void Mix(std::int16_t* output, size_t frameCount);
+    void Prewarm(size_t maxFrameCount);
+    static void MixVoiceScalar(float* output, const float* input, size_t sampleCount, float gain);
+    static void ConvertToInt16Scalar(const float* input, std::int16_t* output, size_t sampleCount);
+
+    // Getters
+    size_t GetActiveVoiceCount() const;
+    bool HasClip(const std::string& name) const { return clips.count(name) > 0; }
+    float GetMasterGain() const { return masterGain; }
+    SimdLevel GetSimdLevel() const { return simdLevel; }
+    static SimdLevel DetectSimdLevel();
+    bool IsLatencyTracking() const { return isLatencyTracking.load(std::memory_order_relaxed); }
+    Histogram GetTriggerLatency() const;
+
+    // Setters
+    void SetMasterGain(float gain);
+    void SetSimdLevel(SimdLevel level);
+    void SetLatencyTracking(bool enabled);
+    void ResetTriggerLatency();
+};
+
+/**
+ * @brief Fuente de OpenAL única que reproduce la salida de un AudioMixer
+ *
+ * sf::SoundStream mantiene QUEUED_BUFFERS bloques en cola, así que un
+ * efecto recién mezclado tarda hasta QUEUED_BUFFERS * bufferFrames en
+ * oírse. El modo de baja latencia usa bloques de LOW_LATENCY_BUFFER_FRAMES;
+ * no conviene bajar más porque SFML rellena la cola cada 10 ms y la cola
+ * entera debe durar más que eso.
+ */
+class MixerStream : public sf::SoundStream {
+public:
+    static const size_t BUFFER_FRAMES = 1024;
+    static const size_t LOW_LATENCY_BUFFER_FRAMES = 256;
+    static const size_t QUEUED_BUFFERS = 3;
+
+private:
+    AudioMixer& mixer;
+    std::vector<sf::Int16> buffer;
+    size_t bufferFrames;
+
+public:
+    explicit MixerStream(AudioMixer& audioMixer, size_t frames = BUFFER_FRAMES);
+    ~MixerStream();
+
+    // Getters
+    size_t GetBufferFrames() const { return bufferFrames; }
+    sf::Time GetQueuedLatency() const;
+
+protected:
+    bool onGetData(Chunk& data) override;
+    void onSeek(sf::Time timeOffset) override;
+};
+
+#endif // AUDIO_MIXER_HPP
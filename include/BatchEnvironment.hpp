@@ -0,0 +1,139 @@
+#ifndef BATCH_ENVIRONMENT_HPP
+#define BATCH_ENVIRONMENT_HPP
+
+#include "GameRules.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Muchas partidas independientes avanzando a la vez (entrenamiento)
+ *
+ * Las mismas reglas que GameSimulation, pero en estructura de arrays: las
+ * cabezas, direcciones y comidas de todas las partidas están contiguas y
+ * el kernel AVX2 avanza 8 partidas por iteración (movimiento, paredes,
+ * choque y comida). Comer, morir y colocar comida, que son raros, siguen
+ * un camino escalar.
+ *
+ * El cuerpo no se guarda como lista: cada celda del tablero guarda el paso
+ * de la cola en el que quedará libre, y una celda está ocupada si ese
+ * número es mayor que los pasos que lleva dados la cola. Así el choque es
+ * una lectura por partida y crecer no toca el tablero. Los contadores no
+ * vuelven a cero al reiniciar una partida: saltan por encima de todo lo
+ * escrito, y el tablero queda libre sin borrarlo.
+ *
+ * Una partida que termina se reinicia en el mismo Step; GetDones lo indica.
+ * Recompensas y finales se escriben en arrays propios o, con
+ * SetOutputBuffers, directamente en los de quien llama (sin copias).
+ * La comida usa su propio generador, así que con la misma semilla no sale
+ * la misma partida que en GameSimulation.
+ */
+class BatchEnvironment {
+public:
+    enum class SimdLevel {
+        SCALAR,
+        AVX2
+    };
+
+    static const int NO_ACTION = -1;                // Seguir en la dirección actual
+    static const int FOOD_SCORE = 10;               // Como Food::GetNutritionalValue
+    static const int INITIAL_LENGTH = 3;
+    static const std::uint32_t DEFAULT_MAX_EPISODE_TICKS = 10000;
+
+    // Observación: planos de gridHeight x gridWidth floats (0 o 1) por partida
+    enum ObservationPlane {
+        PLANE_BODY,                                 // Todas las celdas de la serpiente
+        PLANE_HEAD,
+        PLANE_FOOD,
+        PLANE_COUNT
+    };
+
+private:
+    int gridWidth;
+    int gridHeight;
+    int cellCount;
+    size_t gameCount;
+    GameRules rules;
+    std::uint32_t maxEpisodeTicks;                  // Corta partidas en bucle; 0 = sin límite
+    SimdLevel simdLevel;
+
+    // Estado por partida (un elemento por partida en cada array)
+    std::vector<std::int32_t> headX;
+    std::vector<std::int32_t> headY;
+    std::vector<std::int32_t> directions;           // Valores de Direction
+    std::vector<std::int32_t> foodX;
+    std::vector<std::int32_t> foodY;
+    std::vector<std::int32_t> pendingGrowth;
+    std::vector<std::int32_t> headSteps;            // Pasos dados por la cabeza
+    std::vector<std::int32_t> tailSteps;            // Pasos dados por la cola (no avanza al crecer)
+    std::vector<std::int32_t> episodeStarts;        // headSteps al empezar la partida actual
+    std::vector<std::int32_t> scores;
+    std::vector<std::uint64_t> randomStates;
+
+    // Paso de la cola que libera cada celda; cellCount celdas por partida
+    std::vector<std::int32_t> occupancy;
+
+    // Resultado del último Step: en los arrays propios o en los de quien llama
+    std::vector<float> rewards;                     // +1 al comer, -1 al morir
+    std::vector<std::uint8_t> dones;
+    float* rewardOutput;
+    std::uint8_t* doneOutput;
+
+    std::uint64_t totalSteps;
+    std::uint64_t finishedEpisodes;
+    std::uint64_t finishedScoreSum;
+
+public:
+    BatchEnvironment(size_t count, int width, int height, const GameRules& gameRules = GameRules());
+
+    BatchEnvironment(const BatchEnvironment&) = delete;
+    BatchEnvironment& operator=(const BatchEnvironment&) = delete;
+
+    // Métodos principales (verbos)
+    void Reset(std::uint64_t seed);
+    void Step(const std::int8_t* actions);          // Una acción por partida (o NO_ACTION); nullptr = ninguna
+    void EncodeObservations(float* observations) const;     // GetObservationSize() floats por partida
+
+    // Getters
+    size_t GetGameCount() const { return gameCount; }
+    int GetGridWidth() const { return gridWidth; }
+    int GetGridHeight() const { return gridHeight; }
+    const GameRules& GetRules() const { return rules; }
+    const std::vector<std::int32_t>& GetHeadX() const { return headX; }
+    const std::vector<std::int32_t>& GetHeadY() const { return headY; }
+    const std::vector<std::int32_t>& GetDirections() const { return directions; }
+    const std::vector<std::int32_t>& GetFoodX() const { return foodX; }
+    const std::vector<std::int32_t>& GetFoodY() const { return foodY; }
+    const std::vector<std::int32_t>& GetScores() const { return scores; }
+    const std::vector<std::int32_t>& GetTailSteps() const { return tailSteps; }
+    const std::int32_t* GetOccupancy(size_t game) const { return &occupancy[game * cellCount]; }   // > tailSteps = ocupada
+    const float* GetRewards() const { return rewardOutput; }
+    const std::uint8_t* GetDones() const { return doneOutput; }
+    size_t GetObservationSize() const { return static_cast<size_t>(PLANE_COUNT) * cellCount; }
+    int GetLength(size_t game) const { return INITIAL_LENGTH + headSteps[game] - tailSteps[game]; }
+    int GetEpisodeTicks(size_t game) const { return headSteps[game] - episodeStarts[game]; }
+    bool IsOccupied(size_t game, int x, int y) const;
+    std::uint64_t GetTotalSteps() const { return totalSteps; }
+    std::uint64_t GetFinishedEpisodes() const { return finishedEpisodes; }
+    double GetAverageFinishedScore() const;
+    SimdLevel GetSimdLevel() const { return simdLevel; }
+
+    // Setters
+    void SetMaxEpisodeTicks(std::uint32_t ticks) { maxEpisodeTicks = ticks; }
+    void SetOutputBuffers(float* rewardBuffer, std::uint8_t* doneBuffer);   // nullptr = arrays propios
+    void SetSimdLevel(SimdLevel level);
+
+    // Utilidades
+    static SimdLevel DetectSimdLevel();
+
+private:
+    // Métodos privados auxiliares
+    void StepScalar(const std::int8_t* actions, size_t begin, size_t end);
+    void StepAvx2(const std::int8_t* actions, size_t begin, size_t end);
+    void EatFood(size_t game);
+    void FinishEpisode(size_t game);
+    void ResetGame(size_t game);
+    bool PlaceFood(size_t game);
+    std::uint64_t NextRandom(size_t game);
+};
+
+#endif // BATCH_ENVIRONMENT_HPP
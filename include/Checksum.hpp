@@ -0,0 +1,20 @@
+#ifndef CHECKSUM_HPP
+#define CHECKSUM_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief CRC32C (Castagnoli) de los formatos binarios del proyecto
+ *
+ * Usa la instrucción crc32 de SSE4.2 si la CPU la tiene y una tabla si
+ * no; los dos caminos dan el mismo resultado. Se puede encadenar pasando
+ * el CRC anterior como valor inicial.
+ */
+class Checksum {
+public:
+    // Utilidades
+    static std::uint32_t Crc32c(const void* data, size_t size, std::uint32_t crc = 0);
+};
+
+#endif // CHECKSUM_HPP
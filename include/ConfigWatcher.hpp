@@ -0,0 +1,52 @@
+#ifndef CONFIG_WATCHER_HPP
+#define CONFIG_WATCHER_HPP
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+
+/**
+ * @brief Avisa cuando cambia el archivo de configuración
+ *
+ * En Linux usa inotify sobre el directorio del archivo (los editores
+ * suelen guardar escribiendo otro archivo y renombrándolo); en el resto
+ * de plataformas consulta la fecha de modificación cada POLL_INTERVAL.
+ * HasChanged nunca bloquea: Game la consulta entre ticks, en su hilo,
+ * sin hilos auxiliares ni locks.
+ */
+class ConfigWatcher {
+public:
+    static constexpr std::chrono::milliseconds POLL_INTERVAL{ 500 };
+
+private:
+    std::string path;
+    std::string fileName;
+    int inotifyFd;                          // -1 sin inotify
+    std::filesystem::file_time_type lastWriteTime;
+    std::chrono::steady_clock::time_point nextPollTime;
+    bool isWatching;
+
+public:
+    ConfigWatcher();
+    ~ConfigWatcher();
+
+    ConfigWatcher(const ConfigWatcher&) = delete;
+    ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+
+    // Métodos principales (verbos)
+    bool Start(const std::string& configPath);
+    void Stop();
+    bool HasChanged();
+
+    // Getters
+    bool IsWatching() const { return isWatching; }
+    bool IsUsingInotify() const { return inotifyFd >= 0; }
+    const std::string& GetPath() const { return path; }
+
+private:
+    // Métodos privados auxiliares
+    bool HasChangedInotify();
+    bool HasChangedPolling();
+};
+
+#endif // CONFIG_WATCHER_HPP
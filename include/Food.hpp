@@ -14,6 +14,8 @@ class GameRenderer; FOOD_HPP
 #define FOOD_HPP
 
 #include "Snake.hpp"
+#include <cstdint>
+#include <random>
 
 // Forward declaration
 class GameRenderer;
@@ -29,6 +31,7 @@ private:
     Position position;
     bool isActive;
     int nutritionalValue;
+    std::mt19937 randomEngine;  // Sembrable para partidas reproducibles
     
 public:
     Food();
@@ -38,6 +41,7 @@ public:
     void GenerateNewPosition(int gridWidth, int gridHeight, const Snake& snake);
     void Respawn(int gridWidth, int gridHeight, const Snake& snake);
     void Consume();
+    void Seed(std::uint32_t seed);
     
     // Métodos de renderizado
     void Render(GameRenderer* renderer);
@@ -11,12 +11,25 @@
 #include <SFML/Audio.hpp>
 #include <SFML/Network.hpp>
 
+#include "ConfigWatcher.hpp"
+#include "GameConfig.hpp"
+#include "GameRules.hpp"
+#include "Leaderboard.hpp"
+#include "Metrics.hpp"
+#include "Histogram.hpp"
+#include "Replay.hpp"
+#include "ScoreStore.hpp"
+#include "TickScheduler.hpp"
+
 // Forward declarations
-class Snake;
-class Food;
+class GameSimulation;
 class GameRenderer;
 class AudioManager;
 class InputHandler;
+class InputSource;
+class KeyboardInputSource;
+class AssetPack;
+class ThreadPool;
 
 // Incluir Direction desde Snake.hpp
 enum class Direction;
@@ -29,31 +42,41 @@ enum class Direction;
  */
 class Game {
 private:
-    static const int WINDOW_WIDTH = 1200;
-    static const int WINDOW_HEIGHT = 900;
-    static const int GRID_SIZE = 20;  // Aumentado de 15 a 20 píxeles para sprites más grandes
-    static const int GAME_AREA_MARGIN = 100;  // Reducido de 200 a 100 píxeles
-    static const int GAME_AREA_WIDTH = WINDOW_WIDTH - (2 * GAME_AREA_MARGIN);  // 1000 píxeles
-    static const int GAME_AREA_HEIGHT = WINDOW_HEIGHT - (2 * GAME_AREA_MARGIN); // 700 píxeles
-    static const int GRID_WIDTH = GAME_AREA_WIDTH / GRID_SIZE;   // 50 celdas
-    static const int GRID_HEIGHT = GAME_AREA_HEIGHT / GRID_SIZE; // 35 celdas
+    static const int FRAMES_PER_SECOND = 60;
     
+    GameConfig config;                      // Ventana y tablero fijos; el resto se recarga en caliente
+    ConfigWatcher configWatcher;
     sf::RenderWindow window;
     sf::Clock gameClock;
     bool isRunning;
     bool gameOver;
     bool gameStarted;
-    int score;
+    Replay replay;                          // Grabación de la partida en curso
+    GameRules nextRules;                    // Se aplican en BeginNewRound, nunca a mitad de partida
+    ScoreStore scoreStore;                  // Puntuaciones de todas las partidas (en disco)
+    Leaderboard leaderboard;                // Índice de puestos sobre scoreStore
+    std::uint64_t lastRank;                 // Puesto de la última partida; 0 = sin almacén
+    TickScheduler tickScheduler;            // Ritmo de Update (rampa y modos de velocidad)
+    std::unique_ptr<InputSource> inputSource;   // Giros aplicados, uno por tick
+    KeyboardInputSource* keyboardInput;     // inputSource si es el teclado; si no, nullptr
+    MetricsServer metricsServer;            // GET /metrics en localhost si config.metricsPort > 0
+    int metricsPortOverride;                // --metrics-port; -1 = el de la configuración
+    Histogram inputLatency;                 // Lectura de la tecla -> tick que la aplica, en µs
+    bool isAudioLatencyReport;              // Imprimir el histograma de latencia al salir
+    bool isInputLatencyReport;
+    
+    // Pack de assets mapeado; debe sobrevivir a la música que se lee desde él
+    std::unique_ptr<AssetPack> assetPack;
     
     // Componentes del juego (Composición)
-    std::unique_ptr<Snake> snake;           // 1..1
-    std::unique_ptr<Food> food;             // 1..1
+    std::unique_ptr<GameSimulation> simulation; // 1..1 (serpiente, comida y puntuación)
     std::unique_ptr<GameRenderer> renderer; // 1..1
     std::unique_ptr<AudioManager> audioManager; // 1..1
     std::unique_ptr<InputHandler> inputHandler; // 1..1
+    std::unique_ptr<ThreadPool> replayWriter;   // Un hilo: guarda las grabaciones en orden, fuera del bucle
     
 public:
-    Game();
+    explicit Game(const GameConfig& gameConfig = GameConfig());
     ~Game();
     
     // Métodos principales (verbos)
@@ -79,25 +102,55 @@ public:
     bool IsRunning() const { return isRunning; }
     bool IsGameOver() const { return gameOver; }
     bool IsGameStarted() const { return gameStarted; }
-    int GetScore() const { return score; }
-    int GetGridSize() const { return GRID_SIZE; }
-    int GetGridWidth() const { return GRID_WIDTH; }
-    int GetGridHeight() const { return GRID_HEIGHT; }
+    int GetScore() const;
+    int GetGridSize() const { return config.cellSize; }
+    int GetGridWidth() const { return config.GetGridWidth(); }
+    int GetGridHeight() const { return config.GetGridHeight(); }
+    const GameConfig& GetConfig() const { return config; }
     
     // Setters
     void SetGameOver(bool value) { gameOver = value; }
     void SetGameStarted(bool value) { gameStarted = value; }
     void SetRunning(bool value) { isRunning = value; }
+    void SetTextureMemoryBudget(size_t bytes);
+    void SetLowLatencyAudio(bool enabled);
+    void SetAudioLatencyReport(bool enabled);
+    void SetInputLatencyReport(bool enabled) { isInputLatencyReport = enabled; }
+    void SetInputSource(std::unique_ptr<InputSource> source);
+    void SetRules(const GameRules& rules);
+    void SetTickMode(TickMode mode) { tickScheduler.SetMode(mode); }
+    void SetMetricsPort(int port);          // Antes de Initialize; gana a snake.cfg también al recargar
+    void CycleTickMode();
+    bool WatchConfigFile(const std::string& path) { return configWatcher.Start(path); }
     
     // Métodos de control de la serpiente
     void ChangeSnakeDirection(Direction direction);
     
     // Acceso a componentes
+    GameSimulation* GetSimulation() const { return simulation.get(); }
     GameRenderer* GetRenderer() const { return renderer.get(); }
     AudioManager* GetAudioManager() const { return audioManager.get(); }
     sf::RenderWindow& GetWindow() { return window; }
     const sf::RenderWindow& GetWindow() const { return window; }
     sf::RenderWindow* GetWindowPtr() { return &window; }
+    const Replay& GetReplay() const { return replay; }
+    const ScoreStore& GetScoreStore() const { return scoreStore; }
+    const Leaderboard& GetLeaderboard() const { return leaderboard; }
+    const Histogram& GetInputLatency() const { return inputLatency; }
+    InputSource* GetInputSource() const { return inputSource.get(); }
+    const TickScheduler& GetTickScheduler() const { return tickScheduler; }
+    
+private:
+    // Métodos privados auxiliares
+    void BeginNewRound();
+    void ApplyInput();
+    bool LoadAssetsWithProgress();
+    void ApplyLiveSettings();
+    void ReloadConfig();
+    void ReloadAssets();
+    void StartMetricsServer();
+    void PrintAudioLatencyReport() const;
+    void PrintInputLatencyReport() const;
 };
 
 #endif // GAME_HPP
\ No newline at end of file
@@ -0,0 +1,80 @@
+#ifndef GAME_CONFIG_HPP
+#define GAME_CONFIG_HPP
+
+#include <SFML/Window.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Orden que dispara una tecla configurable
+ */
+enum class KeyCommand : std::uint8_t {
+    UP,
+    DOWN,
+    LEFT,
+    RIGHT,
+    START,
+    PAUSE,
+    TICK_MODE,
+    QUIT
+};
+
+/**
+ * @brief Tecla asignada a una orden en el archivo de configuración
+ */
+struct KeyBindingConfig {
+    sf::Keyboard::Key key;
+    KeyCommand command;
+};
+
+/**
+ * @brief Configuración del juego leída de un archivo de texto
+ *
+ * Estructura plana: se lee una vez al arrancar y Game la vuelve a leer
+ * entera cuando ConfigWatcher avisa de un cambio. Ventana y tablero solo
+ * se aplican al arrancar; ritmo, volúmenes, teclas y assets, en caliente.
+ *
+ * Formato: secciones como "[audio]" y líneas "clave = valor"; "#" comenta.
+ */
+struct GameConfig {
+    static constexpr const char* DEFAULT_PATH = "snake.cfg";
+
+    // Ventana y tablero (solo al arrancar)
+    int windowWidth;
+    int windowHeight;
+    int cellSize;                   // Píxeles por celda
+    int gameAreaMargin;             // Píxeles entre el borde de la ventana y el tablero
+
+    // Ritmo de los ticks
+    int tickIntervalMs;             // Intervalo con puntuación 0
+    int tickRampStepUs;             // Se resta por cada punto
+    int minTickIntervalMs;
+
+    // Audio (0-100)
+    float musicVolume;
+    float soundVolume;
+
+    // Assets
+    std::string assetDirectory;     // Raíz de images/, music/ y fonts/
+    std::string assetPackPath;      // Pack de make pack; vacío = archivos sueltos
+
+    int metricsPort;                // Endpoint Prometheus en localhost; 0 = apagado
+
+    std::vector<KeyBindingConfig> keyBindings;
+
+    GameConfig();
+
+    // Métodos principales (verbos)
+    static bool LoadFromFile(const std::string& path, GameConfig& config);
+    static bool ParseKey(const std::string& name, sf::Keyboard::Key& key);
+    static std::vector<KeyBindingConfig> GetDefaultKeyBindings();
+
+    // Getters
+    int GetGridWidth() const { return (windowWidth - 2 * gameAreaMargin) / cellSize; }
+    int GetGridHeight() const { return (windowHeight - 2 * gameAreaMargin) / cellSize; }
+    bool HasSameLayout(const GameConfig& other) const;
+    bool HasSameAssets(const GameConfig& other) const;
+};
+
+#endif // GAME_CONFIG_HPP
@@ -2,8 +2,13 @@
 #define GAME_RENDERER_HPP
 
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 #include <string>
 #include <map>
+#include <vector>
+#include <memory>
+#include "SoftwareRasterizer.hpp"
+#include "TextureCache.hpp"
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
@@ -13,6 +18,16 @@
 // Forward declarations
 class Snake;
 class Food;
+class AssetLoader;
+class AssetPack;
+
+/**
+ * @brief Comando de dibujo de un sprite en una posición de pantalla
+ */
+struct SpriteCommand {
+    std::string spriteName;
+    sf::Vector2f position;
+};
 
 /**
  * @brief Clase responsable de todo el renderizado del juego
@@ -25,8 +40,19 @@ private:
     sf::RenderWindow* window;
     std::map<std::string, sf::Texture> textures;
     std::map<std::string, sf::Sprite> sprites;
+    TextureCache textureCache;              // Texturas de los assets, cargadas bajo demanda
     sf::Font font;
     int gridSize;
+    int viewWidth;                          // Resolución lógica de la ventana
+    int viewHeight;
+    float gameAreaMargin;
+    std::string assetDirectory;
+    std::vector<SpriteCommand> snakeBatch;  // Reutilizado entre frames
+    
+    // Backend por software (modo sin ventana)
+    std::unique_ptr<SoftwareRasterizer> rasterizer;
+    std::map<std::string, std::shared_ptr<const RasterImage>> images;    // Originales, compartibles entre renderers
+    std::map<std::string, std::vector<RasterImage>> scaledImages;  // Versiones escaladas por nombre
     
 public:
     GameRenderer();
@@ -34,7 +60,11 @@ public:
     
     // Métodos de inicialización (verbos)
     bool Initialize(sf::RenderWindow* renderWindow);
+    bool InitializeHeadless(int width, int height);
     bool LoadAssets();
+    void QueueAssets(AssetLoader& loader) const;
+    bool FinishLoading(const AssetLoader& loader);
+    bool LoadFromPack(const AssetPack& pack);
     void Cleanup();
     
     // Métodos de renderizado
@@ -45,15 +75,25 @@ public:
     void RenderFood(const Food& food);
     void RenderScore(int score);
     void RenderStartScreen();
-    void RenderGameOverScreen();
+    void RenderGameOverScreen(std::uint64_t rank = 0, std::uint64_t total = 0);  // rank 0 = sin tabla
     void RenderPauseScreen();
+    void RenderLoadingScreen(float progress);
     void RenderGameBounds();  // Renderizar límites del área de juego
+    void RenderPlayfield(const Snake& snake, const Food& food, int score);
+    
+    // Construcción de lotes (no requiere ventana)
+    void BuildSnakeBatch(const Snake& snake, std::vector<SpriteCommand>& batch) const;
     
     // Métodos de texturas y sprites
     bool LoadTexture(const std::string& name, const std::string& path);
     sf::Texture* GetTexture(const std::string& name);
     sf::Sprite* GetSprite(const std::string& name);
     void CreateSprite(const std::string& name, const std::string& textureName);
+    void AddImage(const std::string& name, RasterImage image);
+    void ShareImages(const GameRenderer& source);   // Mismas imágenes sin copiarlas ni decodificarlas
+    
+    // Métodos de captura (modo sin ventana)
+    bool CaptureFrame(const std::string& path) const;
     
     // Métodos de utilidad
     void RenderSprite(const std::string& spriteName, float x, float y);
@@ -65,25 +105,33 @@ public:
     sf::RenderWindow* GetWindow() const { return window; }
     int GetGridSize() const { return gridSize; }
     const sf::Font& GetFont() const { return font; }
+    bool IsHeadless() const { return rasterizer != nullptr; }
+    sf::Vector2i GetImageDrawSize(const std::string& name) const;
+    const TextureCacheStats& GetTextureStats() const { return textureCache.GetStats(); }
+    SoftwareRasterizer* GetRasterizer() { return rasterizer.get(); }
+    const SoftwareRasterizer* GetRasterizer() const { return rasterizer.get(); }
     
     // Métodos para obtener dimensiones del área de juego
-    float GetGameAreaMargin() const { return 100.0f; }  // Reducido de 200 a 100 píxeles
-    float GetGameAreaWidth() const { return 1200.0f - (2 * GetGameAreaMargin()); }  // 1000 píxeles
-    float GetGameAreaHeight() const { return 900.0f - (2 * GetGameAreaMargin()); }  // 700 píxeles
+    float GetGameAreaMargin() const { return gameAreaMargin; }
+    float GetGameAreaWidth() const { return viewWidth - (2 * GetGameAreaMargin()); }
+    float GetGameAreaHeight() const { return viewHeight - (2 * GetGameAreaMargin()); }
     int GetGameGridWidth() const { return static_cast<int>(GetGameAreaWidth() / gridSize); }
     int GetGameGridHeight() const { return static_cast<int>(GetGameAreaHeight() / gridSize); }
     
     // Setters
     void SetGridSize(int size) { gridSize = size; }
+    void SetTextureMemoryBudget(size_t bytes) { textureCache.SetMemoryBudget(bytes); }
+    void SetAssetDirectory(const std::string& directory);
+    void SetLayout(int width, int height, int margin);
     
 private:
     // Métodos privados auxiliares
-    bool LoadSnakeTextures();
-    bool LoadUITextures();
-    bool LoadNumberTextures();
     void RenderDigit(int digit, float x, float y);
     sf::Vector2f CalculateGridPosition(int gridX, int gridY) const;
     sf::FloatRect CalculateGridRect(int gridX, int gridY) const;
+    bool RasterizeImage(const std::string& name, float x, float y, int width, int height);
+    void RegisterTextures();
+    std::string GetAssetPath(const std::string& relativePath) const;
 };
 
 #endif // GAME_RENDERER_HPP
\ No newline at end of file
@@ -0,0 +1,72 @@
+#ifndef GAME_RULES_HPP
+#define GAME_RULES_HPP
+
+#include "Snake.hpp"
+#include <string>
+
+/**
+ * @brief Variante de reglas elegida en tiempo de ejecución
+ *
+ * GameSimulation::SetRules la traduce una sola vez a la especialización
+ * de plantilla correspondiente; el tick no vuelve a consultarla.
+ */
+struct GameRules {
+    static const int MULTI_CELL_GROWTH = 3;     // Celdas por comida con multiCellGrowth
+
+    bool wrapWalls;         // Los bordes conectan con el lado opuesto
+    bool selfCollision;     // Chocar consigo misma termina la partida
+    bool multiCellGrowth;   // Crecer MULTI_CELL_GROWTH celdas por comida
+
+    GameRules() : wrapWalls(false), selfCollision(true), multiCellGrowth(false) {}
+
+    bool operator==(const GameRules& other) const {
+        return wrapWalls == other.wrapWalls && selfCollision == other.selfCollision &&
+               multiCellGrowth == other.multiCellGrowth;
+    }
+    bool operator!=(const GameRules& other) const { return !(*this == other); }
+
+    // Formato de texto: "classic" o una lista como "wrap,no-self,multi-grow"
+    std::string ToString() const;
+    static bool FromString(const std::string& text, GameRules& rules);
+};
+
+namespace RulePolicy {
+
+/**
+ * @brief Paredes sólidas: salir de la grilla termina la partida
+ */
+struct SolidWalls {
+    static bool HitsWall(Snake& snake, int gridWidth, int gridHeight) {
+        return snake.CheckWallCollision(gridWidth, gridHeight);
+    }
+};
+
+/**
+ * @brief Bordes con vuelta: nunca hay choque con la pared
+ */
+struct WrapWalls {
+    static bool HitsWall(Snake& snake, int gridWidth, int gridHeight) {
+        snake.WrapHead(gridWidth, gridHeight);
+        return false;
+    }
+};
+
+struct SelfCollision {
+    static bool HitsSelf(const Snake& snake) { return snake.CheckSelfCollision(); }
+};
+
+/**
+ * @brief Modo práctica: la serpiente puede atravesarse
+ */
+struct NoSelfCollision {
+    static bool HitsSelf(const Snake&) { return false; }
+};
+
+template <int Cells>
+struct GrowBy {
+    static const int CELLS = Cells;
+};
+
+} // namespace RulePolicy
+
+#endif // GAME_RULES_HPP
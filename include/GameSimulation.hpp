@@ -0,0 +1,93 @@
+#ifndef GAME_SIMULATION_HPP
+#define GAME_SIMULATION_HPP
+
+#include "Snake.hpp"
+#include "Food.hpp"
+#include "GameRules.hpp"
+#include "ZobristHash.hpp"
+#include <cstdint>
+
+/**
+ * @brief Resultado de avanzar la simulación un tick
+ */
+enum class TickResult {
+    NONE,
+    ATE_FOOD,
+    HIT_WALL,
+    HIT_SELF,
+    BOARD_FILLED        // Comió y no queda celda libre: la partida termina ganada
+};
+
+/**
+ * @brief Reglas del juego sin ventana, audio ni entrada
+ * 
+ * Contiene la serpiente, la comida y la puntuación, y aplica las reglas
+ * de un tick (movimiento, colisiones y comida). Game la usa para el juego
+ * interactivo; las herramientas sin ventana (replays, exportación) la usan
+ * directamente. Con la misma semilla y las mismas entradas produce
+ * exactamente la misma partida.
+ * 
+ * Las variantes de reglas (paredes, choque consigo misma, crecimiento)
+ * son políticas de plantilla: SetRules elige una vez la especialización
+ * de TickWithRules y Tick la llama sin comprobar reglas en cada tick.
+ */
+class GameSimulation {
+public:
+    using TickFunction = TickResult (*)(GameSimulation& simulation);
+    
+private:
+    int gridWidth;
+    int gridHeight;
+    Snake snake;            // 1..1
+    Food food;              // 1..1
+    int score;
+    bool gameOver;
+    std::uint64_t tickCount;
+    std::uint32_t seed;
+    GameRules rules;
+    TickFunction tickFunction;  // Especialización para las reglas actuales
+    
+public:
+    GameSimulation(int width, int height);
+    ~GameSimulation();
+    
+    // Métodos principales (verbos)
+    void Reset(std::uint32_t newSeed);
+    TickResult Tick() { return tickFunction(*this); }
+    void SetRules(const GameRules& newRules);
+    void ChangeDirection(Direction direction);
+    
+    // Métodos de puntuación
+    void AddScore(int points) { score += points; }
+    void ResetScore() { score = 0; }
+    
+    // Getters
+    const Snake& GetSnake() const { return snake; }
+    const Food& GetFood() const { return food; }
+    int GetScore() const { return score; }
+    bool IsGameOver() const { return gameOver; }
+    std::uint64_t GetTickCount() const { return tickCount; }
+    std::uint32_t GetSeed() const { return seed; }
+    int GetGridWidth() const { return gridWidth; }
+    int GetGridHeight() const { return gridHeight; }
+    const GameRules& GetRules() const { return rules; }
+    std::uint64_t GetStateHash() const {    // Zobrist de serpiente y comida; 0 sin SetZobristHash
+        const ZobristHash* keys = snake.GetZobristHash();
+        return keys ? snake.GetHash() ^ keys->GetFoodKey(food.GetPosition()) : 0;
+    }
+    
+    // Setters
+    void SetZobristHash(const ZobristHash* keys) { snake.SetZobristHash(keys); }   // Se conserva al reiniciar
+    
+    // Métodos de utilidad
+    static std::uint32_t GenerateSeed();
+    static TickFunction SelectTickFunction(const GameRules& rules);
+    
+private:
+    // Métodos privados auxiliares
+    bool HasFreeCell() const;
+    template <typename WallPolicy, typename CollisionPolicy, typename GrowthPolicy>
+    static TickResult TickWithRules(GameSimulation& simulation);
+};
+
+#endif // GAME_SIMULATION_HPP
@@ -0,0 +1,54 @@
+#ifndef HISTOGRAM_HPP
+#define HISTOGRAM_HPP
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+/**
+ * @brief Histograma de latencias con cubetas log-lineales de tamaño fijo
+ *
+ * Los valores menores que 32 tienen cubeta propia; a partir de ahí cada
+ * potencia de dos se divide en 16 cubetas, de modo que el error relativo
+ * de un percentil es como mucho 1/16. Registrar un valor no reserva
+ * memoria, así que puede usarse desde el hilo de audio. No es seguro
+ * entre hilos: quien lo comparta debe protegerlo.
+ */
+class Histogram {
+public:
+    static const unsigned int SUB_BUCKET_BITS = 4;
+    static const unsigned int SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;
+    static const size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+private:
+    std::array<std::uint64_t, BUCKET_COUNT> buckets;
+    std::uint64_t count;
+    std::uint64_t sum;
+    std::uint64_t minValue;
+    std::uint64_t maxValue;
+
+public:
+    Histogram();
+
+    // Métodos principales (verbos)
+    void Record(std::uint64_t value);
+    void Merge(const Histogram& other);
+    void Clear();
+    void Print(std::ostream& stream, const std::string& unit) const;
+
+    // Getters
+    std::uint64_t GetCount() const { return count; }
+    std::uint64_t GetMin() const { return count ? minValue : 0; }
+    std::uint64_t GetMax() const { return maxValue; }
+    double GetMean() const { return count ? static_cast<double>(sum) / count : 0.0; }
+    std::uint64_t GetPercentile(double percentile) const;
+
+private:
+    // Métodos privados auxiliares
+    static size_t GetBucketIndex(std::uint64_t value);
+    static std::uint64_t GetBucketLowerBound(size_t index);
+    static std::uint64_t GetBucketUpperBound(size_t index);
+};
+
+#endif // HISTOGRAM_HPP
@@ -2,8 +2,10 @@
 #define INPUT_HANDLER_HPP
 
 #include <SFML/Graphics.hpp>
-#include <map>
-#include <functional>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include "GameConfig.hpp"
 #include "Snake.hpp"
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
@@ -35,17 +37,45 @@ struct InputEvent {
         : type(t), key(k), isPressed(pressed) {}
 };
 
+/**
+ * @brief Acción asociada a una tecla: puntero a función, sin capturas ni memoria dinámica
+ */
+using KeyActionFunction = void (*)(Game* game);
+
+/**
+ * @brief Qué hace una tecla al pulsarse
+ */
+enum class KeyBindingType : std::uint8_t {
+    NONE,
+    DIRECTION,
+    ACTION
+};
+
+/**
+ * @brief Entrada de la tabla de teclas
+ */
+struct KeyBinding {
+    KeyBindingType type;
+    Direction direction;
+    KeyActionFunction action;
+    
+    KeyBinding() : type(KeyBindingType::NONE), direction(Direction::UP), action(nullptr) {}
+};
+
 /**
  * @brief Clase encargada del manejo de entrada del usuario
  * 
  * Procesa eventos del teclado y los traduce a acciones del juego.
  * Maneja configuraciones de teclas y estado de entrada.
+ * 
+ * Las asignaciones viven en una tabla indexada por sf::Keyboard::Key y
+ * el estado de las teclas en un bitset: despachar una pulsación es un
+ * acceso indexado y IsAnyKeyPressed recorre unas pocas palabras.
  */
 class InputHandler {
 private:
-    std::map<sf::Keyboard::Key, Direction> keyToDirectionMap;
-    std::map<sf::Keyboard::Key, std::function<void()>> keyActionMap;
-    std::map<sf::Keyboard::Key, bool> keyState;
+    std::array<KeyBinding, sf::Keyboard::KeyCount> keyBindings;
+    std::bitset<sf::Keyboard::KeyCount> keyState;
     Game* gameInstance;
     bool isEnabled;
     
@@ -56,6 +86,7 @@ public:
     // Métodos de inicialización (verbos)
     void Initialize(Game* game);
     void ConfigureDefaultKeys();
+    void ApplyKeyBindings(const std::vector<KeyBindingConfig>& bindings);
     void Cleanup();
     
     // Métodos de procesamiento de eventos
@@ -67,7 +98,7 @@ public:
     
     // Métodos de configuración de teclas
     void MapKeyToDirection(sf::Keyboard::Key key, Direction direction);
-    void MapKeyToAction(sf::Keyboard::Key key, std::function<void()> action);
+    void MapKeyToAction(sf::Keyboard::Key key, KeyActionFunction action);
     void RemoveKeyMapping(sf::Keyboard::Key key);
     void ResetKeyMappings();
     
@@ -86,7 +117,7 @@ public:
     // Getters
     bool IsEnabled() const { return isEnabled; }
     Direction GetDirectionFromKey(sf::Keyboard::Key key) const;
-    const std::map<sf::Keyboard::Key, Direction>& GetKeyDirectionMap() const { return keyToDirectionMap; }
+    const KeyBinding& GetKeyBinding(sf::Keyboard::Key key) const;
     
     // Setters
     void SetGameInstance(Game* game) { gameInstance = game; }
@@ -100,6 +131,7 @@ private:
     bool IsActionKey(sf::Keyboard::Key key) const;
     void HandleDirectionInput(sf::Keyboard::Key key);
     void HandleActionInput(sf::Keyboard::Key key);
+    static bool IsKeyInRange(sf::Keyboard::Key key) { return key >= 0 && key < sf::Keyboard::KeyCount; }
 };
 
 #endif // INPUT_HANDLER_HPP
\ No newline at end of file
@@ -0,0 +1,57 @@
+#ifndef INPUT_QUEUE_HPP
+#define INPUT_QUEUE_HPP
+
+#include "Snake.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Giro pedido por el jugador con el instante en que se leyó
+ */
+struct DirectionInput {
+    Direction direction;
+    std::chrono::steady_clock::time_point timestamp;
+};
+
+/**
+ * @brief Cola acotada de giros pendientes; se consume uno por tick
+ *
+ * Snake solo guarda un giro por tick, así que dos teclas rápidas dentro
+ * del mismo tick (arriba y luego izquierda) perdían la primera. Aquí se
+ * guardan en orden y Pop entrega el primero que sea válido respecto a la
+ * dirección actual: los repetidos y los giros de 180 grados se descartan
+ * al consumirlos, no al recibirlos, porque su validez depende de los
+ * giros anteriores.
+ */
+class InputQueue {
+public:
+    static const size_t CAPACITY = 4;
+
+private:
+    std::array<DirectionInput, CAPACITY> inputs;
+    size_t head;
+    size_t count;
+    std::uint64_t droppedInputs;    // Cola llena
+    std::uint64_t discardedInputs;  // Repetidos o giros inversos
+
+public:
+    InputQueue();
+
+    // Métodos principales (verbos)
+    bool Push(Direction direction, std::chrono::steady_clock::time_point timestamp);
+    bool Pop(Direction currentDirection, DirectionInput& input);
+    void Clear();
+
+    // Getters
+    size_t GetSize() const { return count; }
+    bool IsEmpty() const { return count == 0; }
+    std::uint64_t GetDroppedCount() const { return droppedInputs; }
+    std::uint64_t GetDiscardedCount() const { return discardedInputs; }
+
+private:
+    // Métodos privados auxiliares
+    static bool IsTurn(Direction newDirection, Direction currentDirection);
+};
+
+#endif // INPUT_QUEUE_HPP
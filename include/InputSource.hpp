@@ -0,0 +1,164 @@
+#ifndef INPUT_SOURCE_HPP
+#define INPUT_SOURCE_HPP
+
+#include "InputQueue.hpp"
+#include "Replay.hpp"
+#include "Snake.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class GameSimulation;
+class ObservationEncoder;
+class PolicyNetwork;
+struct PolicyWorkspace;
+
+/**
+ * @brief Origen de los giros que Game aplica antes de cada tick
+ *
+ * Game pide como mucho un giro por tick con NextDirection, venga del
+ * teclado, de un guion, de una grabación o de un bot. Apply es el mismo
+ * paso que usa Game::Update, así que las herramientas sin ventana
+ * recorren exactamente el camino de producción.
+ */
+class InputSource {
+public:
+    virtual ~InputSource() {}
+
+    // Métodos principales (verbos)
+    virtual bool NextDirection(const GameSimulation& simulation, DirectionInput& input) = 0;
+    virtual void Reset() {}
+    bool Apply(GameSimulation& simulation, DirectionInput& input);
+
+    // Getters
+    virtual bool IsFinished() const { return false; }
+};
+
+/**
+ * @brief Teclado: InputHandler encola los giros y se consume uno por tick
+ */
+class KeyboardInputSource : public InputSource {
+private:
+    InputQueue queue;
+
+public:
+    // Métodos principales (verbos)
+    bool Push(Direction direction, std::chrono::steady_clock::time_point timestamp);
+    bool NextDirection(const GameSimulation& simulation, DirectionInput& input) override;
+    void Reset() override { queue.Clear(); }
+
+    // Getters
+    const InputQueue& GetQueue() const { return queue; }
+};
+
+/**
+ * @brief Guion de giros por tick, cargado de un archivo o generado
+ *
+ * Formato de texto: una línea "<tick> <U|D|L|R>" por giro, en orden de
+ * tick; las líneas vacías y las que empiezan por '#' se ignoran.
+ */
+class ScriptedInputSource : public InputSource {
+private:
+    std::vector<ReplayEvent> inputs;
+    size_t cursor;
+
+public:
+    ScriptedInputSource();
+
+    // Métodos principales (verbos)
+    bool LoadFromFile(const std::string& path);
+    void AddInput(std::uint64_t tick, Direction direction);
+    bool NextDirection(const GameSimulation& simulation, DirectionInput& input) override;
+    void Reset() override { cursor = 0; }
+
+    // Getters
+    bool IsFinished() const override { return cursor >= inputs.size(); }
+    size_t GetInputCount() const { return inputs.size(); }
+};
+
+/**
+ * @brief Reproduce las entradas de una grabación
+ *
+ * La simulación debe empezar con la semilla de la grabación. Si un tick
+ * tiene varias entradas (grabaciones antiguas) gana la última válida,
+ * igual que con Replay::ApplyPendingEvents.
+ */
+class ReplayInputSource : public InputSource {
+private:
+    const Replay& replay;
+    size_t cursor;
+
+public:
+    explicit ReplayInputSource(const Replay& source);
+
+    // Métodos principales (verbos)
+    bool NextDirection(const GameSimulation& simulation, DirectionInput& input) override;
+    void Reset() override { cursor = 0; }
+
+    // Getters
+    bool IsFinished() const override;
+};
+
+/**
+ * @brief Bot voraz: se acerca a la comida evitando morir en el siguiente tick
+ */
+class BotInputSource : public InputSource {
+public:
+    // Métodos principales (verbos)
+    bool NextDirection(const GameSimulation& simulation, DirectionInput& input) override;
+
+private:
+    // Métodos privados auxiliares
+    static bool IsSafe(const GameSimulation& simulation, const Position& position);
+};
+
+/**
+ * @brief Giros aleatorios reproducibles, para pruebas de carga
+ */
+class RandomInputSource : public InputSource {
+private:
+    std::uint64_t seed;
+    std::uint64_t state;
+    int turnsPerHundredTicks;
+
+public:
+    explicit RandomInputSource(std::uint64_t randomSeed, int turnRate = 100);
+
+    // Métodos principales (verbos)
+    bool NextDirection(const GameSimulation& simulation, DirectionInput& input) override;
+    void Reset() override { state = seed; }
+
+private:
+    // Métodos privados auxiliares
+    std::uint64_t NextRandom();
+};
+
+/**
+ * @brief Política neuronal: PolicyNetwork elige la dirección cada tick
+ *
+ * La entrada es la vista egocéntrica de ObservationEncoder (radio según
+ * la anchura de entrada de la red). La red se comparte entre fuentes y
+ * hilos; los buffers son de cada fuente, así que decidir no reserva
+ * memoria. Cada decisión se registra en la métrica POLICY_TIME.
+ */
+class PolicyInputSource : public InputSource {
+private:
+    std::shared_ptr<const PolicyNetwork> network;
+    std::unique_ptr<ObservationEncoder> encoder;    // Se rehace si cambian tablero o reglas
+    std::unique_ptr<PolicyWorkspace> workspace;
+    std::vector<std::uint8_t> observation;
+    std::vector<float> networkInput;
+
+public:
+    explicit PolicyInputSource(std::shared_ptr<const PolicyNetwork> policy);
+    ~PolicyInputSource() override;
+
+    // Métodos principales (verbos)
+    bool NextDirection(const GameSimulation& simulation, DirectionInput& input) override;
+
+    // Utilidades
+    static bool IsCompatible(const PolicyNetwork& policy);     // Entrada de PLANE_COUNT planos cuadrados e impares
+};
+
+#endif // INPUT_SOURCE_HPP
@@ -0,0 +1,51 @@
+#ifndef LEADERBOARD_HPP
+#define LEADERBOARD_HPP
+
+#include "ScoreStore.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Índice de estadísticas de orden sobre las puntuaciones guardadas
+ *
+ * Árbol de Fenwick con un contador por valor de puntuación (el rango de
+ * puntuaciones posibles es pequeño: celdas del tablero por puntos por
+ * comida). Insertar, el puesto de una puntuación y la k-ésima mejor son
+ * O(log S), con S el mayor valor visto, sin importar cuántas partidas haya.
+ * La capacidad crece en potencias de dos.
+ */
+class Leaderboard {
+private:
+    std::vector<std::uint64_t> tree;        // 1-based; tree[i] cubre (i - lowbit(i), i]
+    std::vector<std::uint32_t> counts;      // Partidas por puntuación
+    std::uint64_t totalCount;
+    int bestScore;
+
+public:
+    Leaderboard();
+
+    // Métodos principales (verbos)
+    void Build(const std::vector<ScoreRecord>& records);
+    void Insert(int score);
+    void Clear();
+
+    // Consultas
+    std::uint64_t GetRank(int score) const;             // 1 + partidas con más puntos
+    std::uint64_t CountAbove(int score) const;
+    int GetScoreAtRank(std::uint64_t rank) const;       // rank 1 = la mejor
+    void GetTopScores(size_t count, std::vector<int>& scores) const;
+
+    // Getters
+    std::uint64_t GetCount() const { return totalCount; }
+    int GetBestScore() const { return bestScore; }
+    size_t GetCapacity() const { return counts.size(); }
+
+private:
+    // Métodos privados auxiliares
+    void Reserve(int score);
+    void RebuildTree();
+    std::uint64_t CountAtMost(int score) const;
+    static int ClampScore(int score) { return score < 0 ? 0 : score; }
+};
+
+#endif // LEADERBOARD_HPP
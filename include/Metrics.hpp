@@ -0,0 +1,143 @@
+#ifndef METRICS_HPP
+#define METRICS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Contadores de operación del juego
+ */
+enum class MetricCounter : std::uint8_t {
+    TICKS,
+    FRAMES,
+    FOOD_EATEN,
+    DEATHS_WALL,
+    DEATHS_SELF,
+    AUDIO_TRIGGERS,         // Efectos de sonido arrancados por el hilo de audio
+    INPUT_EVENTS,           // Teclas pulsadas y soltadas
+    COUNT
+};
+
+/**
+ * @brief Histogramas de duración, en microsegundos
+ */
+enum class MetricHistogram : std::uint8_t {
+    FRAME_TIME,
+    TICK_TIME,
+    POLICY_TIME,        // Una decisión de PolicyInputSource
+    COUNT
+};
+
+/**
+ * @brief Métricas de un hilo, en su propia línea de caché
+ *
+ * Solo escribe el hilo dueño (carga y almacenamiento relajados, sin
+ * instrucciones con lock); quien exporta suma todos los shards leyendo
+ * con relaxed. El shard compartido (hilos por encima de MAX_SHARDS)
+ * usa fetch_add.
+ */
+struct alignas(64) MetricShard {
+    static const size_t COUNTER_COUNT = static_cast<size_t>(MetricCounter::COUNT);
+    static const size_t HISTOGRAM_COUNT = static_cast<size_t>(MetricHistogram::COUNT);
+    static const size_t BUCKET_COUNT = 22;     // le = 1, 2, 4 ... 2^20 µs, y +Inf
+
+    struct HistogramCells {
+        std::atomic<std::uint64_t> buckets[BUCKET_COUNT];
+        std::atomic<std::uint64_t> sum;
+    };
+
+    std::atomic<std::uint64_t> counters[COUNTER_COUNT];
+    HistogramCells histograms[HISTOGRAM_COUNT];
+    const bool isShared;
+
+    explicit MetricShard(bool shared = false);
+
+    // Métodos principales (verbos)
+    void Clear();
+};
+
+/**
+ * @brief Registro global de métricas con un shard por hilo
+ *
+ * Registrar cuesta un acceso thread_local y una suma en la línea de caché
+ * del propio hilo, sin contención entre hilos. El primer registro de cada
+ * hilo reserva su shard (una sola vez, con un contador atómico).
+ */
+class Metrics {
+public:
+    static const size_t MAX_SHARDS = 32;
+
+private:
+    static MetricShard shards[MAX_SHARDS];
+    static MetricShard sharedShard;
+    static std::atomic<size_t> shardCount;
+    static thread_local MetricShard* threadShard;
+
+public:
+    // Métodos principales (verbos)
+    static void Increment(MetricCounter counter, std::uint64_t amount = 1) {
+        Add(GetThreadShard().counters[static_cast<size_t>(counter)], amount);
+    }
+    static void Observe(MetricHistogram histogram, std::uint64_t microseconds);
+    static void WritePrometheus(std::ostream& stream);
+    static void Reset();        // Solo sin hilos registrando (herramientas y benchmarks)
+
+    // Getters
+    static std::uint64_t GetCounter(MetricCounter counter);
+    static std::uint64_t GetHistogramCount(MetricHistogram histogram);
+    static size_t GetShardCount();
+
+private:
+    // Métodos privados auxiliares
+    static MetricShard& GetThreadShard() {
+        return threadShard ? *threadShard : AcquireShard();
+    }
+    static MetricShard& AcquireShard();
+    static MetricShard& GetShard(size_t index) { return index < MAX_SHARDS ? shards[index] : sharedShard; }
+    static void Add(std::atomic<std::uint64_t>& cell, std::uint64_t amount) {
+        if (threadShard->isShared) {
+            cell.fetch_add(amount, std::memory_order_relaxed);
+        } else {
+            cell.store(cell.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+    }
+};
+
+/**
+ * @brief Servidor HTTP mínimo que publica Metrics en formato Prometheus
+ *
+ * Un hilo propio atiende una conexión a la vez en 127.0.0.1: responde
+ * GET /metrics y cierra. Nunca toca el hilo del juego.
+ */
+class MetricsServer {
+private:
+    std::thread thread;
+    std::atomic<bool> isStopping;
+    int listenSocket;
+    int port;
+
+public:
+    MetricsServer();
+    ~MetricsServer();
+
+    MetricsServer(const MetricsServer&) = delete;
+    MetricsServer& operator=(const MetricsServer&) = delete;
+
+    // Métodos principales (verbos)
+    bool Start(int listenPort);     // 0 = puerto libre cualquiera (ver GetPort)
+    void Stop();
+
+    // Getters
+    bool IsRunning() const { return thread.joinable(); }
+    int GetPort() const { return port; }
+
+private:
+    // Métodos privados auxiliares
+    void Serve();
+    void HandleConnection(int connection);
+};
+
+#endif // METRICS_HPP
@@ -0,0 +1,104 @@
+#ifndef OBSERVATION_ENCODER_HPP
+#define OBSERVATION_ENCODER_HPP
+
+#include "BatchEnvironment.hpp"
+#include <cstdint>
+#include <vector>
+
+class GameSimulation;
+
+/**
+ * @brief Planos de características de un BatchEnvironment para agentes RL
+ *
+ * Lee directamente el tablero de ocupación que mantiene BatchEnvironment
+ * (sin recorrer segmentos) y escribe, por partida, cuatro planos: cuerpo,
+ * cabeza, comida y distancia a la pared. El plano del cuerpo, que es el
+ * único que cambia en todo el tablero, se calcula con AVX2 comparando 8
+ * celdas por instrucción.
+ *
+ * Formatos:
+ * - UINT8: un byte por celda. Cuerpo, cabeza y comida valen 0 o 1; la
+ *   distancia a la pared vale 1 en el borde, 2 en la siguiente fila... (hasta
+ *   255) y 0 fuera del tablero. Sin paredes (wrapWalls) vale 255.
+ * - BITS: un bit por celda (celda i en el byte i/8, bit i%8) y cada plano
+ *   empieza en un byte nuevo. El plano de pared es la distancia cuantizada
+ *   a un bit: marca las celdas fuera del tablero y las del borde (distancia
+ *   0 o 1), así que también dice algo con el tablero completo. Con
+ *   wrapWalls no marca ninguna.
+ *
+ * Vista completa (viewRadius 0) o egocéntrica: una ventana de
+ * (2r+1) x (2r+1) centrada en la cabeza; con wrapWalls la ventana da la
+ * vuelta al tablero. Se construye para un tamaño de tablero y reglas
+ * concretos. No es seguro entre hilos (usa un buffer propio).
+ *
+ * EncodeSimulation da la misma vista para una partida de GameSimulation
+ * (el juego con ventana), y ConvertToPolicyInput pasa una observación
+ * UINT8 a la entrada float de PolicyNetwork.
+ */
+class ObservationEncoder {
+public:
+    enum class Format {
+        UINT8,
+        BITS
+    };
+
+    enum Plane {
+        PLANE_BODY,
+        PLANE_HEAD,
+        PLANE_FOOD,
+        PLANE_WALL_DISTANCE,
+        PLANE_COUNT
+    };
+
+private:
+    int gridWidth;
+    int gridHeight;
+    bool wrapWalls;
+    Format format;
+    int viewRadius;                         // 0 = tablero completo
+    int viewWidth;
+    int viewHeight;
+    size_t planeSize;                       // Bytes por plano
+    BatchEnvironment::SimdLevel simdLevel;
+
+    std::vector<std::uint8_t> wallDistances;    // Plano de pared de todo el tablero (UINT8)
+    std::vector<std::uint8_t> wallBits;         // El mismo en BITS; solo con el tablero completo
+    std::vector<std::uint8_t> viewPlanes;       // Vista egocéntrica en UINT8 antes de empaquetar
+
+public:
+    ObservationEncoder(const BatchEnvironment& environment, Format outputFormat, int radius = 0);
+    ObservationEncoder(int width, int height, const GameRules& rules, Format outputFormat, int radius = 0);
+
+    // Métodos principales (verbos)
+    void Encode(const BatchEnvironment& environment, std::uint8_t* output);     // GetObservationSize() bytes por partida
+    void EncodeGame(const BatchEnvironment& environment, size_t game, std::uint8_t* output);
+    void EncodeSimulation(const GameSimulation& simulation, std::uint8_t* output);
+    void ConvertToPolicyInput(const std::uint8_t* observation, float* input) const;     // Solo UINT8
+
+    // Getters
+    Format GetFormat() const { return format; }
+    int GetGridWidth() const { return gridWidth; }
+    int GetGridHeight() const { return gridHeight; }
+    int GetViewWidth() const { return viewWidth; }
+    int GetViewHeight() const { return viewHeight; }
+    size_t GetPlaneSize() const { return planeSize; }
+    size_t GetObservationSize() const { return planeSize * PLANE_COUNT; }
+    int GetViewRadius() const { return viewRadius; }
+    bool IsWrapWalls() const { return wrapWalls; }
+    BatchEnvironment::SimdLevel GetSimdLevel() const { return simdLevel; }
+
+    // Setters
+    void SetSimdLevel(BatchEnvironment::SimdLevel level);
+
+private:
+    // Métodos privados auxiliares
+    void EncodeFullBoard(const BatchEnvironment& environment, size_t game, std::uint8_t* output) const;
+    void EncodeView(const BatchEnvironment& environment, size_t game, std::uint8_t* planes) const;   // Siempre UINT8
+    void PrefetchView(const BatchEnvironment& environment, size_t game) const;
+    void MarkCell(std::uint8_t* plane, int x, int y, int originX, int originY) const;
+    void EncodeBodyBytes(const std::int32_t* cells, std::int32_t tail, int count, std::uint8_t* output) const;
+    void EncodeBodyBits(const std::int32_t* cells, std::int32_t tail, int count, std::uint8_t* output) const;
+    void PackBits(const std::uint8_t* values, int count, bool isWallPlane, std::uint8_t* output) const;
+};
+
+#endif // OBSERVATION_ENCODER_HPP
@@ -0,0 +1,115 @@
+#ifndef POLICY_NETWORK_HPP
+#define POLICY_NETWORK_HPP
+
+#include "BatchEnvironment.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class PolicyLayerType : std::uint32_t {
+    CONV3X3,        // Convolución 3x3 con relleno (misma altura y anchura)
+    DENSE
+};
+
+/**
+ * @brief Una capa de la red tal como se describe y se guarda en disco
+ */
+struct PolicyLayer {
+    PolicyLayerType type;
+    int outputs;        // Canales (CONV3X3, múltiplo de 8) o neuronas (DENSE)
+    bool hasRelu;
+
+    PolicyLayer(PolicyLayerType layerType = PolicyLayerType::DENSE, int count = 0, bool relu = true)
+        : type(layerType), outputs(count), hasRelu(relu) {}
+};
+
+/**
+ * @brief Buffers de una inferencia; uno por hilo
+ *
+ * Solo crecen: tras la primera llamada con el lote más grande, Forward
+ * ya no reserva memoria.
+ */
+struct PolicyWorkspace {
+    std::vector<float> activations[2];
+    std::vector<float> columns;         // im2col de una muestra
+    std::vector<float> logits;
+};
+
+/**
+ * @brief Red pequeña que elige la dirección de la serpiente
+ *
+ * Convoluciones 3x3 seguidas de capas densas; la última da un logit por
+ * dirección, en el orden de Direction. La entrada es de C planos de H x W
+ * floats (C, H, W); las convoluciones dejan sus salidas como (H, W, C).
+ *
+ * Los pesos se guardan en orden canónico (densa: [salida][entrada];
+ * convolución: [salida][entrada][3][3]; después los sesgos) y al cargarlos
+ * se reempaquetan en bloques de 8 salidas contiguas por entrada. Así el
+ * kernel AVX2/FMA lee los pesos en orden y calcula 4 filas x 16 salidas
+ * por vuelta. Las convoluciones se hacen como im2col + ese mismo producto;
+ * las densas procesan todo el lote a la vez.
+ *
+ * Forward es const: varios hilos pueden usar la misma red, cada uno con
+ * su PolicyWorkspace.
+ */
+class PolicyNetwork {
+public:
+    static const int ACTION_COUNT = 4;
+
+private:
+    // Forma y desplazamientos de cada capa, calculados en Configure
+    struct LayerShape {
+        int inputs;             // Entradas canónicas (densa) o columnas im2col (convolución)
+        int inputStride;        // Ancho real de la activación de entrada
+        int depth;              // Filas de los pesos empaquetados (las de relleno van a 0)
+        int inputChannels;      // Solo convolución
+        bool isInputPlanar;     // Solo convolución: entrada (C, H, W) en lugar de (H, W, C)
+        int paddedOutputs;      // Salidas redondeadas a múltiplo de 8
+        size_t parameterOffset;
+        size_t packedOffset;
+    };
+
+    int inputChannels;
+    int inputHeight;
+    int inputWidth;
+    std::vector<PolicyLayer> layers;
+    std::vector<LayerShape> shapes;
+    std::vector<float> parameters;          // Orden canónico (el del archivo)
+    std::vector<float> packedWeights;       // Pesos y sesgos reempaquetados
+    BatchEnvironment::SimdLevel simdLevel;
+
+public:
+    PolicyNetwork();
+
+    // Métodos principales (verbos)
+    bool Configure(int channels, int height, int width, const std::vector<PolicyLayer>& layerSpecs);
+    void InitializeRandom(std::uint64_t seed);
+    bool LoadFromFile(const std::string& path);
+    bool SaveToFile(const std::string& path) const;
+    void Forward(const float* inputs, size_t batch, float* logits, PolicyWorkspace& workspace) const;
+    void SelectActions(const float* inputs, size_t batch, std::int8_t* actions, PolicyWorkspace& workspace) const;
+
+    // Getters
+    bool IsConfigured() const { return !layers.empty(); }
+    int GetInputChannels() const { return inputChannels; }
+    int GetInputHeight() const { return inputHeight; }
+    int GetInputWidth() const { return inputWidth; }
+    size_t GetInputSize() const { return static_cast<size_t>(inputChannels) * inputHeight * inputWidth; }
+    const std::vector<PolicyLayer>& GetLayers() const { return layers; }
+    size_t GetParameterCount() const { return parameters.size(); }
+    const std::vector<float>& GetParameters() const { return parameters; }
+    BatchEnvironment::SimdLevel GetSimdLevel() const { return simdLevel; }
+
+    // Setters
+    void SetParameters(const float* values);        // GetParameterCount() valores en orden canónico
+    void SetSimdLevel(BatchEnvironment::SimdLevel level);
+
+private:
+    // Métodos privados auxiliares
+    void PackWeights();
+    void BuildColumns(const float* input, const LayerShape& shape, float* columns) const;
+    void Multiply(const float* rows, size_t rowCount, size_t rowStride, const LayerShape& shape,
+                  bool hasRelu, float* output) const;
+};
+
+#endif // POLICY_NETWORK_HPP
@@ -0,0 +1,135 @@
+#ifndef POLICY_TRAINER_HPP
+#define POLICY_TRAINER_HPP
+
+#include "GameRules.hpp"
+#include "PolicyNetwork.hpp"
+#include "ThreadPool.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Parámetros de un entrenamiento; se guardan en el checkpoint
+ */
+struct TrainerConfig {
+    int gridWidth;
+    int gridHeight;
+    GameRules rules;
+    int viewRadius;                         // La red ve (2r+1) x (2r+1) celdas
+    std::vector<PolicyLayer> hiddenLayers;  // La capa de salida (4 logits) se añade sola
+    size_t populationSize;
+    size_t eliteCount;                      // Pasan sin cambios a la siguiente generación
+    int tournamentSize;
+    float mutationStrength;                 // Desviación del ruido gaussiano por peso
+    float crossoverRate;                    // Probabilidad de cruce uniforme con un segundo padre
+    size_t gamesPerEvaluation;
+    std::uint32_t maxEpisodeTicks;          // > 0: sin límite una política en bucle no terminaría nunca
+    std::uint64_t seed;
+
+    TrainerConfig()
+        : gridWidth(50), gridHeight(35), viewRadius(4),
+          hiddenLayers({ PolicyLayer(PolicyLayerType::CONV3X3, 8), PolicyLayer(PolicyLayerType::DENSE, 16) }),
+          populationSize(64), eliteCount(4), tournamentSize(3), mutationStrength(0.02f), crossoverRate(0.0f),
+          gamesPerEvaluation(32), maxEpisodeTicks(1000), seed(1) {}
+};
+
+/**
+ * @brief Resumen de una generación (también es el registro del checkpoint)
+ */
+struct GenerationStats {
+    std::uint64_t generation;
+    std::uint64_t evaluations;
+    std::uint64_t steps;                    // Decisiones de la red en toda la generación
+    double seconds;
+    float bestFitness;
+    float meanFitness;
+    float medianFitness;
+    float worstFitness;
+};
+
+/**
+ * @brief Neuroevolución de los pesos de PolicyNetwork sobre BatchEnvironment
+ *
+ * Algoritmo genético: los mejores (eliteCount) pasan tal cual y el resto
+ * de la población sale de padres elegidos por torneo, con cruce uniforme
+ * opcional y ruido gaussiano en todos los pesos.
+ *
+ * La aptitud de un genoma es la media, sobre gamesPerEvaluation partidas,
+ * de la comida que consigue más SURVIVAL_BONUS por tick sobrevivido (para
+ * distinguir a las redes que aún no comen). Toda la población juega con las
+ * mismas semillas, que cambian en cada generación.
+ *
+ * Cada hilo del pool tiene su arena (entorno, codificador, copia de la red
+ * y buffers) y va tomando genomas de un contador atómico; evaluar no reserva
+ * memoria. El resultado no depende del número de hilos.
+ *
+ * El checkpoint guarda la configuración, el estado del generador, el
+ * historial de generaciones, el mejor genoma y la población siguiente;
+ * LoadCheckpoint continúa exactamente donde se dejó.
+ */
+class PolicyTrainer {
+public:
+    static constexpr float SURVIVAL_BONUS = 0.001f;
+
+private:
+    struct EvaluationArena;
+
+    TrainerConfig config;
+    PolicyNetwork prototype;                // Define la arquitectura; sus pesos no se usan
+    size_t parameterCount;
+    std::vector<float> population;          // populationSize x parameterCount, contiguos
+    std::vector<float> nextPopulation;
+    std::vector<float> fitness;
+    std::vector<size_t> ranking;            // Índices de la población, de mejor a peor
+    std::vector<float> bestGenome;          // El mejor de la última generación evaluada
+    float bestFitness;
+    std::uint64_t generation;
+    std::uint64_t randomState;
+    std::vector<GenerationStats> history;
+
+    size_t threadCount;
+    std::unique_ptr<ThreadPool> pool;
+    std::vector<std::unique_ptr<EvaluationArena>> arenas;
+
+public:
+    PolicyTrainer();
+    ~PolicyTrainer();
+
+    PolicyTrainer(const PolicyTrainer&) = delete;
+    PolicyTrainer& operator=(const PolicyTrainer&) = delete;
+
+    // Métodos principales (verbos)
+    bool Configure(const TrainerConfig& trainerConfig);     // Crea una población aleatoria
+    GenerationStats Evaluate();                             // Solo evalúa la población actual
+    GenerationStats RunGeneration();                        // Evalúa, registra y cría la siguiente
+    bool SaveCheckpoint(const std::string& path) const;
+    bool LoadCheckpoint(const std::string& path);
+    bool SaveBestPolicy(const std::string& path) const;     // Formato de PolicyNetwork (--policy)
+
+    // Getters
+    bool IsConfigured() const { return parameterCount > 0; }
+    const TrainerConfig& GetConfig() const { return config; }
+    std::uint64_t GetGeneration() const { return generation; }
+    size_t GetParameterCount() const { return parameterCount; }
+    const std::vector<float>& GetFitness() const { return fitness; }
+    const std::vector<float>& GetBestGenome() const { return bestGenome; }
+    float GetBestFitness() const { return bestFitness; }
+    const std::vector<GenerationStats>& GetHistory() const { return history; }
+    size_t GetThreadCount() const { return threadCount; }
+
+    // Setters
+    void SetThreadCount(size_t count);
+
+private:
+    // Métodos privados auxiliares
+    void BuildArenas();
+    float EvaluateGenome(EvaluationArena& arena, const float* genome, std::uint64_t seed) const;
+    void Breed();
+    size_t SelectParent();
+    std::uint64_t NextRandom();
+    double NextUniform();
+    float NextGaussian();
+};
+
+#endif // POLICY_TRAINER_HPP
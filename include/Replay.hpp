@@ -0,0 +1,66 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include "GameRules.hpp"
+#include "Snake.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class GameSimulation;
+
+/**
+ * @brief Cambio de dirección solicitado antes de un tick
+ */
+struct ReplayEvent {
+    std::uint64_t tick;     // Ticks ya simulados cuando llegó la entrada
+    Direction direction;
+    
+    ReplayEvent(std::uint64_t t = 0, Direction d = Direction::RIGHT) : tick(t), direction(d) {}
+};
+
+/**
+ * @brief Grabación de una partida: semilla más entradas por tick
+ * 
+ * Como GameSimulation es determinista, la semilla y la secuencia de
+ * cambios de dirección bastan para reconstruir la partida completa.
+ */
+class Replay {
+private:
+    int gridWidth;
+    int gridHeight;
+    std::uint32_t seed;
+    GameRules rules;
+    std::uint64_t tickCount;
+    std::vector<ReplayEvent> events;
+    
+public:
+    Replay();
+    ~Replay();
+    
+    // Métodos de grabación (verbos)
+    void Begin(int width, int height, std::uint32_t newSeed, const GameRules& gameRules = GameRules());
+    void RecordDirection(std::uint64_t tick, Direction direction);
+    void Finish(std::uint64_t totalTicks);
+    
+    // Métodos de reproducción
+    size_t ApplyPendingEvents(GameSimulation& simulation, size_t cursor) const;
+    
+    // Métodos de persistencia
+    bool SaveToFile(const std::string& path) const;
+    bool LoadFromFile(const std::string& path);
+    
+    // Getters
+    int GetGridWidth() const { return gridWidth; }
+    int GetGridHeight() const { return gridHeight; }
+    std::uint32_t GetSeed() const { return seed; }
+    const GameRules& GetRules() const { return rules; }
+    std::uint64_t GetTickCount() const { return tickCount; }
+    const std::vector<ReplayEvent>& GetEvents() const { return events; }
+    
+    // Métodos de utilidad (formato de texto U/D/L/R, compartido con los guiones)
+    static char DirectionToChar(Direction direction);
+    static bool CharToDirection(char value, Direction& direction);
+};
+
+#endif // REPLAY_HPP
@@ -0,0 +1,117 @@
+#ifndef REPLAY_EXPORTER_HPP
+#define REPLAY_EXPORTER_HPP
+
+#include "GameSimulation.hpp"
+#include "Replay.hpp"
+#include "BoundedQueue.hpp"
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class GameRenderer;
+
+/**
+ * @brief Formatos de salida de la exportación
+ */
+enum class ExportFormat {
+    Y4M,            // Video sin comprimir YUV 4:2:0 en un solo archivo
+    PNG_SEQUENCE    // Un PNG por frame (outputPath es un prefijo)
+};
+
+/**
+ * @brief Opciones de exportación de un replay
+ */
+struct ExportOptions {
+    std::string outputPath;
+    ExportFormat format;
+    int threadCount;        // Workers de renderizado/codificación
+    int queueCapacity;      // Frames en vuelo como máximo (backpressure)
+    int frameWidth;
+    int frameHeight;
+    int framesPerSecond;    // Solo para la cabecera Y4M
+    bool discardOutput;     // Medir sin escribir a disco
+    
+    ExportOptions()
+        : format(ExportFormat::Y4M), threadCount(1), queueCapacity(16),
+          frameWidth(1200), frameHeight(900), framesPerSecond(10), discardOutput(false) {}
+};
+
+/**
+ * @brief Estadísticas de una exportación
+ */
+struct ExportStats {
+    std::uint64_t frames;
+    std::uint64_t bytesWritten;
+    std::uint64_t checksum;     // Huella del video: hash FNV por frame combinado en orden
+    double seconds;
+    
+    ExportStats() : frames(0), bytesWritten(0), checksum(0), seconds(0.0) {}
+    double GetFramesPerSecond() const { return seconds > 0.0 ? frames / seconds : 0.0; }
+};
+
+/**
+ * @brief Convierte un replay en video reproduciéndolo sin ventana
+ * 
+ * Pipeline de tres etapas:
+ *  1. Simulación (hilo llamador): reproduce el replay y emite un estado por tick.
+ *  2. Renderizado + codificación (threadCount workers): cada uno con su propio
+ *     GameRenderer sin ventana, que comparte las imágenes decodificadas una
+ *     sola vez; rasteriza y convierte el frame.
+ *  3. Escritura (un hilo): reordena por índice y escribe en orden.
+ * 
+ * Las etapas se comunican con colas acotadas y un límite de frames en vuelo,
+ * así que la memoria no crece si el disco o los workers van más lentos.
+ * La salida es idéntica byte a byte para el mismo replay.
+ */
+class ReplayExporter {
+private:
+    // Solo lo que se dibuja en el frame; la simulación (con su generador) se queda en la etapa 1
+    struct FrameJob {
+        std::uint64_t index;
+        Snake snake;
+        Position foodPosition;
+        bool isFoodActive;
+        int score;
+        bool isGameOver;
+    };
+    
+    struct EncodedFrame {
+        std::uint64_t index;
+        std::uint64_t hash;     // Calculado en el worker para no cargar al escritor
+        std::vector<std::uint8_t> data;
+    };
+    
+    ExportOptions options;
+    
+    // Control de frames en vuelo entre la simulación y la escritura
+    std::mutex progressMutex;
+    std::condition_variable progressChanged;
+    std::uint64_t framesWritten;
+    bool failed;
+    
+public:
+    explicit ReplayExporter(const ExportOptions& exportOptions);
+    ~ReplayExporter();
+    
+    // Métodos principales (verbos)
+    bool Export(const Replay& replay, ExportStats& stats);
+    
+    // Métodos de conversión
+    static void ConvertToI420(const std::uint8_t* rgba, int width, int height, std::vector<std::uint8_t>& output);
+    
+    // Getters
+    const ExportOptions& GetOptions() const { return options; }
+    
+private:
+    // Métodos privados auxiliares
+    void RunRenderWorker(const GameRenderer& assets, BoundedQueue<FrameJob>& jobs, BoundedQueue<EncodedFrame>& encoded);
+    void RunWriter(BoundedQueue<EncodedFrame>& encoded, ExportStats& stats);
+    std::string GetFramePath(std::uint64_t index) const;
+    std::string GetY4mHeader() const;
+    void MarkFrameWritten();
+    void MarkFailed();
+};
+
+#endif // REPLAY_EXPORTER_HPP
@@ -0,0 +1,126 @@
+#ifndef SCORE_STORE_HPP
+#define SCORE_STORE_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Puntuación de una partida terminada, tal como se guarda en disco
+ */
+struct ScoreRecord {
+    std::uint64_t sequence;     // Orden de inserción, desde 1; no se repite
+    std::int64_t timestamp;     // Segundos desde epoch
+    std::uint64_t seed;         // Semilla de la partida (la misma del replay)
+    std::int32_t score;
+    std::uint32_t tickCount;
+};
+
+static_assert(sizeof(ScoreRecord) == 32, "ScoreRecord is written to disk as is");
+
+/**
+ * @brief Resultado de la recuperación al abrir el almacén
+ */
+struct ScoreRecoveryStats {
+    std::uint64_t snapshotRecords;
+    std::uint64_t logRecords;           // Entradas del log posteriores al snapshot
+    std::uint64_t discardedBytes;       // Cola del log incompleta o corrupta (truncada)
+    double seconds;
+
+    ScoreRecoveryStats() : snapshotRecords(0), logRecords(0), discardedBytes(0), seconds(0.0) {}
+};
+
+/**
+ * @brief Almacén persistente de puntuaciones a prueba de cortes de luz
+ *
+ * Dos archivos en el directorio del almacén:
+ * - scores.log: log de solo anexado; cada entrada lleva su CRC32C. Un
+ *   apagón a mitad de escritura deja como mucho una cola rota, que la
+ *   recuperación detecta y trunca.
+ * - scores.snap: snapshot compactado (un CRC para todo el bloque). Se
+ *   escribe en un temporal y se renombra, así que siempre hay uno válido;
+ *   las entradas del log con secuencia ya incluida en él se ignoran.
+ *
+ * Add no hace E/S: encola la entrada y un hilo de volcado la escribe y
+ * llama a fdatasync. Cada DEFAULT_COMPACT_THRESHOLD entradas del log el
+ * mismo hilo compacta log y snapshot en un snapshot nuevo, por bloques.
+ * Si una escritura falla, el almacén queda marcado como fallido (Flush
+ * devuelve false) y el log se recorta a la última entrada duradera antes
+ * de volver a anexar.
+ */
+class ScoreStore {
+public:
+    static constexpr const char* DEFAULT_DIRECTORY = "scores";
+    static const std::uint64_t DEFAULT_COMPACT_THRESHOLD = 100000;
+
+private:
+    std::string directory;
+    std::vector<ScoreRecord> records;       // Todas las puntuaciones; solo el hilo del juego
+    std::uint64_t nextSequence;
+    std::uint64_t compactThreshold;         // 0 = nunca compactar
+    ScoreRecoveryStats recoveryStats;
+    bool isOpen;
+
+    // Hilo de volcado; pending es lo único compartido con el hilo del juego
+    std::thread flusher;
+    std::mutex mutex;
+    std::condition_variable wakeFlusher;
+    std::condition_variable flushed;
+    std::vector<ScoreRecord> pending;
+    std::uint64_t durableSequence;          // Última secuencia con fdatasync hecho
+    bool isCompactRequested;
+    bool isStopping;
+    bool isFailed;
+
+    // Estado propio del hilo de volcado
+    std::FILE* logFile;                     // nullptr si no se pudo reabrir: el almacén falla
+    std::uint64_t logRecordCount;           // Entradas en el log desde el último snapshot
+    std::uint64_t logValidEnd;              // Final de la última entrada con fdatasync hecho
+    bool isLogDirty;                        // Una escritura falló a medias tras logValidEnd
+
+public:
+    ScoreStore();
+    ~ScoreStore();
+
+    ScoreStore(const ScoreStore&) = delete;
+    ScoreStore& operator=(const ScoreStore&) = delete;
+
+    // Métodos principales (verbos)
+    bool Open(const std::string& storeDirectory = DEFAULT_DIRECTORY);
+    void Close();
+    const ScoreRecord& Add(int score, std::uint32_t tickCount, std::uint64_t seed);
+    bool Flush();
+    bool Compact();
+
+    // Getters
+    bool IsOpen() const { return isOpen; }
+    const std::vector<ScoreRecord>& GetRecords() const { return records; }
+    std::uint64_t GetRecordCount() const { return records.size(); }
+    const ScoreRecoveryStats& GetRecoveryStats() const { return recoveryStats; }
+    const std::string& GetDirectory() const { return directory; }
+    std::string GetLogPath() const { return directory + "/scores.log"; }
+    std::string GetSnapshotPath() const { return directory + "/scores.snap"; }
+
+    // Setters
+    void SetCompactThreshold(std::uint64_t threshold) { compactThreshold = threshold; }  // Antes de Open
+
+    // Utilidades (herramientas)
+    static bool WriteLog(const std::string& path, const std::vector<ScoreRecord>& logRecords);
+
+private:
+    // Métodos privados auxiliares
+    bool Recover();
+    bool LoadSnapshot(const std::string& path, std::vector<ScoreRecord>& loaded);
+    bool ReplayLog(const std::string& path, std::uint64_t afterSequence);
+    bool OpenLogForAppend();
+    void RunFlusher();
+    bool AppendToLog(const std::vector<ScoreRecord>& batch);
+    bool TruncateLogToValidEnd();
+    bool CompactFiles();
+};
+
+#endif // SCORE_STORE_HPP
@@ -7,11 +7,13 @@
 #include <SFML/Audio.hpp>
 #include <SFML/Network.hpp>
 
+#include <cstdint>
 #include <vector>
 #include <string>
 
 // Forward declaration
 class GameRenderer;
+class ZobristHash;
 
 /**
  * @brief Enumeración para las direcciones de movimiento
@@ -54,6 +56,9 @@ private:
     bool hasGrown;
     int length;
     int growthFrames;  // Contador para mostrar efectos de crecimiento
+    int pendingGrowth; // Celdas que aún debe crecer (crecimiento de varias celdas)
+    const ZobristHash* zobrist;    // nullptr = sin hash
+    std::uint64_t hash;            // Se actualiza en cada cambio de estado si hay claves
     
 public:
     Snake(int startX, int startY);
@@ -62,7 +67,8 @@ public:
     // Métodos de movimiento (verbos)
     void Move();
     void ChangeDirection(Direction newDirection);
-    void Grow();
+    void Grow(int cells = 1);
+    void WrapHead(int gridWidth, int gridHeight);
     void Reset(int startX, int startY);
     
     // Métodos de actualización
@@ -83,9 +89,13 @@ public:
     int GetLength() const { return length; }
     bool HasGrown() const { return hasGrown; }
     int GetGrowthFrames() const { return growthFrames; }
+    int GetPendingGrowth() const { return pendingGrowth; }
+    const ZobristHash* GetZobristHash() const { return zobrist; }
+    std::uint64_t GetHash() const { return hash; }  // 0 sin SetZobristHash
     
     // Setters
     void SetHasGrown(bool value) { hasGrown = value; }
+    void SetZobristHash(const ZobristHash* keys);   // Calcula el hash desde cero; nullptr lo desactiva
     
 private:
     // Métodos privados auxiliares
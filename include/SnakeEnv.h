@@ -0,0 +1,86 @@
+#ifndef SNAKE_ENV_H
+#define SNAKE_ENV_H
+
+/*
+ * API C de libsnakeenv: lotes de partidas para aprendizaje por refuerzo.
+ *
+ * ABI estable: solo tipos C, structs con tamaño fijo y un puntero opaco.
+ * Quien llama reserva los buffers una vez; reset y step escriben en ellos
+ * directamente, sin reservar memoria ni copiar en cada paso. Cualquier
+ * buffer de salida puede ser NULL si no se necesita.
+ *
+ * Observaciones: por entorno, SNAKE_ENV_PLANE_COUNT planos de
+ * height x width floats (0 o 1), fila a fila:
+ *   [entorno][plano][y][x]  con planos cuerpo, cabeza y comida.
+ * Acciones: 0 arriba, 1 abajo, 2 izquierda, 3 derecha, -1 seguir recto.
+ *
+ * Un SnakeEnv no es seguro entre hilos; varios SnakeEnv sí pueden usarse
+ * en paralelo.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* SNAKE_ENV_BUILD solo al compilar la biblioteca (el juego compila SnakeEnv.cpp sin exportar nada) */
+#if defined(_WIN32)
+#  if defined(SNAKE_ENV_BUILD)
+#    define SNAKE_ENV_API __declspec(dllexport)
+#  else
+#    define SNAKE_ENV_API
+#  endif
+#else
+#  define SNAKE_ENV_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SNAKE_ENV_ABI_VERSION 1
+#define SNAKE_ENV_PLANE_COUNT 3
+
+/* Códigos de retorno */
+#define SNAKE_ENV_OK 0
+#define SNAKE_ENV_ERROR_INVALID_ARGUMENT (-1)
+#define SNAKE_ENV_ERROR_INTERNAL (-2)             /* Sin memoria u otro fallo interno */
+
+typedef struct SnakeEnv SnakeEnv;
+
+typedef struct SnakeEnvConfig {
+    int32_t width;                  /* Celdas (por defecto 16) */
+    int32_t height;
+    int32_t wrapWalls;              /* 0/1: reglas de GameRules */
+    int32_t selfCollision;
+    int32_t multiCellGrowth;
+    uint32_t maxEpisodeTicks;       /* 0 = sin límite */
+} SnakeEnvConfig;
+
+/* Versión con la que se compiló la biblioteca (comparar con SNAKE_ENV_ABI_VERSION) */
+SNAKE_ENV_API uint32_t snake_env_abi_version(void);
+
+/* Rellena config con los valores por defecto */
+SNAKE_ENV_API void snake_env_default_config(SnakeEnvConfig* config);
+
+/* NULL si los argumentos no son válidos o falta memoria; config NULL = valores por defecto */
+SNAKE_ENV_API SnakeEnv* snake_env_create(uint32_t envCount, const SnakeEnvConfig* config);
+SNAKE_ENV_API void snake_env_destroy(SnakeEnv* env);
+
+SNAKE_ENV_API uint32_t snake_env_count(const SnakeEnv* env);
+SNAKE_ENV_API size_t snake_env_observation_size(const SnakeEnv* env);     /* floats por entorno */
+
+/* observations: envCount * observation_size floats */
+SNAKE_ENV_API int snake_env_reset(SnakeEnv* env, uint64_t seed, float* observations);
+
+/*
+ * actions: envCount int8 (NULL = todos siguen recto).
+ * rewards: envCount floats; dones: envCount bytes. Un entorno con done = 1
+ * ya se reinició y su observación es la de la partida nueva.
+ */
+SNAKE_ENV_API int snake_env_step(SnakeEnv* env, const int8_t* actions, float* observations,
+                                 float* rewards, uint8_t* dones);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SNAKE_ENV_H */
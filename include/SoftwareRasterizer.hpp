@@ -0,0 +1,87 @@
+#ifndef SOFTWARE_RASTERIZER_HPP
+#define SOFTWARE_RASTERIZER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Imagen RGBA de 8 bits por canal en memoria de CPU
+ */
+struct RasterImage {
+    int width;
+    int height;
+    bool isOpaque;                      // Todos los píxeles tienen alfa 255
+    std::vector<std::uint8_t> pixels;   // width * height * 4 bytes (RGBA)
+
+    RasterImage() : width(0), height(0), isOpaque(true) {}
+
+    bool IsEmpty() const { return pixels.empty(); }
+    const std::uint8_t* GetRow(int y) const { return pixels.data() + static_cast<size_t>(y) * width * 4; }
+};
+
+/**
+ * @brief Rasterizador por software para renderizado sin GPU
+ *
+ * Compone imágenes RGBA sobre un framebuffer opaco en memoria
+ * usando mezcla alfa vectorizada (SSE2/AVX2 con selección en
+ * tiempo de ejecución). Permite capturar frames en máquinas sin
+ * pantalla ni contexto OpenGL.
+ */
+class SoftwareRasterizer {
+public:
+    enum class SimdLevel {
+        SCALAR,
+        SSE2,
+        AVX2
+    };
+
+    using BlendRowFunction = void (*)(std::uint8_t* dst, const std::uint8_t* src, int count);
+
+private:
+    int width;
+    int height;
+    mutable std::vector<std::uint8_t> frameBuffer;  // RGBA, alfa siempre 255
+    std::vector<std::uint8_t> scratchRow;   // Fila de color sólido para FillRect
+    SimdLevel simdLevel;
+    BlendRowFunction blendRow;
+    mutable bool hasPendingClear;           // Clear diferido hasta el primer dibujo
+    sf::Color pendingClearColor;
+
+public:
+    SoftwareRasterizer();
+    ~SoftwareRasterizer();
+
+    // Métodos de inicialización (verbos)
+    bool Initialize(int frameWidth, int frameHeight);
+    void SetSimdLevel(SimdLevel level);
+
+    // Métodos de composición
+    void Clear(const sf::Color& color);
+    void FillRect(int x, int y, int rectWidth, int rectHeight, const sf::Color& color);
+    void BlitImage(const RasterImage& image, int x, int y);
+
+    // Métodos de imágenes
+    static bool LoadImage(const std::string& path, RasterImage& image);
+    static void CreateImage(const std::uint8_t* rgbaPixels, int imageWidth, int imageHeight, RasterImage& image);
+    static void ScaleImage(const RasterImage& source, int targetWidth, int targetHeight, RasterImage& target);
+    static void DownscaleImage(const RasterImage& source, int targetWidth, int targetHeight, RasterImage& target);
+    bool SaveToFile(const std::string& path) const;
+    void CopyToImage(sf::Image& image) const;
+
+    // Getters
+    int GetWidth() const { return width; }
+    int GetHeight() const { return height; }
+    const std::uint8_t* GetPixels() const;
+    size_t GetPixelBufferSize() const { return frameBuffer.size(); }
+    SimdLevel GetSimdLevel() const { return simdLevel; }
+    static SimdLevel DetectSimdLevel();
+
+private:
+    // Métodos privados auxiliares
+    void FlushPendingClear() const;
+    std::uint8_t* GetRow(int y) { return frameBuffer.data() + static_cast<size_t>(y) * width * 4; }
+};
+
+#endif // SOFTWARE_RASTERIZER_HPP
@@ -0,0 +1,66 @@
+#ifndef SPSC_RING_HPP
+#define SPSC_RING_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @brief Cola circular sin bloqueos para un productor y un consumidor
+ *
+ * Capacity debe ser potencia de dos. TryPush y TryPop nunca esperan:
+ * devuelven false si la cola está llena o vacía. Los índices del
+ * productor y del consumidor viven en líneas de caché distintas.
+ */
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "SpscRing holds plain data only");
+
+private:
+    static const size_t CACHE_LINE = 64;
+    static const size_t MASK = Capacity - 1;
+
+    alignas(CACHE_LINE) std::atomic<size_t> head;   // Siguiente a leer (consumidor)
+    alignas(CACHE_LINE) std::atomic<size_t> tail;   // Siguiente a escribir (productor)
+    alignas(CACHE_LINE) std::array<T, Capacity> items;
+
+public:
+    SpscRing() : head(0), tail(0) {}
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Solo desde el hilo productor
+    bool TryPush(const T& item) {
+        const size_t currentTail = tail.load(std::memory_order_relaxed);
+        if (currentTail - head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+
+        items[currentTail & MASK] = item;
+        tail.store(currentTail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Solo desde el hilo consumidor
+    bool TryPop(T& item) {
+        const size_t currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        item = items[currentHead & MASK];
+        head.store(currentHead + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool IsEmpty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    static constexpr size_t GetCapacity() { return Capacity; }
+};
+
+#endif // SPSC_RING_HPP
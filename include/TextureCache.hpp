@@ -0,0 +1,90 @@
+#ifndef TEXTURE_CACHE_HPP
+#define TEXTURE_CACHE_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+class AssetPack;
+
+/**
+ * @brief Estadísticas de memoria de texturas (estimada como ancho * alto * 4)
+ */
+struct TextureCacheStats {
+    size_t residentBytes;
+    size_t peakResidentBytes;
+    size_t budgetBytes;             // 0 = sin límite
+    std::uint64_t loads;
+    std::uint64_t evictions;
+
+    TextureCacheStats() : residentBytes(0), peakResidentBytes(0), budgetBytes(0), loads(0), evictions(0) {}
+};
+
+/**
+ * @brief Caché de texturas con carga bajo demanda y presupuesto de memoria
+ *
+ * Cada textura se registra con su ruta y el tamaño con el que se dibuja.
+ * Stage guarda una copia en CPU de la imagen ya decodificada, reducida a
+ * ese tamaño; Acquire la sube la primera vez que se usa (desde esa copia
+ * o desde el pack), sin leer ni decodificar archivos, y al superar el
+ * presupuesto descarta las menos usadas recientemente. Las texturas
+ * usadas en el frame actual nunca se descartan; las descartadas se
+ * vuelven a subir desde la copia.
+ */
+class TextureCache {
+private:
+    struct Entry {
+        std::string path;
+        sf::Vector2i targetSize;        // (0, 0) = tamaño original
+        sf::Texture texture;
+        std::vector<std::uint8_t> pixels;   // Copia reducida (RGBA); vacía = usar el pack
+        sf::Vector2u pixelSize;
+        bool isResident;
+        size_t bytes;
+        std::uint64_t lastUsedFrame;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    std::map<std::string, Entry> entries;
+    std::list<std::string> lruOrder;    // Residentes, la más reciente al frente
+    const AssetPack* pack;
+    bool downscaleOnLoad;
+    std::uint64_t currentFrame;
+    TextureCacheStats stats;
+
+public:
+    TextureCache();
+    ~TextureCache();
+
+    // Métodos de registro (verbos)
+    void Register(const std::string& name, const std::string& path, const sf::Vector2i& targetSize);
+    bool Stage(const std::string& name, const std::uint8_t* rgbaPixels, unsigned int width, unsigned int height);
+    void Clear();
+
+    // Métodos de acceso
+    sf::Texture* Acquire(const std::string& name);
+    void BeginFrame() { currentFrame++; }
+    void Evict(const std::string& name);
+
+    // Getters
+    bool IsRegistered(const std::string& name) const { return entries.count(name) > 0; }
+    bool IsResident(const std::string& name) const;
+    const TextureCacheStats& GetStats() const { return stats; }
+
+    // Setters
+    void SetPack(const AssetPack* assetPack) { pack = assetPack; }
+    void SetMemoryBudget(size_t bytes);
+    void SetDownscaleOnLoad(bool enabled) { downscaleOnLoad = enabled; }
+
+private:
+    // Métodos privados auxiliares
+    bool Load(const std::string& name, Entry& entry);
+    bool Upload(Entry& entry, const std::uint8_t* rgbaPixels, unsigned int width, unsigned int height);
+    void Touch(Entry& entry);
+    void EnforceBudget();
+};
+
+#endif // TEXTURE_CACHE_HPP
@@ -0,0 +1,60 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Pool de hilos de tamaño fijo con cola FIFO de tareas
+ *
+ * Submit devuelve un std::future con el resultado de la tarea.
+ * El destructor termina las tareas pendientes antes de unir los hilos.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable taskAvailable;
+    bool stopping;
+
+public:
+    explicit ThreadPool(size_t threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Métodos principales (verbos)
+    template <typename Function>
+    std::future<std::invoke_result_t<Function>> Submit(Function&& function) {
+        using Result = std::invoke_result_t<Function>;
+
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(function));
+        std::future<Result> result = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.emplace_back([task]() { (*task)(); });
+        }
+        taskAvailable.notify_one();
+        return result;
+    }
+
+    // Getters
+    size_t GetThreadCount() const { return workers.size(); }
+    static size_t GetDefaultThreadCount();
+
+private:
+    // Métodos privados auxiliares
+    void RunWorker();
+};
+
+#endif // THREAD_POOL_HPP
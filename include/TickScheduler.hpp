@@ -0,0 +1,83 @@
+#ifndef TICK_SCHEDULER_HPP
+#define TICK_SCHEDULER_HPP
+
+#include "Histogram.hpp"
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Velocidad del juego respecto al intervalo normal
+ */
+enum class TickMode {
+    NORMAL,
+    TURBO,          // Mitad de intervalo
+    SLOW_MOTION,    // Doble de intervalo
+    FAST_FORWARD    // Sin espera: tantos ticks como el bucle pueda ejecutar
+};
+
+/**
+ * @brief Planificador de ticks de intervalo variable
+ *
+ * El intervalo baja con la puntuación (rampa de velocidad) y se ajusta
+ * con el modo. CollectDueTicks devuelve los ticks vencidos, como mucho
+ * maxCatchUpTicks: tras un parón los que sobran se descartan en lugar de
+ * ejecutarse de golpe. WaitUntil duerme hasta poco antes del plazo y
+ * espera activamente el resto, porque el sleep del sistema tiene una
+ * granularidad de 1 ms o peor. Guarda en un Histogram el retraso de
+ * cada tick respecto a su hora prevista.
+ */
+class TickScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+    using Duration = Clock::duration;
+
+    static const int DEFAULT_MAX_CATCH_UP_TICKS = 3;
+
+private:
+    Duration baseInterval;
+    Duration rampStep;              // Se resta por cada punto
+    Duration minimumInterval;
+    Duration currentInterval;
+    Duration spinThreshold;         // Último tramo de espera sin dormir
+    TickMode mode;
+    int score;
+    int maxCatchUpTicks;
+    bool isStarted;
+    TimePoint nextTick;
+    std::uint64_t tickCount;
+    std::uint64_t skippedTicks;
+    Histogram lateness;             // Hora real - hora prevista, en µs
+
+public:
+    explicit TickScheduler(Duration interval = std::chrono::milliseconds(100));
+
+    // Métodos principales (verbos)
+    void Start();
+    int CollectDueTicks();
+    void WaitUntil(TimePoint deadline, bool isPrecise = true) const;
+    void WaitForNextTick() const { WaitUntil(nextTick); }
+    void ResetStats();
+
+    // Getters
+    Duration GetInterval() const { return currentInterval; }
+    TimePoint GetNextTickTime() const { return nextTick; }
+    TickMode GetMode() const { return mode; }
+    std::uint64_t GetTickCount() const { return tickCount; }
+    std::uint64_t GetSkippedTicks() const { return skippedTicks; }
+    const Histogram& GetLateness() const { return lateness; }
+
+    // Setters
+    void SetMode(TickMode newMode);
+    void SetBaseInterval(Duration interval);
+    void SetSpeedRamp(Duration stepPerPoint, Duration minimum);
+    void SetScore(int newScore);
+    void SetMaxCatchUpTicks(int ticks);
+    void SetSpinThreshold(Duration threshold) { spinThreshold = threshold; }
+
+private:
+    // Métodos privados auxiliares
+    void UpdateInterval();
+};
+
+#endif // TICK_SCHEDULER_HPP
@@ -0,0 +1,86 @@
+#ifndef TRANSPOSITION_TABLE_HPP
+#define TRANSPOSITION_TABLE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Tipo de valor guardado: exacto o cota de la búsqueda
+ */
+enum class TranspositionBound : std::uint8_t {
+    NONE,           // Solo para entradas vacías
+    EXACT,
+    LOWER,
+    UPPER
+};
+
+/**
+ * @brief Resultado de haber buscado un estado hasta cierta profundidad
+ */
+struct TranspositionEntry {
+    std::int32_t value;
+    std::uint8_t depth;             // Plies que quedaban por buscar desde este estado
+    std::int8_t bestAction;         // Valor de Direction, o -1
+    TranspositionBound bound;
+
+    TranspositionEntry(std::int32_t entryValue = 0, int entryDepth = 0, int action = -1,
+                       TranspositionBound entryBound = TranspositionBound::EXACT)
+        : value(entryValue), depth(static_cast<std::uint8_t>(entryDepth)), bestAction(static_cast<std::int8_t>(action)),
+          bound(entryBound) {}
+};
+
+/**
+ * @brief Tabla de transposiciones de tamaño fijo compartida entre hilos
+ *
+ * Cubetas de 4 entradas en una línea de caché de 64 bytes: una búsqueda
+ * toca una sola línea. Cada entrada son dos palabras atómicas, los datos
+ * empaquetados y clave ^ datos; sin bloqueos, con accesos relaxed. Si dos
+ * hilos escriben a la vez la misma entrada y se mezclan las palabras, la
+ * clave ya no cuadra y Probe lo trata como un fallo, nunca como un acierto
+ * con datos de otro estado.
+ *
+ * Al guardar se reutiliza la entrada del mismo estado o una vacía; si no,
+ * se sustituye la menos valiosa (poca profundidad y de búsquedas antiguas,
+ * ver NewSearch). La clave completa (64 bits) se compara en cada acierto.
+ */
+class TranspositionTable {
+public:
+    static const int BUCKET_SIZE = 4;
+
+private:
+    struct alignas(64) Bucket {
+        std::atomic<std::uint64_t> keys[BUCKET_SIZE];       // clave ^ datos
+        std::atomic<std::uint64_t> data[BUCKET_SIZE];       // 0 = vacía
+    };
+
+    std::unique_ptr<Bucket[]> buckets;
+    size_t bucketMask;
+    std::atomic<std::uint32_t> generation;
+
+public:
+    explicit TranspositionTable(size_t sizeBytes);      // Se redondea hacia abajo a potencia de 2 cubetas
+
+    TranspositionTable(const TranspositionTable&) = delete;
+    TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+    // Métodos principales (verbos)
+    bool Probe(std::uint64_t key, TranspositionEntry& entry) const;
+    void Store(std::uint64_t key, const TranspositionEntry& entry);
+    void Prefetch(std::uint64_t key) const;
+    void NewSearch();                                   // Envejece las entradas de búsquedas anteriores
+    void Clear();                                       // No llamar con otros hilos usando la tabla
+
+    // Getters
+    size_t GetBucketCount() const { return bucketMask + 1; }
+    size_t GetCapacity() const { return GetBucketCount() * BUCKET_SIZE; }
+    size_t GetSizeBytes() const { return GetBucketCount() * sizeof(Bucket); }
+    double GetOccupancy() const;                        // Fracción de entradas usadas (muestra)
+
+private:
+    // Métodos privados auxiliares
+    Bucket& GetBucket(std::uint64_t key) const { return buckets[key & bucketMask]; }
+};
+
+#endif // TRANSPOSITION_TABLE_HPP
@@ -0,0 +1,69 @@
+#ifndef ZOBRIST_HASH_HPP
+#define ZOBRIST_HASH_HPP
+
+#include "Snake.hpp"
+#include <cstdint>
+#include <vector>
+
+class GameSimulation;
+
+/**
+ * @brief Claves de Zobrist para identificar estados del juego en búsquedas
+ *
+ * El hash de un estado es el XOR de una clave por cada celda del cuerpo,
+ * una por la cabeza, una por la cola, una por la dirección, una por el
+ * crecimiento pendiente y una por la comida. Las celdas solas no dicen el
+ * orden: con la cola, dos serpientes con las mismas celdas y la misma
+ * cabeza pero que liberan primero celdas distintas tienen hash distinto.
+ * Snake lo mantiene en O(1) por movimiento (cabeza nueva, cola que sale y
+ * cola nueva) si se le asignan estas claves con SetZobristHash;
+ * GameSimulation::GetStateHash le añade la comida.
+ *
+ * Las tablas cubren la grilla más un borde de una celda: la cabeza puede
+ * quedar fuera un momento (antes de WrapHead o del choque con la pared).
+ * Son de solo lectura: varios hilos pueden compartir una instancia, que
+ * debe vivir más que las serpientes que la usan.
+ */
+class ZobristHash {
+public:
+    static const int MAX_PENDING_GROWTH = 15;           // Más crecimiento pendiente comparte clave
+    static const std::uint64_t DEFAULT_SEED = 0x5A0B215ULL;
+
+private:
+    int gridWidth;
+    int gridHeight;
+    int paddedWidth;
+    std::vector<std::uint64_t> bodyKeys;                // (ancho + 2) x (alto + 2)
+    std::vector<std::uint64_t> headKeys;
+    std::vector<std::uint64_t> tailKeys;
+    std::vector<std::uint64_t> foodKeys;
+    std::uint64_t directionKeys[4];
+    std::uint64_t growthKeys[MAX_PENDING_GROWTH + 1];
+
+public:
+    ZobristHash(int width, int height, std::uint64_t seed = DEFAULT_SEED);
+
+    // Getters
+    int GetGridWidth() const { return gridWidth; }
+    int GetGridHeight() const { return gridHeight; }
+    std::uint64_t GetBodyKey(const Position& position) const { return bodyKeys[CellIndex(position)]; }
+    std::uint64_t GetHeadKey(const Position& position) const { return headKeys[CellIndex(position)]; }
+    std::uint64_t GetTailKey(const Position& position) const { return tailKeys[CellIndex(position)]; }
+    std::uint64_t GetFoodKey(const Position& position) const { return foodKeys[CellIndex(position)]; }
+    std::uint64_t GetDirectionKey(Direction direction) const { return directionKeys[static_cast<int>(direction)]; }
+    std::uint64_t GetGrowthKey(int pendingGrowth) const {
+        return growthKeys[pendingGrowth < MAX_PENDING_GROWTH ? pendingGrowth : MAX_PENDING_GROWTH];
+    }
+
+    // Utilidades
+    std::uint64_t ComputeSnake(const Snake& snake) const;               // Desde cero; debe dar Snake::GetHash
+    std::uint64_t ComputeState(const GameSimulation& simulation) const; // Desde cero; debe dar GetStateHash
+
+private:
+    // Métodos privados auxiliares
+    size_t CellIndex(const Position& position) const {
+        return static_cast<size_t>(position.y + 1) * paddedWidth + static_cast<size_t>(position.x + 1);
+    }
+};
+
+#endif // ZOBRIST_HASH_HPP
@@ -0,0 +1,109 @@
+#include "AssetLoader.hpp"
+#include "SoftwareRasterizer.hpp"
+#include "ThreadPool.hpp"
+#include <iostream>
+
+AssetLoader::AssetLoader() : completedCount(0), isDownscalingImages(false) {
+}
+
+AssetLoader::~AssetLoader() {
+}
+
+void AssetLoader::AddImage(const std::string& name, const std::string& path, const sf::Vector2i& targetSize) {
+    assets.push_back(std::make_unique<DecodedAsset>(AssetType::IMAGE, name, path));
+    assets.back()->targetSize = targetSize;
+}
+
+void AssetLoader::AddSound(const std::string& name, const std::string& path) {
+    assets.push_back(std::make_unique<DecodedAsset>(AssetType::SOUND, name, path));
+}
+
+void AssetLoader::Start(ThreadPool& pool) {
+    completedCount = 0;
+
+    for (auto& asset : assets) {
+        DecodedAsset* target = asset.get();
+        pool.Submit([this, target]() { DecodeAsset(*target); });
+    }
+}
+
+void AssetLoader::LoadAll() {
+    completedCount = 0;
+
+    for (auto& asset : assets) {
+        DecodeAsset(*asset);
+    }
+}
+
+bool AssetLoader::WaitFor(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    size_t seen = completedCount.load();
+    assetCompleted.wait_for(lock, timeout, [this, seen]() {
+        return completedCount.load() != seen || IsFinished();
+    });
+    return IsFinished();
+}
+
+float AssetLoader::GetProgress() const {
+    if (assets.empty()) return 1.0f;
+    return static_cast<float>(completedCount.load()) / static_cast<float>(assets.size());
+}
+
+bool AssetLoader::DecodeImage(DecodedAsset& asset) {
+    // sf::Image decodifica en CPU; es seguro usarla fuera del hilo principal
+    if (!asset.image.loadFromFile(asset.path)) {
+        std::cerr << "Failed to decode image: " << asset.path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool AssetLoader::DecodeSound(DecodedAsset& asset) {
+    // Decodificar a PCM sin crear recursos de OpenAL
+    sf::InputSoundFile file;
+    if (!file.openFromFile(asset.path)) {
+        std::cerr << "Failed to decode sound: " << asset.path << std::endl;
+        return false;
+    }
+
+    asset.channelCount = file.getChannelCount();
+    asset.sampleRate = file.getSampleRate();
+    asset.samples.resize(static_cast<size_t>(file.getSampleCount()));
+
+    sf::Uint64 read = file.read(asset.samples.data(), asset.samples.size());
+    asset.samples.resize(static_cast<size_t>(read));
+    return true;
+}
+
+void AssetLoader::DownscaleImage(DecodedAsset& asset) {
+    // Nunca ampliar; la imagen original se libera al sustituirla
+    const sf::Vector2u size = asset.image.getSize();
+    const int targetWidth = asset.targetSize.x;
+    const int targetHeight = asset.targetSize.y;
+    if (targetWidth <= 0 || targetHeight <= 0 ||
+        static_cast<unsigned int>(targetWidth) >= size.x || static_cast<unsigned int>(targetHeight) >= size.y) {
+        return;
+    }
+
+    RasterImage source;
+    RasterImage scaled;
+    SoftwareRasterizer::CreateImage(asset.image.getPixelsPtr(), static_cast<int>(size.x), static_cast<int>(size.y), source);
+    SoftwareRasterizer::DownscaleImage(source, targetWidth, targetHeight, scaled);
+    asset.image = sf::Image();
+    asset.image.create(static_cast<unsigned int>(scaled.width), static_cast<unsigned int>(scaled.height),
+                       scaled.pixels.data());
+}
+
+// Métodos privados
+void AssetLoader::DecodeAsset(DecodedAsset& asset) {
+    asset.isLoaded = (asset.type == AssetType::IMAGE) ? DecodeImage(asset) : DecodeSound(asset);
+    if (asset.isLoaded && asset.type == AssetType::IMAGE && isDownscalingImages) {
+        DownscaleImage(asset);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        completedCount++;
+    }
+    assetCompleted.notify_all();
+}
@@ -0,0 +1,231 @@
+#include "AssetPack.hpp"
+#include "SoftwareRasterizer.hpp"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ASSET_PACK_USE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char PACK_MAGIC[8] = { 'S', 'N', 'A', 'K', 'E', 'P', 'A', 'K' };
+
+size_t AlignUp(size_t value) {
+    return (value + AssetPack::PACK_ALIGNMENT - 1) & ~(AssetPack::PACK_ALIGNMENT - 1);
+}
+
+} // namespace
+
+AssetPack::AssetPack() : data(nullptr), size(0), isMapped(false) {
+}
+
+AssetPack::~AssetPack() {
+    Close();
+}
+
+bool AssetPack::Open(const std::string& path) {
+    Close();
+    
+#ifdef ASSET_PACK_USE_MMAP
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Failed to open asset pack: " << path << std::endl;
+        return false;
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        std::cerr << "Failed to read asset pack: " << path << std::endl;
+        close(fd);
+        return false;
+    }
+    
+    void* mapping = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // El mapeo sigue válido sin el descriptor
+    if (mapping == MAP_FAILED) {
+        std::cerr << "Failed to map asset pack: " << path << std::endl;
+        return false;
+    }
+    
+    // Todo el pack se lee una vez al arrancar
+    madvise(mapping, static_cast<size_t>(info.st_size), MADV_WILLNEED);
+    
+    data = static_cast<const std::uint8_t*>(mapping);
+    size = static_cast<size_t>(info.st_size);
+    isMapped = true;
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        std::cerr << "Failed to open asset pack: " << path << std::endl;
+        return false;
+    }
+    
+    buffer.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (buffer.empty() || !file.read(reinterpret_cast<char*>(buffer.data()), buffer.size())) {
+        std::cerr << "Failed to read asset pack: " << path << std::endl;
+        buffer.clear();
+        return false;
+    }
+    
+    data = buffer.data();
+    size = buffer.size();
+#endif
+    
+    if (!ValidateAndIndex(path)) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void AssetPack::Close() {
+#ifdef ASSET_PACK_USE_MMAP
+    if (isMapped && data) {
+        munmap(const_cast<std::uint8_t*>(data), size);
+    }
+#endif
+    data = nullptr;
+    size = 0;
+    isMapped = false;
+    buffer.clear();
+    entries.clear();
+}
+
+const PackEntry* AssetPack::Find(const std::string& name) const {
+    auto it = entries.find(name);
+    return (it != entries.end()) ? it->second : nullptr;
+}
+
+// Métodos privados
+bool AssetPack::ValidateAndIndex(const std::string& path) {
+    if (size < sizeof(PackHeader)) {
+        std::cerr << "Invalid asset pack: " << path << std::endl;
+        return false;
+    }
+    
+    const PackHeader* header = reinterpret_cast<const PackHeader*>(data);
+    if (std::memcmp(header->magic, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0 || header->version != VERSION) {
+        std::cerr << "Unsupported asset pack format: " << path << std::endl;
+        return false;
+    }
+    
+    size_t tableEnd = sizeof(PackHeader) + static_cast<size_t>(header->entryCount) * sizeof(PackEntry);
+    if (tableEnd > size) {
+        std::cerr << "Truncated asset pack: " << path << std::endl;
+        return false;
+    }
+    
+    const PackEntry* table = reinterpret_cast<const PackEntry*>(data + sizeof(PackHeader));
+    for (std::uint32_t i = 0; i < header->entryCount; i++) {
+        const PackEntry& entry = table[i];
+        
+        bool inBounds = entry.offset >= tableEnd && entry.offset <= size && entry.size <= size - entry.offset;
+        bool validSize = true;
+        if (entry.type == static_cast<std::uint32_t>(PackEntryType::IMAGE_RGBA)) {
+            validSize = entry.size == static_cast<std::uint64_t>(entry.width) * entry.height * 4;
+        } else if (entry.type == static_cast<std::uint32_t>(PackEntryType::SOUND_PCM16)) {
+            validSize = entry.width > 0 && entry.size % (static_cast<std::uint64_t>(entry.width) * 2) == 0;
+        }
+        
+        if (!inBounds || !validSize || entry.name[sizeof(entry.name) - 1] != '\0') {
+            std::cerr << "Corrupt asset pack entry " << i << " in " << path << std::endl;
+            return false;
+        }
+        
+        entries[entry.name] = &entry;
+    }
+    
+    return true;
+}
+
+bool AssetPackBuilder::AddImage(const std::string& name, const RasterImage& image) {
+    return AddEntry(name, PackEntryType::IMAGE_RGBA, static_cast<std::uint32_t>(image.width),
+                    static_cast<std::uint32_t>(image.height), image.pixels);
+}
+
+bool AssetPackBuilder::AddSound(const std::string& name, const std::vector<std::int16_t>& samples,
+                                unsigned int channelCount, unsigned int sampleRate) {
+    const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(samples.data());
+    return AddEntry(name, PackEntryType::SOUND_PCM16, channelCount, sampleRate,
+                    std::vector<std::uint8_t>(bytes, bytes + samples.size() * sizeof(std::int16_t)));
+}
+
+bool AssetPackBuilder::AddFile(const std::string& name, const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Failed to read file for pack: " << path << std::endl;
+        return false;
+    }
+    
+    std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return AddEntry(name, PackEntryType::RAW_FILE, 0, 0, std::move(bytes));
+}
+
+bool AssetPackBuilder::Write(const std::string& path) const {
+    PackHeader header;
+    std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+    header.version = AssetPack::VERSION;
+    header.entryCount = static_cast<std::uint32_t>(pending.size());
+    
+    // Asignar offsets alineados después de la tabla de contenidos
+    std::vector<PackEntry> table;
+    size_t offset = AlignUp(sizeof(PackHeader) + pending.size() * sizeof(PackEntry));
+    for (const auto& item : pending) {
+        PackEntry entry = item.entry;
+        entry.offset = offset;
+        table.push_back(entry);
+        offset = AlignUp(offset + item.bytes.size());
+    }
+    
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "Failed to create asset pack: " << path << std::endl;
+        return false;
+    }
+    
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(PackEntry));
+    
+    static const char padding[AssetPack::PACK_ALIGNMENT] = {};
+    size_t written = sizeof(PackHeader) + table.size() * sizeof(PackEntry);
+    for (size_t i = 0; i < pending.size(); i++) {
+        file.write(padding, table[i].offset - written);
+        file.write(reinterpret_cast<const char*>(pending[i].bytes.data()), pending[i].bytes.size());
+        written = table[i].offset + pending[i].bytes.size();
+    }
+    
+    if (!file) {
+        std::cerr << "Failed to write asset pack: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Métodos privados
+bool AssetPackBuilder::AddEntry(const std::string& name, PackEntryType type, std::uint32_t width,
+                                std::uint32_t height, std::vector<std::uint8_t> bytes) {
+    PendingEntry item;
+    std::memset(&item.entry, 0, sizeof(item.entry));
+    
+    if (name.empty() || name.size() >= sizeof(item.entry.name)) {
+        std::cerr << "Invalid asset pack entry name: " << name << std::endl;
+        return false;
+    }
+    
+    std::memcpy(item.entry.name, name.c_str(), name.size());
+    item.entry.type = static_cast<std::uint32_t>(type);
+    item.entry.width = width;
+    item.entry.height = height;
+    item.entry.size = bytes.size();
+    item.bytes = std::move(bytes);
+    
+    pending.push_back(std::move(item));
+    return true;
+}
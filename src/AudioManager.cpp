@@ -1,4 +1,10 @@
 #include "AudioManager.hpp"
+#include "AssetLoader.hpp"
+#include "AssetPack.hpp"
+#include "Metrics.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <iostream>
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
@@ -6,9 +12,35 @@
 #include <SFML/Audio.hpp>
 #include <SFML/Network.hpp>
 
+namespace {
+
+struct SoundAsset {
+    const char* name;
+    const char* filename;
+};
+
+const SoundAsset SOUND_EFFECTS[] = {
+    { "eat", "comer.wav" },
+    { "crash", "choque.wav" },
+    { "gameover", "gameover.wav" },
+    { "start", "inicio.wav" },
+};
+
+const SoundAsset MUSIC_TRACKS[] = {
+    { "background", "musica_fondo.wav" },
+};
+
+// El estado pasa a Stopped un poco después del final: margen para no volver a dormir con plazo 0
+const sf::Int64 MUSIC_END_MARGIN_US = 5000;
+
+} // namespace
+
 AudioManager::AudioManager() 
-    : isMusicEnabled(true), areSoundEffectsEnabled(true), 
-      musicVolume(50.0f), soundVolume(50.0f) {
+    : currentMusic(nullptr), isMusicEnabled(true), areSoundEffectsEnabled(true), 
+      musicVolume(50.0f), soundVolume(50.0f), isLowLatency(false), assetDirectory("assets"), isAudioThreadRunning(false),
+      isAudioThreadWaiting(false), isMusicPlaying(false), droppedCommands(0) {
+    mixer = std::make_unique<AudioMixer>();
+    mixer->SetMasterGain(soundVolume / 100.0f);
 }
 
 AudioManager::~AudioManager() {
@@ -16,91 +48,149 @@ AudioManager::~AudioManager() {
 }
 
 bool AudioManager::Initialize() {
-    // SFML Audio no requiere inicialización explícita
-    // Solo verificamos que podamos cargar los recursos
-    return LoadAudioAssets();
+    // SFML Audio no requiere inicialización explícita. Los recursos se
+    // cargan aparte con LoadAudioAssets o con QueueAssets/FinishLoading
+    // La fuente se arranca ya aquí y reproduce silencio: un efecto nunca
+    // espera a que OpenAL abra la fuente
+    if (!mixerStream) {
+        CreateMixerStream();
+    }
+    return true;
 }
 
 bool AudioManager::LoadAudioAssets() {
     return LoadGameSounds() && LoadGameMusic();
 }
 
+void AudioManager::QueueAssets(AssetLoader& loader) const {
+    // La música se abre en streaming y no necesita decodificación previa
+    for (const SoundAsset& asset : SOUND_EFFECTS) {
+        loader.AddSound(asset.name, GetFullAudioPath(asset.filename));
+    }
+}
+
+bool AudioManager::FinishLoading(const AssetLoader& loader) {
+    // Convertir las muestras ya decodificadas al formato del mezclador
+    for (const auto& asset : loader.GetAssets()) {
+        if (asset->type != AssetType::SOUND || !asset->isLoaded) continue;
+        
+        if (!mixer->AddClip(asset->name, asset->samples.data(), asset->samples.size(),
+                            asset->channelCount, asset->sampleRate)) {
+            std::cerr << "Failed to load sound effect: " << asset->path << std::endl;
+        }
+    }
+    
+    return LoadGameMusic();
+}
+
+bool AudioManager::LoadFromPack(const AssetPack& pack) {
+    for (const SoundAsset& asset : SOUND_EFFECTS) {
+        const PackEntry* entry = pack.Find(std::string("sound/") + asset.name);
+        if (!entry || entry->type != static_cast<std::uint32_t>(PackEntryType::SOUND_PCM16)) {
+            std::cerr << "Missing sound effect in asset pack: " << asset.name << std::endl;
+            continue;
+        }
+        
+        const std::int16_t* samples = reinterpret_cast<const std::int16_t*>(pack.GetEntryData(*entry));
+        if (!mixer->AddClip(asset.name, samples, entry->size / sizeof(std::int16_t), entry->width, entry->height)) {
+            std::cerr << "Failed to load sound effect: " << asset.name << std::endl;
+        }
+    }
+    
+    // La música se reproduce en streaming desde el mapeo; el pack debe seguir abierto
+    for (const SoundAsset& asset : MUSIC_TRACKS) {
+        const PackEntry* entry = pack.Find(std::string("music/") + asset.name);
+        if (!entry || entry->type != static_cast<std::uint32_t>(PackEntryType::RAW_FILE)) {
+            std::cerr << "Missing music in asset pack: " << asset.name << std::endl;
+            continue;
+        }
+        LoadMusicFromMemory(asset.name, pack.GetEntryData(*entry), static_cast<size_t>(entry->size));
+    }
+    
+    return true;
+}
+
+bool AudioManager::StartAudioThread() {
+    // Llamar después de cargar los assets: a partir de aquí solo el hilo
+    // de audio toca las pistas de música y el mezclador
+    if (isAudioThreadRunning) return true;
+    
+    // Con los clips ya cargados, dejar el mezclador listo para no reservar al disparar
+    mixer->Prewarm(mixerStream ? mixerStream->GetBufferFrames() : MixerStream::BUFFER_FRAMES);
+    
+    isAudioThreadRunning = true;
+    audioThread = std::thread(&AudioManager::RunAudioThread, this);
+    return true;
+}
+
+void AudioManager::StopAudioThread() {
+    if (!isAudioThreadRunning) return;
+    
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        isAudioThreadRunning = false;
+    }
+    wakeAudioThread.notify_one();
+    audioThread.join();
+}
+
 void AudioManager::Cleanup() {
     // SFML maneja automáticamente la limpieza de recursos
-    sounds.clear();
-    soundBuffers.clear();
+    StopAudioThread();
+    currentMusic = nullptr;
+    isMusicPlaying = false;
+    
+    if (mixerStream) {
+        mixerStream->stop();
+        mixerStream.reset();
+    }
+    mixer->RemoveAllClips();
     musicTracks.clear();
 }
 
 void AudioManager::PlayMusic(const std::string& musicName, bool loop) {
     if (!isMusicEnabled) return;
-    
-    auto it = musicTracks.find(musicName);
-    if (it != musicTracks.end()) {
-        it->second.setLoop(loop);
-        it->second.setVolume(musicVolume);
-        it->second.play();
-        currentMusic = &(it->second);
-    }
+    Post(AudioCommandType::PLAY_MUSIC, musicName, musicVolume, loop);
 }
 
 void AudioManager::StopMusic() {
-    for (auto& pair : musicTracks) {
-        pair.second.stop();
-    }
+    Post(AudioCommandType::STOP_MUSIC);
 }
 
 void AudioManager::PauseMusic() {
-    for (auto& pair : musicTracks) {
-        pair.second.pause();
-    }
+    Post(AudioCommandType::PAUSE_MUSIC);
 }
 
 void AudioManager::ResumeMusic() {
-    for (auto& pair : musicTracks) {
-        if (pair.second.getStatus() == sf::Music::Paused) {
-            pair.second.play();
-        }
-    }
+    Post(AudioCommandType::RESUME_MUSIC);
 }
 
 void AudioManager::PlaySoundEffect(const std::string& soundName) {
     if (!areSoundEffectsEnabled) return;
     
-    auto it = sounds.find(soundName);
-    if (it != sounds.end()) {
-        it->second.setVolume(soundVolume);
-        it->second.play();
-    }
+    // Cada llamada ocupa una voz propia: no reinicia la anterior
+    Post(AudioCommandType::PLAY_SOUND, soundName);
 }
 
 void AudioManager::StopSoundEffect(const std::string& soundName) {
-    auto it = sounds.find(soundName);
-    if (it != sounds.end()) {
-        it->second.stop();
-    }
+    Post(AudioCommandType::STOP_SOUND, soundName);
 }
 
 void AudioManager::StopAllSoundEffects() {
-    for (auto& pair : sounds) {
-        pair.second.stop();
-    }
+    Post(AudioCommandType::STOP_ALL_SOUNDS);
 }
 
 bool AudioManager::LoadSoundEffect(const std::string& soundName, const std::string& filename) {
     std::string fullPath = GetFullAudioPath(filename);
     
-    // Crear el soundBuffer para este sonido
-    auto bufferIt = soundBuffers.emplace(soundName, sf::SoundBuffer()).first;
-    
-    if (!bufferIt->second.loadFromFile(fullPath)) {
+    // Decodificar a PCM y registrar el clip en el mezclador
+    DecodedAsset asset(AssetType::SOUND, soundName, fullPath);
+    if (!AssetLoader::DecodeSound(asset) ||
+        !mixer->AddClip(soundName, asset.samples.data(), asset.samples.size(), asset.channelCount, asset.sampleRate)) {
         std::cerr << "Failed to load sound effect: " << filename << std::endl;
-        soundBuffers.erase(bufferIt);
         return false;
     }
     
-    // Crear el objeto Sound y asociarlo con el buffer
-    sounds[soundName].setBuffer(bufferIt->second);
     return true;
 }
 
@@ -111,7 +201,7 @@ bool AudioManager::LoadMusic(const std::string& musicName, const std::string& fi
     auto result = musicTracks.try_emplace(musicName);
     if (!result.second) {
         // Ya existe, reemplazar
-        musicTracks.erase(musicName);
+        UnloadMusic(musicName);
         result = musicTracks.try_emplace(musicName);
     }
     
@@ -124,29 +214,47 @@ bool AudioManager::LoadMusic(const std::string& musicName, const std::string& fi
     return true;
 }
 
+bool AudioManager::LoadMusicFromMemory(const std::string& musicName, const void* data, size_t size) {
+    UnloadMusic(musicName);
+    auto result = musicTracks.try_emplace(musicName);
+    
+    // sf::Music no copia los datos: deben vivir mientras se reproduce
+    if (!result.first->second.openFromMemory(data, size)) {
+        std::cerr << "Failed to load music from memory: " << musicName << std::endl;
+        musicTracks.erase(result.first);
+        return false;
+    }
+    
+    return true;
+}
+
 void AudioManager::UnloadSoundEffect(const std::string& soundName) {
-    sounds.erase(soundName);
-    soundBuffers.erase(soundName);
+    mixer->RemoveClip(soundName);
 }
 
 void AudioManager::UnloadMusic(const std::string& musicName) {
-    musicTracks.erase(musicName);
+    // Recargar una pista (p. ej. al cambiar de assets) no debe dejar currentMusic colgando
+    auto it = musicTracks.find(musicName);
+    if (it == musicTracks.end()) return;
+    
+    if (currentMusic == &it->second) {
+        currentMusic->stop();
+        currentMusic = nullptr;
+        isMusicPlaying = false;
+    }
+    musicTracks.erase(it);
 }
 
 void AudioManager::SetMusicVolume(float volume) {
     ValidateVolume(volume);
     musicVolume = volume;
-    for (auto& pair : musicTracks) {
-        pair.second.setVolume(musicVolume);
-    }
+    Post(AudioCommandType::SET_MUSIC_VOLUME, "", musicVolume);
 }
 
 void AudioManager::SetSoundVolume(float volume) {
     ValidateVolume(volume);
     soundVolume = volume;
-    for (auto& pair : sounds) {
-        pair.second.setVolume(soundVolume);
-    }
+    Post(AudioCommandType::SET_SOUND_VOLUME, "", soundVolume);
 }
 
 void AudioManager::IncreaseMusicVolume(float increment) {
@@ -199,36 +307,186 @@ void AudioManager::ToggleSoundEffects() {
     }
 }
 
-bool AudioManager::IsMusicPlaying() const {
-    for (const auto& pair : musicTracks) {
-        if (pair.second.getStatus() == sf::Music::Playing) {
-            return true;
-        }
+void AudioManager::SetLowLatencyMode(bool enabled) {
+    if (isLowLatency == enabled) return;
+    
+    isLowLatency = enabled;
+    if (mixerStream) {
+        CreateMixerStream();
+    }
+}
+
+sf::Time AudioManager::GetOutputLatency() const {
+    return mixerStream ? mixerStream->GetQueuedLatency() : sf::Time::Zero;
+}
+
+std::vector<std::pair<std::string, std::string>> AudioManager::GetMusicFiles() const {
+    std::vector<std::pair<std::string, std::string>> files;
+    for (const SoundAsset& asset : MUSIC_TRACKS) {
+        files.emplace_back(asset.name, GetFullAudioPath(asset.filename));
     }
-    return false;
+    return files;
 }
 
 // Métodos privados
 bool AudioManager::LoadGameSounds() {
-    LoadSoundEffect("eat", "comer.wav");
-    LoadSoundEffect("crash", "choque.wav");
-    LoadSoundEffect("gameover", "gameover.wav");
-    LoadSoundEffect("start", "inicio.wav");
+    for (const SoundAsset& asset : SOUND_EFFECTS) {
+        LoadSoundEffect(asset.name, asset.filename);
+    }
     
     return true; // Permitir que funcione sin archivos de audio
 }
 
 bool AudioManager::LoadGameMusic() {
-    LoadMusic("background", "musica_fondo.wav");
+    for (const SoundAsset& asset : MUSIC_TRACKS) {
+        LoadMusic(asset.name, asset.filename);
+    }
     
     return true;
 }
 
+void AudioManager::Post(AudioCommandType type, const std::string& name, float value, bool loop) {
+    AudioCommand command;
+    command.triggerTime = (type == AudioCommandType::PLAY_SOUND)
+        ? std::chrono::steady_clock::now().time_since_epoch().count() : 0;
+    command.type = type;
+    command.loop = loop;
+    command.value = value;
+    std::strncpy(command.name, name.c_str(), sizeof(command.name) - 1);
+    command.name[sizeof(command.name) - 1] = '\0';
+    
+    // Sin hilo de audio (herramientas, carga inicial) se ejecuta en el acto
+    if (!isAudioThreadRunning) {
+        Execute(command);
+        return;
+    }
+    
+    // Nunca bloquear al juego: si la cola está llena el comando se descarta
+    if (!commands.TryPush(command)) {
+        droppedCommands++;
+        return;
+    }
+    
+    // Pareja de la barrera de RunAudioThread: o aquí se ve que el hilo va a
+    // dormir, o el hilo ve el comando antes de dormirse
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (isAudioThreadWaiting.load()) {
+        // Con el mutex tomado el hilo ya está dentro de wait: el aviso no se pierde
+        { std::lock_guard<std::mutex> lock(wakeMutex); }
+        wakeAudioThread.notify_one();
+    }
+}
+
+void AudioManager::Execute(const AudioCommand& command) {
+    switch (command.type) {
+        case AudioCommandType::PLAY_SOUND:
+            Metrics::Increment(MetricCounter::AUDIO_TRIGGERS);
+            mixer->PlayClip(command.name, 1.0f, AudioMixer::TimePoint(AudioMixer::TimePoint::duration(command.triggerTime)));
+            break;
+            
+        case AudioCommandType::STOP_SOUND:
+            mixer->StopClip(command.name);
+            break;
+            
+        case AudioCommandType::STOP_ALL_SOUNDS:
+            mixer->StopAll();
+            break;
+            
+        case AudioCommandType::PLAY_MUSIC: {
+            auto it = musicTracks.find(command.name);
+            if (it == musicTracks.end()) break;
+            
+            // Solo una pista a la vez
+            if (currentMusic && currentMusic != &it->second) {
+                currentMusic->stop();
+            }
+            it->second.setLoop(command.loop);
+            it->second.setVolume(command.value);
+            it->second.play();
+            currentMusic = &(it->second);
+            break;
+        }
+        
+        case AudioCommandType::STOP_MUSIC:
+            if (currentMusic) currentMusic->stop();
+            break;
+            
+        case AudioCommandType::PAUSE_MUSIC:
+            if (currentMusic) currentMusic->pause();
+            break;
+            
+        case AudioCommandType::RESUME_MUSIC:
+            if (currentMusic && currentMusic->getStatus() == sf::Music::Paused) {
+                currentMusic->play();
+            }
+            break;
+            
+        case AudioCommandType::SET_MUSIC_VOLUME:
+            if (currentMusic) currentMusic->setVolume(command.value);
+            break;
+            
+        case AudioCommandType::SET_SOUND_VOLUME:
+            mixer->SetMasterGain(command.value / 100.0f);
+            break;
+    }
+    
+    isMusicPlaying = currentMusic && currentMusic->getStatus() == sf::Music::Playing;
+}
+
+void AudioManager::RunAudioThread() {
+    AudioCommand command;
+    
+    while (isAudioThreadRunning) {
+        while (commands.TryPop(command)) {
+            Execute(command);
+        }
+        
+        isMusicPlaying = currentMusic && currentMusic->getStatus() == sf::Music::Playing;
+        std::chrono::microseconds untilMusicEnds = GetTimeUntilMusicEnds();
+        
+        // Dormir hasta el próximo comando; solo se pone plazo si una pista sin bucle va a terminar
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        isAudioThreadWaiting = true;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto hasWork = [this]() { return !isAudioThreadRunning || !commands.IsEmpty(); };
+        if (untilMusicEnds.count() > 0) {
+            wakeAudioThread.wait_for(lock, untilMusicEnds, hasWork);
+        } else {
+            wakeAudioThread.wait(lock, hasWork);
+        }
+        isAudioThreadWaiting = false;
+    }
+    
+    // Ejecutar lo que quedara pendiente (p. ej. StopMusic al cerrar)
+    while (commands.TryPop(command)) {
+        Execute(command);
+    }
+}
+
+std::chrono::microseconds AudioManager::GetTimeUntilMusicEnds() const {
+    // Una pista sin bucle termina sola: despertar justo después para publicarlo
+    if (!currentMusic || currentMusic->getLoop() || currentMusic->getStatus() != sf::Music::Playing) {
+        return std::chrono::microseconds(0);
+    }
+    sf::Int64 remaining = currentMusic->getDuration().asMicroseconds() - currentMusic->getPlayingOffset().asMicroseconds();
+    return std::chrono::microseconds(std::max<sf::Int64>(remaining, 0) + MUSIC_END_MARGIN_US);
+}
+
+void AudioManager::CreateMixerStream() {
+    if (mixerStream) {
+        mixerStream->stop();
+    }
+    
+    size_t frames = isLowLatency ? MixerStream::LOW_LATENCY_BUFFER_FRAMES : MixerStream::BUFFER_FRAMES;
+    mixerStream = std::make_unique<MixerStream>(*mixer, frames);
+    mixerStream->play();
+}
+
 void AudioManager::ValidateVolume(float& volume) {
     if (volume < 0.0f) volume = 0.0f;
     if (volume > 100.0f) volume = 100.0f;
 }
 
 std::string AudioManager::GetFullAudioPath(const std::string& filename) const {
-    return "assets/music/" + filename;
+    return assetDirectory + "/music/" + filename;
 }
\ No newline at end of file
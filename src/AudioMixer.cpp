@@ -0,0 +1,374 @@
+#include "AudioMixer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define SNAKE_MIXER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+#ifdef SNAKE_MIXER_X86
+
+void MixVoiceSse2(float* output, const float* input, size_t sampleCount, float gain) {
+    const __m128 g = _mm_set1_ps(gain);
+
+    size_t i = 0;
+    for (; i + 8 <= sampleCount; i += 8) {
+        __m128 a = _mm_add_ps(_mm_loadu_ps(output + i), _mm_mul_ps(_mm_loadu_ps(input + i), g));
+        __m128 b = _mm_add_ps(_mm_loadu_ps(output + i + 4), _mm_mul_ps(_mm_loadu_ps(input + i + 4), g));
+        _mm_storeu_ps(output + i, a);
+        _mm_storeu_ps(output + i + 4, b);
+    }
+
+    AudioMixer::MixVoiceScalar(output + i, input + i, sampleCount - i, gain);
+}
+
+__attribute__((target("avx2,fma")))
+void MixVoiceAvx2(float* output, const float* input, size_t sampleCount, float gain) {
+    const __m256 g = _mm256_set1_ps(gain);
+
+    size_t i = 0;
+    for (; i + 16 <= sampleCount; i += 16) {
+        __m256 a = _mm256_fmadd_ps(_mm256_loadu_ps(input + i), g, _mm256_loadu_ps(output + i));
+        __m256 b = _mm256_fmadd_ps(_mm256_loadu_ps(input + i + 8), g, _mm256_loadu_ps(output + i + 8));
+        _mm256_storeu_ps(output + i, a);
+        _mm256_storeu_ps(output + i + 8, b);
+    }
+    _mm256_zeroupper();
+
+    AudioMixer::MixVoiceScalar(output + i, input + i, sampleCount - i, gain);
+}
+
+void ConvertToInt16Sse2(const float* input, std::int16_t* output, size_t sampleCount) {
+    const __m128 scale = _mm_set1_ps(32767.0f);
+
+    size_t i = 0;
+    for (; i + 8 <= sampleCount; i += 8) {
+        // cvtps redondea al más cercano; packs satura a [-32768, 32767]
+        __m128i lo = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(input + i), scale));
+        __m128i hi = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(input + i + 4), scale));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(lo, hi));
+    }
+
+    AudioMixer::ConvertToInt16Scalar(input + i, output + i, sampleCount - i);
+}
+
+__attribute__((target("avx2")))
+void ConvertToInt16Avx2(const float* input, std::int16_t* output, size_t sampleCount) {
+    const __m256 scale = _mm256_set1_ps(32767.0f);
+
+    size_t i = 0;
+    for (; i + 16 <= sampleCount; i += 16) {
+        __m256i lo = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(input + i), scale));
+        __m256i hi = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(input + i + 8), scale));
+        // packs trabaja por carriles de 128 bits: reordenar después
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), packed);
+    }
+    _mm256_zeroupper();
+
+    AudioMixer::ConvertToInt16Scalar(input + i, output + i, sampleCount - i);
+}
+
+#endif
+
+AudioMixer::MixFunction SelectMixFunction(AudioMixer::SimdLevel level) {
+#ifdef SNAKE_MIXER_X86
+    switch (level) {
+        case AudioMixer::SimdLevel::AVX2:
+            return MixVoiceAvx2;
+        case AudioMixer::SimdLevel::SSE2:
+            return MixVoiceSse2;
+        case AudioMixer::SimdLevel::SCALAR:
+            break;
+    }
+#else
+    (void)level;
+#endif
+    return AudioMixer::MixVoiceScalar;
+}
+
+AudioMixer::ConvertFunction SelectConvertFunction(AudioMixer::SimdLevel level) {
+#ifdef SNAKE_MIXER_X86
+    switch (level) {
+        case AudioMixer::SimdLevel::AVX2:
+            return ConvertToInt16Avx2;
+        case AudioMixer::SimdLevel::SSE2:
+            return ConvertToInt16Sse2;
+        case AudioMixer::SimdLevel::SCALAR:
+            break;
+    }
+#else
+    (void)level;
+#endif
+    return AudioMixer::ConvertToInt16Scalar;
+}
+
+} // namespace
+
+AudioMixer::AudioMixer()
+    : nextStartOrder(0), masterGain(1.0f), simdLevel(SimdLevel::SCALAR),
+      mixVoice(MixVoiceScalar), convertToInt16(ConvertToInt16Scalar), isLatencyTracking(false) {
+    for (Voice& voice : voices) {
+        voice = Voice{ nullptr, 0, 0.0f, 0, TimePoint() };
+    }
+    SetSimdLevel(DetectSimdLevel());
+}
+
+AudioMixer::~AudioMixer() {
+}
+
+bool AudioMixer::AddClip(const std::string& name, const std::int16_t* samples, size_t sampleCount,
+                         unsigned int channelCount, unsigned int sampleRate) {
+    if (!samples || channelCount == 0 || sampleRate == 0 || sampleCount < channelCount) {
+        std::cerr << "Invalid audio clip: " << name << std::endl;
+        return false;
+    }
+
+    // Convertir una sola vez al formato de salida (estéreo, float, 44.1 kHz)
+    const size_t sourceFrames = sampleCount / channelCount;
+    const double step = static_cast<double>(sampleRate) / OUTPUT_SAMPLE_RATE;
+    const size_t frameCount = static_cast<size_t>(sourceFrames / step);
+
+    AudioClip clip;
+    clip.frameCount = frameCount;
+    clip.samples.resize(frameCount * OUTPUT_CHANNELS);
+
+    for (size_t frame = 0; frame < frameCount; frame++) {
+        // Interpolación lineal si la frecuencia de muestreo no coincide
+        double position = frame * step;
+        size_t index = static_cast<size_t>(position);
+        size_t next = std::min(index + 1, sourceFrames - 1);
+        float fraction = static_cast<float>(position - index);
+
+        for (unsigned int channel = 0; channel < OUTPUT_CHANNELS; channel++) {
+            unsigned int sourceChannel = std::min(channel, channelCount - 1);
+            float a = samples[index * channelCount + sourceChannel];
+            float b = samples[next * channelCount + sourceChannel];
+            clip.samples[frame * OUTPUT_CHANNELS + channel] = (a + (b - a) * fraction) / 32768.0f;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = clips.find(name);
+    if (it != clips.end()) {
+        // Silenciar las voces que leen el clip que se reemplaza
+        for (Voice& voice : voices) {
+            if (voice.clip == &it->second) {
+                voice.clip = nullptr;
+            }
+        }
+        it->second = std::move(clip);
+    } else {
+        clips.emplace(name, std::move(clip));
+    }
+    return true;
+}
+
+void AudioMixer::RemoveClip(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = clips.find(name);
+    if (it == clips.end()) return;
+
+    for (Voice& voice : voices) {
+        if (voice.clip == &it->second) {
+            voice.clip = nullptr;
+        }
+    }
+    clips.erase(it);
+}
+
+void AudioMixer::RemoveAllClips() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (Voice& voice : voices) {
+        voice.clip = nullptr;
+    }
+    clips.clear();
+}
+
+bool AudioMixer::PlayClip(const std::string& name, float gain, TimePoint triggerTime) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = clips.find(name);
+    if (it == clips.end()) {
+        return false;
+    }
+
+    // Voz libre, o la que lleva más tiempo sonando
+    Voice* target = &voices[0];
+    for (Voice& voice : voices) {
+        if (!voice.clip) {
+            target = &voice;
+            break;
+        }
+        if (voice.startOrder < target->startOrder) {
+            target = &voice;
+        }
+    }
+
+    *target = Voice{ &it->second, 0, gain, nextStartOrder++, triggerTime };
+    return true;
+}
+
+void AudioMixer::StopClip(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = clips.find(name);
+    if (it == clips.end()) return;
+
+    for (Voice& voice : voices) {
+        if (voice.clip == &it->second) {
+            voice.clip = nullptr;
+        }
+    }
+}
+
+void AudioMixer::StopAll() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (Voice& voice : voices) {
+        voice.clip = nullptr;
+    }
+}
+
+void AudioMixer::Mix(std::int16_t* output, size_t frameCount) {
+    const size_t sampleCount = frameCount * OUTPUT_CHANNELS;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    accumulator.assign(sampleCount, 0.0f);
+
+    const bool trackLatency = isLatencyTracking.load(std::memory_order_relaxed);
+    TimePoint now = trackLatency ? std::chrono::steady_clock::now() : TimePoint();
+
+    for (Voice& voice : voices) {
+        if (!voice.clip) continue;
+
+        // Primer bloque de la voz: cerrar la medida petición -> entrega
+        if (trackLatency && voice.position == 0 && voice.triggerTime != TimePoint()) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - voice.triggerTime);
+            triggerLatency.Record(static_cast<std::uint64_t>(std::max<std::int64_t>(0, elapsed.count())));
+        }
+
+        size_t frames = std::min(frameCount, voice.clip->frameCount - voice.position);
+        mixVoice(accumulator.data(), voice.clip->samples.data() + voice.position * OUTPUT_CHANNELS,
+                 frames * OUTPUT_CHANNELS, voice.gain * masterGain);
+
+        voice.position += frames;
+        if (voice.position >= voice.clip->frameCount) {
+            voice.clip = nullptr;
+        }
+    }
+
+    convertToInt16(accumulator.data(), output, sampleCount);
+}
+
+void AudioMixer::Prewarm(size_t maxFrameCount) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Reservar el acumulador para que Mix nunca reserve memoria
+    accumulator.reserve(maxFrameCount * OUTPUT_CHANNELS);
+
+    // Leer cada clip una vez: sus páginas quedan residentes antes del primer disparo
+    volatile float sink = 0.0f;
+    for (const auto& entry : clips) {
+        const std::vector<float>& samples = entry.second.samples;
+        for (size_t i = 0; i < samples.size(); i += 1024) {
+            sink = sink + samples[i];
+        }
+    }
+}
+
+void AudioMixer::MixVoiceScalar(float* output, const float* input, size_t sampleCount, float gain) {
+    for (size_t i = 0; i < sampleCount; i++) {
+        output[i] += input[i] * gain;
+    }
+}
+
+void AudioMixer::ConvertToInt16Scalar(const float* input, std::int16_t* output, size_t sampleCount) {
+    for (size_t i = 0; i < sampleCount; i++) {
+        float value = std::nearbyint(input[i] * 32767.0f);
+        value = std::min(std::max(value, -32768.0f), 32767.0f);
+        output[i] = static_cast<std::int16_t>(value);
+    }
+}
+
+size_t AudioMixer::GetActiveVoiceCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t count = 0;
+    for (const Voice& voice : voices) {
+        if (voice.clip) count++;
+    }
+    return count;
+}
+
+Histogram AudioMixer::GetTriggerLatency() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return triggerLatency;
+}
+
+AudioMixer::SimdLevel AudioMixer::DetectSimdLevel() {
+#ifdef SNAKE_MIXER_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SimdLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SimdLevel::SSE2;
+    }
+#endif
+    return SimdLevel::SCALAR;
+}
+
+void AudioMixer::SetMasterGain(float gain) {
+    std::lock_guard<std::mutex> lock(mutex);
+    masterGain = std::max(gain, 0.0f);
+}
+
+void AudioMixer::SetSimdLevel(SimdLevel level) {
+    // No permitir un nivel que la CPU no soporte
+    if (static_cast<int>(level) > static_cast<int>(DetectSimdLevel())) {
+        level = DetectSimdLevel();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    simdLevel = level;
+    mixVoice = SelectMixFunction(level);
+    convertToInt16 = SelectConvertFunction(level);
+}
+
+void AudioMixer::SetLatencyTracking(bool enabled) {
+    isLatencyTracking = enabled;
+}
+
+void AudioMixer::ResetTriggerLatency() {
+    std::lock_guard<std::mutex> lock(mutex);
+    triggerLatency.Clear();
+}
+
+MixerStream::MixerStream(AudioMixer& audioMixer, size_t frames)
+    : mixer(audioMixer), buffer(std::max<size_t>(frames, 1) * AudioMixer::OUTPUT_CHANNELS),
+      bufferFrames(std::max<size_t>(frames, 1)) {
+    initialize(AudioMixer::OUTPUT_CHANNELS, AudioMixer::OUTPUT_SAMPLE_RATE);
+    mixer.Prewarm(bufferFrames);
+}
+
+MixerStream::~MixerStream() {
+    // Detener el hilo de audio antes de destruir el buffer
+    stop();
+}
+
+bool MixerStream::onGetData(Chunk& data) {
+    // Sin voces activas se entrega silencio: la fuente nunca se detiene
+    mixer.Mix(buffer.data(), bufferFrames);
+    data.samples = buffer.data();
+    data.sampleCount = buffer.size();
+    return true;
+}
+
+sf::Time MixerStream::GetQueuedLatency() const {
+    return sf::seconds(static_cast<float>(QUEUED_BUFFERS * bufferFrames) / AudioMixer::OUTPUT_SAMPLE_RATE);
+}
+
+void MixerStream::onSeek(sf::Time timeOffset) {
+    (void)timeOffset;
+}
@@ -0,0 +1,379 @@
+#include "BatchEnvironment.hpp"
+#include "Snake.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define SNAKE_BATCH_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Desplazamiento por dirección, en el orden de Direction (UP, DOWN, LEFT, RIGHT)
+const std::int32_t DIRECTION_DX[4] = { 0, 0, -1, 1 };
+const std::int32_t DIRECTION_DY[4] = { -1, 1, 0, 0 };
+
+const int FOOD_PLACEMENT_TRIES = 64;    // Después se busca la primera celda libre
+const std::int32_t STEP_COUNTER_LIMIT = 1 << 30;    // Al pasarlo se borra el tablero y se vuelve a 0
+
+// Opuestas: UP^1 = DOWN, LEFT^1 = RIGHT
+inline bool IsOppositeDirection(std::int32_t a, std::int32_t b) {
+    return (a ^ 1) == b;
+}
+
+} // namespace
+
+BatchEnvironment::BatchEnvironment(size_t count, int width, int height, const GameRules& gameRules)
+    : gridWidth(std::max(width, INITIAL_LENGTH + 1)), gridHeight(std::max(height, 1)),
+      cellCount(gridWidth * gridHeight), gameCount(count), rules(gameRules),
+      maxEpisodeTicks(DEFAULT_MAX_EPISODE_TICKS), simdLevel(DetectSimdLevel()),
+      headX(count), headY(count), directions(count), foodX(count), foodY(count),
+      pendingGrowth(count), headSteps(count), tailSteps(count), episodeStarts(count), scores(count), randomStates(count),
+      occupancy(count * static_cast<size_t>(cellCount)), rewards(count), dones(count),
+      rewardOutput(rewards.data()), doneOutput(dones.data()),
+      totalSteps(0), finishedEpisodes(0), finishedScoreSum(0) {
+    Reset(1);
+}
+
+void BatchEnvironment::Reset(std::uint64_t seed) {
+    for (size_t game = 0; game < gameCount; game++) {
+        // splitmix64: semillas de partidas vecinas sin correlación
+        std::uint64_t state = seed + (game + 1) * 0x9E3779B97F4A7C15ULL;
+        state = (state ^ (state >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        state = (state ^ (state >> 27)) * 0x94D049BB133111EBULL;
+        randomStates[game] = (state ^ (state >> 31)) | 1;
+        headSteps[game] = STEP_COUNTER_LIMIT;   // Fuerza a borrar el tablero
+        ResetGame(game);
+    }
+    std::fill(rewardOutput, rewardOutput + gameCount, 0.0f);
+    std::fill(doneOutput, doneOutput + gameCount, 0);
+    totalSteps = 0;
+    finishedEpisodes = 0;
+    finishedScoreSum = 0;
+}
+
+void BatchEnvironment::Step(const std::int8_t* actions) {
+    size_t begin = 0;
+#ifdef SNAKE_BATCH_X86
+    // El kernel indexa el tablero con enteros de 32 bits
+    if (simdLevel == SimdLevel::AVX2 && occupancy.size() <= static_cast<size_t>(std::numeric_limits<std::int32_t>::max())) {
+        begin = gameCount - gameCount % 8;
+        StepAvx2(actions, 0, begin);
+    }
+#endif
+    StepScalar(actions, begin, gameCount);
+    totalSteps += gameCount;
+}
+
+void BatchEnvironment::EncodeObservations(float* observations) const {
+    for (size_t game = 0; game < gameCount; game++) {
+        float* body = observations + game * GetObservationSize();
+        float* head = body + cellCount;
+        float* food = head + cellCount;
+        const std::int32_t* cells = &occupancy[game * cellCount];
+        const std::int32_t tail = tailSteps[game];
+
+        for (int cell = 0; cell < cellCount; cell++) {
+            body[cell] = cells[cell] > tail ? 1.0f : 0.0f;
+        }
+        std::fill(head, food + cellCount, 0.0f);
+        head[headY[game] * gridWidth + headX[game]] = 1.0f;
+        if (foodX[game] >= 0) {
+            food[foodY[game] * gridWidth + foodX[game]] = 1.0f;
+        }
+    }
+}
+
+bool BatchEnvironment::IsOccupied(size_t game, int x, int y) const {
+    if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight) return false;
+    return occupancy[game * cellCount + y * gridWidth + x] > tailSteps[game];
+}
+
+double BatchEnvironment::GetAverageFinishedScore() const {
+    return finishedEpisodes ? static_cast<double>(finishedScoreSum) / finishedEpisodes : 0.0;
+}
+
+void BatchEnvironment::SetSimdLevel(SimdLevel level) {
+    // No permitir un nivel que la CPU no soporte
+    simdLevel = (level == SimdLevel::AVX2) ? DetectSimdLevel() : SimdLevel::SCALAR;
+}
+
+void BatchEnvironment::SetOutputBuffers(float* rewardBuffer, std::uint8_t* doneBuffer) {
+    rewardOutput = rewardBuffer ? rewardBuffer : rewards.data();
+    doneOutput = doneBuffer ? doneBuffer : dones.data();
+}
+
+BatchEnvironment::SimdLevel BatchEnvironment::DetectSimdLevel() {
+#ifdef SNAKE_BATCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+#endif
+    return SimdLevel::SCALAR;
+}
+
+// Métodos privados
+void BatchEnvironment::StepScalar(const std::int8_t* actions, size_t begin, size_t end) {
+    const int growthCells = rules.multiCellGrowth ? GameRules::MULTI_CELL_GROWTH : 1;
+
+    for (size_t game = begin; game < end; game++) {
+        // Mismo orden que GameSimulation::TickWithRules: girar, mover, paredes, choque, comida
+        std::int32_t direction = directions[game];
+        if (actions && actions[game] >= 0 && actions[game] < 4 && !IsOppositeDirection(actions[game], direction)) {
+            direction = actions[game];
+            directions[game] = direction;
+        }
+
+        int x = headX[game] + DIRECTION_DX[direction];
+        int y = headY[game] + DIRECTION_DY[direction];
+        bool isDead = false;
+        if (rules.wrapWalls) {
+            x = (x + gridWidth) % gridWidth;
+            y = (y + gridHeight) % gridHeight;
+        } else {
+            isDead = x < 0 || x >= gridWidth || y < 0 || y >= gridHeight;
+        }
+
+        // La cola no avanza el tick siguiente a comer (igual que Snake::Move)
+        if (pendingGrowth[game] > 0) {
+            pendingGrowth[game]--;
+        } else {
+            tailSteps[game]++;
+        }
+        headSteps[game]++;
+
+        std::int32_t* cell = isDead ? nullptr : &occupancy[game * cellCount + y * gridWidth + x];
+        isDead = isDead || (rules.selfCollision && *cell > tailSteps[game]);
+
+        rewardOutput[game] = 0.0f;
+        doneOutput[game] = 0;
+        if (isDead) {
+            rewardOutput[game] = -1.0f;
+            FinishEpisode(game);
+            continue;
+        }
+
+        *cell = headSteps[game] + INITIAL_LENGTH;
+        headX[game] = x;
+        headY[game] = y;
+        if (x == foodX[game] && y == foodY[game]) {
+            pendingGrowth[game] += growthCells;
+            EatFood(game);
+        }
+        if (!doneOutput[game] && maxEpisodeTicks && static_cast<std::uint32_t>(GetEpisodeTicks(game)) >= maxEpisodeTicks) {
+            FinishEpisode(game);
+        }
+    }
+}
+
+#ifdef SNAKE_BATCH_X86
+__attribute__((target("avx2")))
+void BatchEnvironment::StepAvx2(const std::int8_t* actions, size_t begin, size_t end) {
+    const int growthCells = rules.multiCellGrowth ? GameRules::MULTI_CELL_GROWTH : 1;
+    const __m256i dxTable = _mm256_setr_epi32(0, 0, -1, 1, 0, 0, -1, 1);
+    const __m256i dyTable = _mm256_setr_epi32(-1, 1, 0, 0, -1, 1, 0, 0);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i allOnes = _mm256_set1_epi32(-1);
+    const __m256i three = _mm256_set1_epi32(3);
+    const __m256i maxX = _mm256_set1_epi32(gridWidth - 1);
+    const __m256i maxY = _mm256_set1_epi32(gridHeight - 1);
+    const __m256i width = _mm256_set1_epi32(gridWidth);
+    const __m256i height = _mm256_set1_epi32(gridHeight);
+    const __m256i laneOffsets = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i cells = _mm256_set1_epi32(cellCount);
+    const __m256i initialLength = _mm256_set1_epi32(INITIAL_LENGTH);
+    const __m256i tickLimit = _mm256_set1_epi32(maxEpisodeTicks ? static_cast<int>(maxEpisodeTicks) - 1
+                                                                : std::numeric_limits<int>::max());
+    const __m256i selfCollision = rules.selfCollision ? allOnes : zero;
+    const __m256 eatReward = _mm256_set1_ps(1.0f);
+    const __m256 deathReward = _mm256_set1_ps(-1.0f);
+
+    alignas(32) std::int32_t cellIndices[8];
+    alignas(32) std::int32_t stamps[8];
+
+    for (size_t game = begin; game < end; game += 8) {
+        __m256i direction = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&directions[game]));
+
+        // Giro: acción en [0, 3] y no opuesta a la dirección actual
+        if (actions) {
+            __m256i action = _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(actions + game)));
+            __m256i isValid = _mm256_andnot_si256(_mm256_cmpgt_epi32(zero, action),
+                                                  _mm256_andnot_si256(_mm256_cmpgt_epi32(action, three),
+                                                  _mm256_xor_si256(_mm256_cmpeq_epi32(_mm256_xor_si256(action, one), direction), allOnes)));
+            direction = _mm256_blendv_epi8(direction, action, isValid);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&directions[game]), direction);
+        }
+
+        __m256i x = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&headX[game])),
+                                     _mm256_permutevar8x32_epi32(dxTable, direction));
+        __m256i y = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&headY[game])),
+                                     _mm256_permutevar8x32_epi32(dyTable, direction));
+
+        __m256i isDead;
+        if (rules.wrapWalls) {
+            x = _mm256_add_epi32(x, _mm256_and_si256(_mm256_cmpgt_epi32(zero, x), width));
+            x = _mm256_sub_epi32(x, _mm256_and_si256(_mm256_cmpgt_epi32(x, maxX), width));
+            y = _mm256_add_epi32(y, _mm256_and_si256(_mm256_cmpgt_epi32(zero, y), height));
+            y = _mm256_sub_epi32(y, _mm256_and_si256(_mm256_cmpgt_epi32(y, maxY), height));
+            isDead = zero;
+        } else {
+            isDead = _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi32(zero, x), _mm256_cmpgt_epi32(x, maxX)),
+                                     _mm256_or_si256(_mm256_cmpgt_epi32(zero, y), _mm256_cmpgt_epi32(y, maxY)));
+        }
+
+        // Crecer: la cola se queda quieta y se gasta una celda pendiente
+        __m256i pending = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&pendingGrowth[game]));
+        __m256i isGrowing = _mm256_cmpgt_epi32(pending, zero);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&pendingGrowth[game]), _mm256_add_epi32(pending, isGrowing));
+        __m256i tail = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&tailSteps[game])),
+                                        _mm256_andnot_si256(isGrowing, allOnes));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&tailSteps[game]), tail);
+        __m256i head = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&headSteps[game])), one);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&headSteps[game]), head);
+
+        // Choque: una lectura (gather) de la celda destino por partida
+        __m256i gameIndex = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(game)), laneOffsets);
+        __m256i cellIndex = _mm256_add_epi32(_mm256_mullo_epi32(gameIndex, cells),
+                                             _mm256_add_epi32(_mm256_mullo_epi32(y, width), x));
+        __m256i stamp = _mm256_mask_i32gather_epi32(zero, occupancy.data(), cellIndex,
+                                                    _mm256_xor_si256(isDead, allOnes), 4);
+        isDead = _mm256_or_si256(isDead, _mm256_and_si256(_mm256_cmpgt_epi32(stamp, tail), selfCollision));
+
+        __m256i isEating = _mm256_andnot_si256(isDead, _mm256_and_si256(
+            _mm256_cmpeq_epi32(x, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&foodX[game]))),
+            _mm256_cmpeq_epi32(y, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&foodY[game])))));
+        __m256i episodeTicks = _mm256_sub_epi32(head, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&episodeStarts[game])));
+        __m256i isTruncated = _mm256_andnot_si256(isDead, _mm256_cmpgt_epi32(episodeTicks, tickLimit));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&headX[game]), x);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&headY[game]), y);
+        __m256 reward = _mm256_or_ps(_mm256_and_ps(_mm256_castsi256_ps(isEating), eatReward),
+                                     _mm256_and_ps(_mm256_castsi256_ps(isDead), deathReward));
+        _mm256_storeu_ps(&rewardOutput[game], reward);
+        std::memset(&doneOutput[game], 0, 8);
+
+        // La cabeza ocupa su celda hasta que la cola pase (no hay scatter en AVX2)
+        _mm256_store_si256(reinterpret_cast<__m256i*>(cellIndices), cellIndex);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(stamps), _mm256_add_epi32(head, initialLength));
+        int aliveMask = ~_mm256_movemask_ps(_mm256_castsi256_ps(isDead)) & 0xFF;
+        for (int lane = 0; lane < 8; lane++) {
+            if (aliveMask & (1 << lane)) {
+                occupancy[cellIndices[lane]] = stamps[lane];
+            }
+        }
+
+        // Comer, morir y el límite de ticks son raros: por partida
+        int deadMask = ~aliveMask & 0xFF;
+        int eatMask = _mm256_movemask_ps(_mm256_castsi256_ps(isEating));
+        int truncatedMask = _mm256_movemask_ps(_mm256_castsi256_ps(isTruncated));
+        int eventMask = deadMask | eatMask | truncatedMask;
+        while (eventMask) {
+            int lane = __builtin_ctz(eventMask);
+            eventMask &= eventMask - 1;
+            size_t current = game + lane;
+
+            if (eatMask & (1 << lane)) {
+                pendingGrowth[current] += growthCells;
+                EatFood(current);
+            }
+            if (!doneOutput[current] && ((deadMask | truncatedMask) & (1 << lane))) {
+                FinishEpisode(current);
+            }
+        }
+    }
+}
+#else
+void BatchEnvironment::StepAvx2(const std::int8_t* actions, size_t begin, size_t end) {
+    StepScalar(actions, begin, end);
+}
+#endif
+
+void BatchEnvironment::EatFood(size_t game) {
+    scores[game] += FOOD_SCORE;
+    rewardOutput[game] = 1.0f;
+
+    // Tablero lleno: no queda sitio para la comida y la partida termina
+    if (!PlaceFood(game)) {
+        FinishEpisode(game);
+    }
+}
+
+void BatchEnvironment::FinishEpisode(size_t game) {
+    doneOutput[game] = 1;
+    finishedEpisodes++;
+    finishedScoreSum += static_cast<std::uint64_t>(scores[game]);
+    ResetGame(game);
+}
+
+void BatchEnvironment::ResetGame(size_t game) {
+    // Ninguna celda escrita supera headSteps + INITIAL_LENGTH: empezar la cola
+    // ahí deja todo el tablero libre sin recorrerlo
+    std::int32_t* cells = &occupancy[game * cellCount];
+    std::int32_t base = headSteps[game] + INITIAL_LENGTH;
+    if (base >= STEP_COUNTER_LIMIT) {
+        std::fill(cells, cells + cellCount, 0);
+        base = 0;
+    }
+
+    // Misma salida que Snake::Reset: 3 celdas en el centro, hacia la derecha
+    int startX = gridWidth / 2;
+    int startY = gridHeight / 2;
+    headX[game] = startX;
+    headY[game] = startY;
+    directions[game] = static_cast<std::int32_t>(Direction::RIGHT);
+    pendingGrowth[game] = 0;
+    headSteps[game] = base;
+    tailSteps[game] = base;
+    episodeStarts[game] = base;
+    scores[game] = 0;
+    for (int i = 0; i < INITIAL_LENGTH; i++) {
+        // La celda de la cola (i = 2) se libera en el primer paso de la cola
+        cells[startY * gridWidth + startX - i] = base + INITIAL_LENGTH - i;
+    }
+
+    PlaceFood(game);
+}
+
+bool BatchEnvironment::PlaceFood(size_t game) {
+    const std::int32_t* cells = &occupancy[game * cellCount];
+    const std::int32_t tail = tailSteps[game];
+
+    // Con la serpiente corta casi siempre acierta al primer intento
+    for (int attempt = 0; attempt < FOOD_PLACEMENT_TRIES; attempt++) {
+        std::uint64_t random = NextRandom(game);
+        int cell = static_cast<int>((random >> 32) % static_cast<std::uint64_t>(cellCount));
+        if (cells[cell] <= tail) {
+            foodX[game] = cell % gridWidth;
+            foodY[game] = cell / gridWidth;
+            return true;
+        }
+    }
+
+    int start = static_cast<int>(NextRandom(game) % static_cast<std::uint64_t>(cellCount));
+    for (int offset = 0; offset < cellCount; offset++) {
+        int cell = (start + offset) % cellCount;
+        if (cells[cell] <= tail) {
+            foodX[game] = cell % gridWidth;
+            foodY[game] = cell / gridWidth;
+            return true;
+        }
+    }
+
+    foodX[game] = -1;
+    foodY[game] = -1;
+    return false;
+}
+
+std::uint64_t BatchEnvironment::NextRandom(size_t game) {
+    // xorshift64*: un estado por partida, sin nada compartido
+    std::uint64_t state = randomStates[game];
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    randomStates[game] = state;
+    return state * 0x2545F4914F6CDD1DULL;
+}
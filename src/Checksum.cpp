@@ -0,0 +1,69 @@
+#include "Checksum.hpp"
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define SNAKE_CHECKSUM_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// CRC32C (Castagnoli): instrucción crc32 de SSE4.2 si existe, tabla si no
+std::uint32_t ChecksumScalar(const std::uint8_t* data, size_t size, std::uint32_t crc) {
+    static const std::array<std::uint32_t, 256> table = []() {
+        std::array<std::uint32_t, 256> entries{};
+        for (std::uint32_t i = 0; i < 256; i++) {
+            std::uint32_t value = i;
+            for (int bit = 0; bit < 8; bit++) {
+                value = (value >> 1) ^ ((value & 1) ? 0x82F63B78u : 0u);
+            }
+            entries[i] = value;
+        }
+        return entries;
+    }();
+
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#ifdef SNAKE_CHECKSUM_X86
+__attribute__((target("sse4.2")))
+std::uint32_t ChecksumSse42(const std::uint8_t* data, size_t size, std::uint32_t crc) {
+    size_t i = 0;
+#if defined(__x86_64__) || defined(_M_X64)
+    std::uint64_t wide = crc;
+    for (; i + 8 <= size; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        wide = _mm_crc32_u64(wide, word);
+    }
+    crc = static_cast<std::uint32_t>(wide);
+#endif
+    for (; i < size; i++) {
+        crc = _mm_crc32_u8(crc, data[i]);
+    }
+    return crc;
+}
+#endif
+
+using ChecksumFunction = std::uint32_t (*)(const std::uint8_t* data, size_t size, std::uint32_t crc);
+
+ChecksumFunction SelectChecksum() {
+#ifdef SNAKE_CHECKSUM_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2")) {
+        return ChecksumSse42;
+    }
+#endif
+    return ChecksumScalar;
+}
+
+} // namespace
+
+std::uint32_t Checksum::Crc32c(const void* data, size_t size, std::uint32_t crc) {
+    static const ChecksumFunction checksum = SelectChecksum();
+    return ~checksum(static_cast<const std::uint8_t*>(data), size, ~crc);
+}
@@ -0,0 +1,106 @@
+#include "ConfigWatcher.hpp"
+#include <iostream>
+
+#ifdef __linux__
+#define CONFIG_WATCHER_USE_INOTIFY 1
+#include <cerrno>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+ConfigWatcher::ConfigWatcher() : inotifyFd(-1), isWatching(false) {
+}
+
+ConfigWatcher::~ConfigWatcher() {
+    Stop();
+}
+
+bool ConfigWatcher::Start(const std::string& configPath) {
+    Stop();
+
+    std::filesystem::path filePath(configPath);
+    path = configPath;
+    fileName = filePath.filename().string();
+
+    std::error_code error;
+    lastWriteTime = std::filesystem::last_write_time(filePath, error);
+    nextPollTime = std::chrono::steady_clock::now() + POLL_INTERVAL;
+
+#ifdef CONFIG_WATCHER_USE_INOTIFY
+    // Se vigila el directorio: un guardado por renombrado cambia el inodo del archivo
+    std::string directory = filePath.has_parent_path() ? filePath.parent_path().string() : ".";
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0 || inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        std::cerr << "Failed to watch config directory with inotify: " << directory
+                  << ", polling instead" << std::endl;
+        if (inotifyFd >= 0) {
+            close(inotifyFd);
+            inotifyFd = -1;
+        }
+    }
+#endif
+
+    isWatching = true;
+    return true;
+}
+
+void ConfigWatcher::Stop() {
+#ifdef CONFIG_WATCHER_USE_INOTIFY
+    if (inotifyFd >= 0) {
+        close(inotifyFd);
+    }
+#endif
+    inotifyFd = -1;
+    isWatching = false;
+}
+
+bool ConfigWatcher::HasChanged() {
+    if (!isWatching) return false;
+    return IsUsingInotify() ? HasChangedInotify() : HasChangedPolling();
+}
+
+// Métodos privados
+bool ConfigWatcher::HasChangedInotify() {
+#ifdef CONFIG_WATCHER_USE_INOTIFY
+    // Sin eventos pendientes esto es un read que devuelve EAGAIN
+    alignas(inotify_event) char buffer[4096];
+    bool hasChanged = false;
+
+    while (true) {
+        ssize_t length = read(inotifyFd, buffer, sizeof(buffer));
+        if (length <= 0) {
+            if (length < 0 && errno != EAGAIN && errno != EINTR) {
+                std::cerr << "Failed to read inotify events, polling instead" << std::endl;
+                close(inotifyFd);
+                inotifyFd = -1;
+            }
+            break;
+        }
+
+        for (char* cursor = buffer; cursor < buffer + length;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(cursor);
+            if (event->len > 0 && fileName == event->name) {
+                hasChanged = true;
+            }
+            cursor += sizeof(inotify_event) + event->len;
+        }
+    }
+
+    return hasChanged;
+#else
+    return false;
+#endif
+}
+
+bool ConfigWatcher::HasChangedPolling() {
+    auto now = std::chrono::steady_clock::now();
+    if (now < nextPollTime) return false;
+    nextPollTime = now + POLL_INTERVAL;
+
+    std::error_code error;
+    auto writeTime = std::filesystem::last_write_time(path, error);
+    if (error || writeTime == lastWriteTime) return false;
+
+    lastWriteTime = writeTime;
+    return true;
+}
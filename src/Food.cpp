@@ -8,16 +8,18 @@
 #include <SFML/Audio.hpp>
 #include <SFML/Network.hpp>
 
-Food::Food() : position(0, 0), isActive(true), nutritionalValue(10) {
+Food::Food() : position(0, 0), isActive(true), nutritionalValue(10), randomEngine(std::random_device{}()) {
 }
 
 Food::~Food() {
     // Destructor vacío, SFML maneja automáticamente los recursos
 }
 
+void Food::Seed(std::uint32_t seed) {
+    randomEngine.seed(seed);
+}
+
 void Food::GenerateNewPosition(int gridWidth, int gridHeight, const Snake& snake) {
-    std::random_device rd;
-    std::mt19937 gen(rd());
     std::uniform_int_distribution<> distX(0, gridWidth - 1);
     std::uniform_int_distribution<> distY(0, gridHeight - 1);
     
@@ -26,8 +28,8 @@ void Food::GenerateNewPosition(int gridWidth, int gridHeight, const Snake& snake
     
     // Keep generating positions until we find one not occupied by the snake
     while (!validPosition) {
-        newPos.x = distX(gen);
-        newPos.y = distY(gen);
+        newPos.x = distX(randomEngine);
+        newPos.y = distY(randomEngine);
         
         validPosition = true;
         
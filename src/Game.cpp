@@ -1,28 +1,42 @@
 #include "Game.hpp"
-#include "Snake.hpp"
-#include "Food.hpp"
+#include "GameSimulation.hpp"
 #include "GameRenderer.hpp"
 #include "AudioManager.hpp"
 #include "InputHandler.hpp"
+#include "InputSource.hpp"
+#include "Metrics.hpp"
+#include "AssetLoader.hpp"
+#include "AssetPack.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <filesystem>
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
 #include <SFML/Audio.hpp>
 #include <SFML/Network.hpp>
 
-Game::Game() 
-    : window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "Snake Game - C++ SFML Project"),
-      isRunning(false), gameOver(false), gameStarted(false), score(0) {
+Game::Game(const GameConfig& gameConfig) 
+    : config(gameConfig),
+      window(sf::VideoMode(config.windowWidth, config.windowHeight), "Snake Game - C++ SFML Project"),
+      isRunning(false), gameOver(false), gameStarted(false), lastRank(0), keyboardInput(nullptr),
+      metricsPortOverride(-1), isAudioLatencyReport(false), isInputLatencyReport(false) {
     // Inicializar componentes usando smart pointers
-    snake = std::make_unique<Snake>(GRID_WIDTH / 2, GRID_HEIGHT / 2);
-    food = std::make_unique<Food>();
+    simulation = std::make_unique<GameSimulation>(config.GetGridWidth(), config.GetGridHeight());
     renderer = std::make_unique<GameRenderer>();
     audioManager = std::make_unique<AudioManager>();
     inputHandler = std::make_unique<InputHandler>();
+    replayWriter = std::make_unique<ThreadPool>(1);
+    SetInputSource(nullptr);
     
-    // Configurar ventana
-    window.setFramerateLimit(60);
+    renderer->SetGridSize(config.cellSize);
+    renderer->SetLayout(config.windowWidth, config.windowHeight, config.gameAreaMargin);
+    renderer->SetAssetDirectory(config.assetDirectory);
+    audioManager->SetAssetDirectory(config.assetDirectory);
+    
+    // Configurar ventana (Run limita los frames por su cuenta)
     window.setKeyRepeatEnabled(false);
 }
 
@@ -43,20 +57,28 @@ bool Game::Initialize() {
     }
     
     inputHandler->Initialize(this);
+    ApplyLiveSettings();
     
-    // Cargar assets
-    if (!renderer->LoadAssets()) {
-        std::cerr << "Failed to load renderer assets!" << std::endl;
+    // Cargar assets (imágenes y sonidos en paralelo)
+    if (!LoadAssetsWithProgress()) {
+        std::cerr << "Failed to load assets!" << std::endl;
         return false;
     }
     
-    if (!audioManager->LoadAudioAssets()) {
-        std::cerr << "Failed to load audio assets!" << std::endl;
-        return false;
+    // A partir de aquí el audio se atiende fuera del hilo del juego
+    audioManager->StartAudioThread();
+    
+    // Sin almacén se juega igual; solo no se guardan las puntuaciones
+    if (!scoreStore.Open()) {
+        std::cerr << "Scores will not be saved" << std::endl;
+    } else {
+        leaderboard.Build(scoreStore.GetRecords());
     }
     
+    StartMetricsServer();
+    
     // Generar posición inicial de la comida
-    food->GenerateNewPosition(GRID_WIDTH, GRID_HEIGHT, *snake);
+    BeginNewRound();
     
     isRunning = true;
     return true;
@@ -65,28 +87,47 @@ bool Game::Initialize() {
 void Game::Run() {
     audioManager->PlayMusic("background");
     
-    sf::Clock clock;
-    const sf::Time timePerFrame = sf::seconds(1.0f / 10.0f); // 10 FPS para Snake
-    sf::Time timeSinceLastUpdate = sf::Time::Zero;
+    // Los ticks siguen a tickScheduler y los frames a su propio reloj; el
+    // bucle duerme hasta el próximo de los dos (y solo afina la espera
+    // con espera activa cuando lo próximo es un tick)
+    const auto frameInterval = std::chrono::microseconds(1000000 / FRAMES_PER_SECOND);
+    auto nextFrame = std::chrono::steady_clock::now();
+    tickScheduler.Start();
     
     while (window.isOpen() && isRunning) {
-        sf::Time elapsedTime = clock.restart();
-        timeSinceLastUpdate += elapsedTime;
-        
         // Procesar eventos
         HandleEvents();
         
-        // Actualizar juego a velocidad fija
-        while (timeSinceLastUpdate > timePerFrame) {
-            timeSinceLastUpdate -= timePerFrame;
-            
+        // Actualizar juego al ritmo del planificador (ticks de recuperación acotados)
+        int dueTicks = tickScheduler.CollectDueTicks();
+        
+        // Un cambio en el archivo de configuración se aplica entre ticks, en este hilo
+        if (dueTicks > 0 && configWatcher.HasChanged()) {
+            ReloadConfig();
+        }
+        for (int i = 0; i < dueTicks; i++) {
             if (gameStarted && !gameOver) {
                 Update();
             }
         }
+        tickScheduler.SetScore(GetScore());
         
         // Renderizar
-        Render();
+        auto now = std::chrono::steady_clock::now();
+        if (now >= nextFrame) {
+            Render();
+            nextFrame = std::max(nextFrame + frameInterval, now);
+        }
+        
+        bool isTickNext = tickScheduler.GetNextTickTime() <= nextFrame;
+        tickScheduler.WaitUntil(isTickNext ? tickScheduler.GetNextTickTime() : nextFrame, isTickNext);
+    }
+    
+    if (isAudioLatencyReport) {
+        PrintAudioLatencyReport();
+    }
+    if (isInputLatencyReport) {
+        PrintInputLatencyReport();
     }
 }
 
@@ -97,42 +138,58 @@ void Game::HandleEvents() {
 void Game::Update() {
     if (gameOver) return;
     
-    snake->Update();
-    food->Update();
+    auto tickStart = std::chrono::steady_clock::now();
+    ApplyInput();
     
-    // Verificar colisiones
-    if (snake->CheckWallCollision(GRID_WIDTH, GRID_HEIGHT) || 
-        snake->CheckSelfCollision()) {
-        EndGame();
-        return;
+    switch (simulation->Tick()) {
+        case TickResult::HIT_WALL:
+            Metrics::Increment(MetricCounter::DEATHS_WALL);
+            EndGame();
+            break;
+            
+        case TickResult::HIT_SELF:
+            Metrics::Increment(MetricCounter::DEATHS_SELF);
+            EndGame();
+            break;
+            
+        case TickResult::ATE_FOOD:
+            Metrics::Increment(MetricCounter::FOOD_EATEN);
+            audioManager->PlaySoundEffect("eat");
+            break;
+            
+        case TickResult::BOARD_FILLED:
+            Metrics::Increment(MetricCounter::FOOD_EATEN);
+            audioManager->PlaySoundEffect("eat");
+            EndGame();
+            break;
+            
+        case TickResult::NONE:
+            break;
     }
     
-    // Verificar si la serpiente comió la comida
-    if (food->IsEatenBy(*snake)) {
-        snake->Grow();
-        AddScore(food->GetNutritionalValue());
-        audioManager->PlaySoundEffect("eat");
-        food->GenerateNewPosition(GRID_WIDTH, GRID_HEIGHT, *snake);
-    }
+    Metrics::Increment(MetricCounter::TICKS);
+    Metrics::Observe(MetricHistogram::TICK_TIME, static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - tickStart).count()));
 }
 
 void Game::Render() {
+    auto frameStart = std::chrono::steady_clock::now();
     renderer->Clear();
     
     if (!gameStarted) {
         renderer->RenderStartScreen();
     } else if (gameOver) {
-        renderer->RenderGameOverScreen();
-        renderer->RenderScore(score);
+        renderer->RenderGameOverScreen(lastRank, leaderboard.GetCount());
+        renderer->RenderScore(GetScore());
     } else {
-        renderer->RenderBackground();
-        renderer->RenderGameBounds();  // Renderizar límites del área de juego
-        renderer->RenderFood(*food);
-        renderer->RenderSnake(*snake);
-        renderer->RenderScore(score);
+        renderer->RenderPlayfield(simulation->GetSnake(), simulation->GetFood(), GetScore());
     }
     
     renderer->Present();
+    
+    Metrics::Increment(MetricCounter::FRAMES);
+    Metrics::Observe(MetricHistogram::FRAME_TIME, static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - frameStart).count()));
 }
 
 void Game::StartGame() {
@@ -146,14 +203,31 @@ void Game::StartGame() {
 void Game::RestartGame() {
     gameOver = false;
     gameStarted = false;
-    ResetScore();
-    snake->Reset(GRID_WIDTH / 2, GRID_HEIGHT / 2);
-    food->GenerateNewPosition(GRID_WIDTH, GRID_HEIGHT, *snake);
+    BeginNewRound();
     audioManager->StopMusic();
 }
 
 void Game::EndGame() {
     gameOver = true;
+    
+    // Guardar la grabación para poder exportarla después; el hilo de
+    // grabaciones escribe una copia y el bucle no espera al disco
+    replay.Finish(simulation->GetTickCount());
+    if (replayWriter) {
+        replayWriter->Submit([finishedReplay = replay]() {
+            std::error_code error;
+            std::filesystem::create_directories("replays", error);
+            finishedReplay.SaveToFile("replays/last_game.replay");
+        });
+    }
+    
+    // Solo encola: el hilo de volcado del almacén hace la escritura y el fdatasync
+    if (scoreStore.IsOpen()) {
+        scoreStore.Add(GetScore(), static_cast<std::uint32_t>(simulation->GetTickCount()), simulation->GetSeed());
+        leaderboard.Insert(GetScore());
+        lastRank = leaderboard.GetRank(GetScore());
+    }
+    
     audioManager->StopMusic();
     audioManager->PlaySoundEffect("crash");
     audioManager->PlaySoundEffect("gameover");
@@ -168,16 +242,74 @@ void Game::ResumeGame() {
 }
 
 void Game::AddScore(int points) {
-    score += points;
+    simulation->AddScore(points);
 }
 
 void Game::ResetScore() {
-    score = 0;
+    simulation->ResetScore();
+}
+
+int Game::GetScore() const {
+    return simulation->GetScore();
+}
+
+void Game::SetTextureMemoryBudget(size_t bytes) {
+    renderer->SetTextureMemoryBudget(bytes);
+}
+
+void Game::SetLowLatencyAudio(bool enabled) {
+    audioManager->SetLowLatencyMode(enabled);
+}
+
+void Game::SetAudioLatencyReport(bool enabled) {
+    isAudioLatencyReport = enabled;
+    audioManager->GetMixer()->SetLatencyTracking(enabled);
+}
+
+void Game::SetMetricsPort(int port) {
+    metricsPortOverride = port;
+    config.metricsPort = port;
+}
+
+void Game::SetRules(const GameRules& rules) {
+    // Se aplica desde la próxima partida: cambiar tickFunction a mitad de una
+    // dejaría la grabación con reglas que no son las de los ticks ya jugados
+    nextRules = rules;
+}
+
+void Game::SetInputSource(std::unique_ptr<InputSource> source) {
+    // Sin fuente explícita se vuelve al teclado
+    if (source) {
+        keyboardInput = nullptr;
+        inputSource = std::move(source);
+    } else {
+        auto keyboard = std::make_unique<KeyboardInputSource>();
+        keyboardInput = keyboard.get();
+        inputSource = std::move(keyboard);
+    }
+}
+
+void Game::CycleTickMode() {
+    // Normal -> turbo -> cámara lenta -> normal (el avance rápido es solo por línea de comandos)
+    switch (tickScheduler.GetMode()) {
+        case TickMode::NORMAL:
+            tickScheduler.SetMode(TickMode::TURBO);
+            break;
+        case TickMode::TURBO:
+            tickScheduler.SetMode(TickMode::SLOW_MOTION);
+            break;
+        case TickMode::SLOW_MOTION:
+        case TickMode::FAST_FORWARD:
+            tickScheduler.SetMode(TickMode::NORMAL);
+            break;
+    }
 }
 
 void Game::ChangeSnakeDirection(Direction direction) {
-    if (snake && gameStarted && !gameOver) {
-        snake->ChangeDirection(direction);
+    // Solo se encola: Update aplica un giro por tick. Con otra fuente
+    // de entrada (bot, guion) las teclas de dirección no tienen efecto
+    if (keyboardInput && gameStarted && !gameOver) {
+        keyboardInput->Push(direction, std::chrono::steady_clock::now());
     }
 }
 
@@ -194,7 +326,180 @@ void Game::Cleanup() {
         inputHandler->Cleanup();
     }
     
+    scoreStore.Close();
+    metricsServer.Stop();
+    
+    // El destructor del pool termina de escribir la última grabación
+    replayWriter.reset();
+    
     if (window.isOpen()) {
         window.close();
     }
-}
\ No newline at end of file
+}
+
+// Métodos privados
+void Game::BeginNewRound() {
+    // Nuevas reglas y semilla por partida; quedan guardadas en la grabación
+    simulation->SetRules(nextRules);
+    simulation->Reset(GameSimulation::GenerateSeed());
+    replay.Begin(config.GetGridWidth(), config.GetGridHeight(), simulation->GetSeed(), simulation->GetRules());
+    inputSource->Reset();
+}
+
+void Game::ApplyInput() {
+    // Se graba en el tick en que se aplica, así la reproducción es exacta
+    std::uint64_t tick = simulation->GetTickCount();
+    DirectionInput input;
+    if (!inputSource->Apply(*simulation, input)) return;
+    
+    replay.RecordDirection(tick, input.direction);
+    
+    // Solo las entradas del teclado traen marca de tiempo
+    if (input.timestamp != std::chrono::steady_clock::time_point()) {
+        auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - input.timestamp);
+        inputLatency.Record(static_cast<std::uint64_t>(latency.count()));
+    }
+}
+
+bool Game::LoadAssetsWithProgress() {
+    // Con pack precompilado (make pack) no hay nada que decodificar. Es opcional: un
+    // pack viejo taparía los archivos sueltos editados y los cambios de assets.directory
+    if (!config.assetPackPath.empty()) {
+        auto pack = std::make_unique<AssetPack>();
+        if (pack->Open(config.assetPackPath)) {
+            std::cout << "Loading assets from pack " << config.assetPackPath << std::endl;
+            bool rendererLoaded = renderer->LoadFromPack(*pack);
+            bool audioLoaded = audioManager->LoadFromPack(*pack);
+            assetPack = std::move(pack);
+            return rendererLoaded && audioLoaded;
+        }
+        std::cerr << "Falling back to unpacked assets" << std::endl;
+    }
+    std::cout << "Loading assets from " << config.assetDirectory << std::endl;
+    
+    // Los workers decodifican y reducen cada imagen al tamaño con el que se dibuja:
+    // en memoria solo quedan las copias reducidas y el render no toca disco
+    AssetLoader loader;
+    loader.SetDownscaleImages(true);
+    renderer->QueueAssets(loader);
+    audioManager->QueueAssets(loader);
+    
+    // El pool se destruye antes que el loader y espera las tareas pendientes
+    ThreadPool pool(ThreadPool::GetDefaultThreadCount());
+    loader.Start(pool);
+    
+    // Pantalla de carga mientras los workers decodifican
+    while (!loader.IsFinished()) {
+        sf::Event event;
+        while (window.pollEvent(event)) {
+            if (event.type == sf::Event::Closed) {
+                window.close();
+                return false;
+            }
+        }
+        
+        renderer->RenderLoadingScreen(loader.GetProgress());
+        renderer->Present();
+        loader.WaitFor(std::chrono::milliseconds(16));
+    }
+    
+    // Texturas y buffers de audio se crean en el hilo de la ventana
+    bool rendererLoaded = renderer->FinishLoading(loader);
+    bool audioLoaded = audioManager->FinishLoading(loader);
+    
+    // Las pistas ya se abrieron desde archivos: un pack anterior deja de usarse
+    assetPack.reset();
+    return rendererLoaded && audioLoaded;
+}
+
+void Game::ApplyLiveSettings() {
+    // Lo que puede cambiar sin reiniciar: ritmo, volúmenes y teclas
+    tickScheduler.SetBaseInterval(std::chrono::milliseconds(config.tickIntervalMs));
+    tickScheduler.SetSpeedRamp(std::chrono::microseconds(config.tickRampStepUs),
+                               std::chrono::milliseconds(config.minTickIntervalMs));
+    audioManager->SetMusicVolume(config.musicVolume);
+    audioManager->SetSoundVolume(config.soundVolume);
+    inputHandler->ApplyKeyBindings(config.keyBindings);
+}
+
+void Game::ReloadConfig() {
+    // Se parte de los valores por defecto: borrar una línea la devuelve a su valor original
+    GameConfig updated;
+    if (!GameConfig::LoadFromFile(configWatcher.GetPath(), updated)) {
+        std::cerr << "Keeping previous configuration" << std::endl;
+        return;
+    }
+    
+    if (!updated.HasSameLayout(config)) {
+        std::cerr << "Window and grid settings apply on next start" << std::endl;
+        updated.windowWidth = config.windowWidth;
+        updated.windowHeight = config.windowHeight;
+        updated.cellSize = config.cellSize;
+        updated.gameAreaMargin = config.gameAreaMargin;
+    }
+    
+    // Las opciones de línea de comandos se superponen a cada recarga
+    if (metricsPortOverride >= 0) {
+        updated.metricsPort = metricsPortOverride;
+    }
+    
+    bool hasNewAssets = !updated.HasSameAssets(config);
+    bool hasNewMetricsPort = updated.metricsPort != config.metricsPort;
+    config = updated;
+    ApplyLiveSettings();
+    if (hasNewAssets) {
+        ReloadAssets();
+    }
+    if (hasNewMetricsPort) {
+        StartMetricsServer();
+    }
+    
+    std::cout << "Reloaded configuration from " << configWatcher.GetPath() << std::endl;
+}
+
+void Game::StartMetricsServer() {
+    // Sin endpoint se juega igual; las métricas se siguen registrando
+    metricsServer.Stop();
+    if (config.metricsPort > 0 && metricsServer.Start(config.metricsPort)) {
+        std::cout << "Serving metrics on http://127.0.0.1:" << metricsServer.GetPort() << "/metrics" << std::endl;
+    }
+}
+
+void Game::ReloadAssets() {
+    // Sin hilo de audio los clips y las pistas se reemplazan sin carreras
+    audioManager->StopAudioThread();
+    audioManager->StopAllSoundEffects();
+    
+    renderer->SetAssetDirectory(config.assetDirectory);
+    audioManager->SetAssetDirectory(config.assetDirectory);
+    if (!LoadAssetsWithProgress()) {
+        std::cerr << "Failed to reload assets from " << config.assetDirectory << std::endl;
+    }
+    
+    audioManager->StartAudioThread();
+    if (!gameOver) {
+        audioManager->PlayMusic("background");
+    }
+    
+    // La pantalla de carga no cuenta como ticks atrasados
+    tickScheduler.Start();
+}
+
+void Game::PrintAudioLatencyReport() const {
+    // Petición del efecto -> primer bloque entregado a OpenAL, más la cola de SFML
+    std::cout << "Sound effect trigger latency (until first block is submitted):" << std::endl;
+    audioManager->GetMixer()->GetTriggerLatency().Print(std::cout, "us");
+    std::cout << "Stream queue adds up to " << audioManager->GetOutputLatency().asMilliseconds()
+              << " ms before the block is heard" << (audioManager->IsLowLatencyMode() ? " (low latency mode)" : "")
+              << std::endl;
+}
+
+void Game::PrintInputLatencyReport() const {
+    std::cout << "Direction input latency (key read -> tick that applies it):" << std::endl;
+    inputLatency.Print(std::cout, "us");
+    if (keyboardInput) {
+        const InputQueue& queue = keyboardInput->GetQueue();
+        std::cout << "Dropped (queue full): " << queue.GetDroppedCount()
+                  << ", discarded (repeated or reversed): " << queue.GetDiscardedCount() << std::endl;
+    }
+}
@@ -0,0 +1,253 @@
+#include "GameConfig.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace {
+
+struct NamedKey {
+    const char* name;
+    sf::Keyboard::Key key;
+};
+
+// Teclas con nombre propio; letras, dígitos y F1-F12 se resuelven aparte
+const NamedKey NAMED_KEYS[] = {
+    { "Escape", sf::Keyboard::Escape },
+    { "Space", sf::Keyboard::Space },
+    { "Enter", sf::Keyboard::Enter },
+    { "Tab", sf::Keyboard::Tab },
+    { "Up", sf::Keyboard::Up },
+    { "Down", sf::Keyboard::Down },
+    { "Left", sf::Keyboard::Left },
+    { "Right", sf::Keyboard::Right },
+    { "LShift", sf::Keyboard::LShift },
+    { "RShift", sf::Keyboard::RShift },
+    { "LControl", sf::Keyboard::LControl },
+    { "RControl", sf::Keyboard::RControl },
+    { "LAlt", sf::Keyboard::LAlt },
+    { "RAlt", sf::Keyboard::RAlt },
+};
+
+struct NamedCommand {
+    const char* name;
+    KeyCommand command;
+};
+
+const NamedCommand KEY_COMMANDS[] = {
+    { "up", KeyCommand::UP },
+    { "down", KeyCommand::DOWN },
+    { "left", KeyCommand::LEFT },
+    { "right", KeyCommand::RIGHT },
+    { "start", KeyCommand::START },
+    { "pause", KeyCommand::PAUSE },
+    { "tick_mode", KeyCommand::TICK_MODE },
+    { "quit", KeyCommand::QUIT },
+};
+
+std::string Trim(const std::string& text) {
+    size_t begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) return "";
+    size_t end = text.find_last_not_of(" \t\r");
+    return text.substr(begin, end - begin + 1);
+}
+
+bool ParseInt(const std::string& text, int minimum, int maximum, int& value) {
+    char* end = nullptr;
+    long parsed = std::strtol(text.c_str(), &end, 10);
+    if (text.empty() || *end != '\0' || parsed < minimum || parsed > maximum) {
+        return false;
+    }
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+bool ParseFloat(const std::string& text, float minimum, float maximum, float& value) {
+    char* end = nullptr;
+    float parsed = std::strtof(text.c_str(), &end);
+    // "nan" no cumple ninguna comparación: sin esta comprobación pasaría el rango
+    if (text.empty() || *end != '\0' || !std::isfinite(parsed) || parsed < minimum || parsed > maximum) {
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+// "W, Up" -> asignaciones de la orden; sustituyen a las que tuviera
+bool ParseKeyList(const std::string& text, KeyCommand command, std::vector<KeyBindingConfig>& bindings) {
+    std::vector<KeyBindingConfig> parsed;
+    std::istringstream fields(text);
+    std::string name;
+
+    while (std::getline(fields, name, ',')) {
+        sf::Keyboard::Key key;
+        if (!GameConfig::ParseKey(Trim(name), key)) {
+            return false;
+        }
+        parsed.push_back(KeyBindingConfig{ key, command });
+    }
+
+    bindings.erase(std::remove_if(bindings.begin(), bindings.end(), [command](const KeyBindingConfig& binding) {
+        return binding.command == command;
+    }), bindings.end());
+    bindings.insert(bindings.end(), parsed.begin(), parsed.end());
+    return true;
+}
+
+} // namespace
+
+GameConfig::GameConfig()
+    : windowWidth(1200), windowHeight(900), cellSize(20), gameAreaMargin(100),
+      tickIntervalMs(100), tickRampStepUs(100), minTickIntervalMs(50),
+      musicVolume(50.0f), soundVolume(50.0f),
+      assetDirectory("assets"), assetPackPath(""), metricsPort(0),
+      keyBindings(GetDefaultKeyBindings()) {
+}
+
+bool GameConfig::LoadFromFile(const std::string& path, GameConfig& config) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Failed to open config: " << path << std::endl;
+        return false;
+    }
+
+    // Se valida el archivo entero antes de tocar config: un guardado a
+    // medias no deja la configuración en un estado mixto
+    GameConfig parsed;
+    std::string section;
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(file, line)) {
+        lineNumber++;
+        line = Trim(line.substr(0, line.find('#')));
+        if (line.empty()) continue;
+
+        if (line.front() == '[' && line.back() == ']') {
+            section = Trim(line.substr(1, line.size() - 2));
+            continue;
+        }
+
+        size_t separator = line.find('=');
+        if (separator == std::string::npos) {
+            std::cerr << "Invalid config line " << path << ":" << lineNumber << ": " << line << std::endl;
+            return false;
+        }
+
+        std::string key = section + "." + Trim(line.substr(0, separator));
+        std::string value = Trim(line.substr(separator + 1));
+        bool isValid = true;
+
+        if (key == "window.width") {
+            isValid = ParseInt(value, 320, 7680, parsed.windowWidth);
+        } else if (key == "window.height") {
+            isValid = ParseInt(value, 240, 4320, parsed.windowHeight);
+        } else if (key == "grid.cell_size") {
+            isValid = ParseInt(value, 4, 256, parsed.cellSize);
+        } else if (key == "grid.margin") {
+            isValid = ParseInt(value, 0, 1000, parsed.gameAreaMargin);
+        } else if (key == "tick.interval_ms") {
+            isValid = ParseInt(value, 1, 10000, parsed.tickIntervalMs);
+        } else if (key == "tick.ramp_step_us") {
+            isValid = ParseInt(value, 0, 1000000, parsed.tickRampStepUs);
+        } else if (key == "tick.min_interval_ms") {
+            isValid = ParseInt(value, 1, 10000, parsed.minTickIntervalMs);
+        } else if (key == "audio.music_volume") {
+            isValid = ParseFloat(value, 0.0f, 100.0f, parsed.musicVolume);
+        } else if (key == "audio.sound_volume") {
+            isValid = ParseFloat(value, 0.0f, 100.0f, parsed.soundVolume);
+        } else if (key == "assets.directory") {
+            parsed.assetDirectory = value;
+            isValid = !value.empty();
+        } else if (key == "assets.pack") {
+            parsed.assetPackPath = value;
+        } else if (key == "metrics.port") {
+            isValid = ParseInt(value, 0, 65535, parsed.metricsPort);
+        } else if (section == "keys") {
+            const NamedCommand* command = std::find_if(std::begin(KEY_COMMANDS), std::end(KEY_COMMANDS),
+                [&](const NamedCommand& entry) { return key == std::string("keys.") + entry.name; });
+            if (command == std::end(KEY_COMMANDS)) {
+                std::cerr << "Unknown key command in " << path << ":" << lineNumber << ": " << key << std::endl;
+                continue;
+            }
+            isValid = ParseKeyList(value, command->command, parsed.keyBindings);
+        } else {
+            // Claves desconocidas no invalidan el archivo (versiones más nuevas)
+            std::cerr << "Unknown config key in " << path << ":" << lineNumber << ": " << key << std::endl;
+            continue;
+        }
+
+        if (!isValid) {
+            std::cerr << "Invalid config value " << path << ":" << lineNumber << ": " << key << " = " << value << std::endl;
+            return false;
+        }
+    }
+
+    if (parsed.GetGridWidth() < 4 || parsed.GetGridHeight() < 4) {
+        std::cerr << "Invalid config: board smaller than 4x4 cells in " << path << std::endl;
+        return false;
+    }
+
+    config = parsed;
+    return true;
+}
+
+bool GameConfig::ParseKey(const std::string& name, sf::Keyboard::Key& key) {
+    for (const NamedKey& entry : NAMED_KEYS) {
+        if (name == entry.name) {
+            key = entry.key;
+            return true;
+        }
+    }
+
+    // A-Z, Num0-Num9, Numpad0-Numpad9 y F1-F12 son consecutivas en sf::Keyboard
+    if (name.size() == 1 && std::isupper(static_cast<unsigned char>(name[0]))) {
+        key = static_cast<sf::Keyboard::Key>(sf::Keyboard::A + (name[0] - 'A'));
+        return true;
+    }
+    if (name.size() == 4 && name.compare(0, 3, "Num") == 0 && std::isdigit(static_cast<unsigned char>(name[3]))) {
+        key = static_cast<sf::Keyboard::Key>(sf::Keyboard::Num0 + (name[3] - '0'));
+        return true;
+    }
+    if (name.size() == 7 && name.compare(0, 6, "Numpad") == 0 && std::isdigit(static_cast<unsigned char>(name[6]))) {
+        key = static_cast<sf::Keyboard::Key>(sf::Keyboard::Numpad0 + (name[6] - '0'));
+        return true;
+    }
+    int function = 0;
+    if (name.size() >= 2 && name[0] == 'F' && ParseInt(name.substr(1), 1, 12, function)) {
+        key = static_cast<sf::Keyboard::Key>(sf::Keyboard::F1 + (function - 1));
+        return true;
+    }
+
+    return false;
+}
+
+std::vector<KeyBindingConfig> GameConfig::GetDefaultKeyBindings() {
+    return {
+        { sf::Keyboard::W, KeyCommand::UP },
+        { sf::Keyboard::S, KeyCommand::DOWN },
+        { sf::Keyboard::A, KeyCommand::LEFT },
+        { sf::Keyboard::D, KeyCommand::RIGHT },
+        { sf::Keyboard::Up, KeyCommand::UP },
+        { sf::Keyboard::Down, KeyCommand::DOWN },
+        { sf::Keyboard::Left, KeyCommand::LEFT },
+        { sf::Keyboard::Right, KeyCommand::RIGHT },
+        { sf::Keyboard::Space, KeyCommand::START },
+        { sf::Keyboard::Enter, KeyCommand::START },
+        { sf::Keyboard::P, KeyCommand::PAUSE },
+        { sf::Keyboard::T, KeyCommand::TICK_MODE },
+        { sf::Keyboard::Escape, KeyCommand::QUIT },
+    };
+}
+
+bool GameConfig::HasSameLayout(const GameConfig& other) const {
+    return windowWidth == other.windowWidth && windowHeight == other.windowHeight &&
+           cellSize == other.cellSize && gameAreaMargin == other.gameAreaMargin;
+}
+
+bool GameConfig::HasSameAssets(const GameConfig& other) const {
+    return assetDirectory == other.assetDirectory && assetPackPath == other.assetPackPath;
+}
@@ -1,14 +1,59 @@
 #include "GameRenderer.hpp"
 #include "Snake.hpp"
 #include "Food.hpp"
+#include "AssetLoader.hpp"
+#include "AssetPack.hpp"
+#include <algorithm>
 #include <iostream>
+#include <utility>
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
 #include <SFML/Audio.hpp>
 #include <SFML/Network.hpp>
 
-GameRenderer::GameRenderer() : window(nullptr), gridSize(20) {  // Aumentado de 15 a 20 píxeles
+namespace {
+
+struct ImageAsset {
+    const char* name;
+    const char* path;
+};
+
+// Cada textura da nombre también a su sprite; rutas relativas al directorio de assets
+const ImageAsset IMAGE_ASSETS[] = {
+    // Serpiente
+    { "snake_head", "images/cabeza.png" },
+    { "snake_head_right", "images/derecha.png" },
+    { "snake_head_left", "images/izquierda.png" },
+    { "snake_head_back", "images/trasera.png" },
+    { "snake_body", "images/cuerpo.png" },
+    { "snake_body_vertical", "images/cuerpovertical.png" },
+    { "snake_segment", "images/segmento.png" },
+    
+    // UI
+    { "background", "images/fondo.jpg" },
+    { "food", "images/comida.png" },
+    { "start_screen", "images/pantalla de inicio.jpg" },
+    { "game_over", "images/pantalla final.jpg" },
+    
+    // Números del score
+    { "num_0", "images/cero.png" },
+    { "num_1", "images/uno.png" },
+    { "num_2", "images/dos.png" },
+    { "num_3", "images/tres.png" },
+    { "num_4", "images/cuatro.png" },
+    { "num_5", "images/cinco.png" },
+    { "num_6", "images/seis.png" },
+    { "num_7", "images/siete.png" },
+    { "num_8", "images/ocho.png" },
+    { "num_9", "images/nueve.png" },
+};
+
+} // namespace
+
+GameRenderer::GameRenderer()
+    : window(nullptr), gridSize(20),  // Aumentado de 15 a 20 píxeles
+      viewWidth(1200), viewHeight(900), gameAreaMargin(100.0f), assetDirectory("assets") {
 }
 
 GameRenderer::~GameRenderer() {
@@ -22,58 +67,135 @@ bool GameRenderer::Initialize(sf::RenderWindow* renderWindow) {
     }
     
     window = renderWindow;
+    RegisterTextures();
     
-    // Cargar fuente por defecto
-    if (!font.loadFromFile("assets/fonts/arial.ttf")) {
-        std::cerr << "Could not load font, using default font" << std::endl;
-        // SFML cargará la fuente por defecto automáticamente
-        // Por ahora continuamos sin fuente personalizada
+    return true;
+}
+
+bool GameRenderer::InitializeHeadless(int width, int height) {
+    // Sin ventana ni contexto OpenGL: todo se compone en memoria
+    rasterizer = std::make_unique<SoftwareRasterizer>();
+    if (!rasterizer->Initialize(width, height)) {
+        rasterizer.reset();
+        return false;
     }
     
+    window = nullptr;
     return true;
 }
 
 bool GameRenderer::LoadAssets() {
-    // Cargar texturas de la serpiente
-    if (!LoadSnakeTextures()) {
-        std::cerr << "Failed to load snake textures!" << std::endl;
-        return false;
+    // Carga secuencial en el hilo actual (herramientas y modo sin ventana)
+    AssetLoader loader;
+    QueueAssets(loader);
+    loader.LoadAll();
+    
+    return FinishLoading(loader);
+}
+
+void GameRenderer::QueueAssets(AssetLoader& loader) const {
+    // Con SetDownscaleImages el worker reduce cada imagen al tamaño con el que se dibuja
+    for (const ImageAsset& asset : IMAGE_ASSETS) {
+        loader.AddImage(asset.name, GetAssetPath(asset.path), GetImageDrawSize(asset.name));
+    }
+}
+
+bool GameRenderer::FinishLoading(const AssetLoader& loader) {
+    // Debe llamarse desde el hilo de la ventana
+    for (const auto& asset : loader.GetAssets()) {
+        if (asset->type != AssetType::IMAGE || !asset->isLoaded) continue;
+        
+        const sf::Vector2u size = asset->image.getSize();
+        if (rasterizer) {
+            RasterImage image;
+            SoftwareRasterizer::CreateImage(asset->image.getPixelsPtr(), static_cast<int>(size.x),
+                                            static_cast<int>(size.y), image);
+            AddImage(asset->name, std::move(image));
+            continue;
+        }
+        
+        // Copia ya decodificada en la caché; la textura se sube al primer uso, sin tocar disco
+        textureCache.Stage(asset->name, asset->image.getPixelsPtr(), size.x, size.y);
     }
     
-    // Cargar texturas de UI
-    if (!LoadUITextures()) {
-        std::cerr << "Failed to load UI textures!" << std::endl;
-        return false;
+    return true; // Permitir que funcione sin imágenes (se usan los fallbacks)
+}
+
+bool GameRenderer::LoadFromPack(const AssetPack& pack) {
+    // Con ventana, la caché sube cada textura desde el mapeo la primera vez que se usa
+    if (!rasterizer) {
+        textureCache.SetPack(&pack);
+        return true;
     }
     
-    // Cargar texturas de números
-    if (!LoadNumberTextures()) {
-        std::cerr << "Failed to load number textures!" << std::endl;
-        return false;
+    for (const ImageAsset& asset : IMAGE_ASSETS) {
+        const PackEntry* entry = pack.Find(std::string("image/") + asset.name);
+        if (!entry || entry->type != static_cast<std::uint32_t>(PackEntryType::IMAGE_RGBA)) {
+            std::cerr << "Missing image in asset pack: " << asset.name << std::endl;
+            continue;
+        }
+        
+        RasterImage image;
+        SoftwareRasterizer::CreateImage(pack.GetEntryData(*entry), static_cast<int>(entry->width),
+                                        static_cast<int>(entry->height), image);
+        AddImage(asset.name, std::move(image));
     }
     
     return true;
 }
 
 void GameRenderer::Cleanup() {
-    textures.clear();
     sprites.clear();
+    textureCache.Clear();
+    textures.clear();
+    images.clear();
+    scaledImages.clear();
+}
+
+void GameRenderer::SetAssetDirectory(const std::string& directory) {
+    assetDirectory = directory;
+    
+    // Con ventana, las imágenes de las rutas nuevas llegan con la siguiente carga (FinishLoading)
+    if (window) {
+        textureCache.SetPack(nullptr);
+        RegisterTextures();
+    }
+}
+
+void GameRenderer::SetLayout(int width, int height, int margin) {
+    viewWidth = width;
+    viewHeight = height;
+    gameAreaMargin = static_cast<float>(margin);
 }
 
 void GameRenderer::Clear() {
+    if (rasterizer) {
+        rasterizer->Clear(sf::Color::Black);
+        return;
+    }
+    textureCache.BeginFrame();
     window->clear(sf::Color::Black);
 }
 
 void GameRenderer::Present() {
+    // En modo sin ventana el frame queda en el framebuffer hasta el próximo Clear
+    if (rasterizer) return;
     window->display();
 }
 
 void GameRenderer::RenderBackground() {
+    if (rasterizer) {
+        if (!RasterizeImage("background", 0.0f, 0.0f, rasterizer->GetWidth(), rasterizer->GetHeight())) {
+            rasterizer->Clear(sf::Color(50, 50, 50));
+        }
+        return;
+    }
+    
     sf::Sprite* bgSprite = GetSprite("background");
     if (bgSprite) {
         // Escalar el fondo para que cubra toda la ventana
-        float scaleX = 1200.0f / bgSprite->getTexture()->getSize().x;
-        float scaleY = 900.0f / bgSprite->getTexture()->getSize().y;
+        float scaleX = static_cast<float>(viewWidth) / bgSprite->getTexture()->getSize().x;
+        float scaleY = static_cast<float>(viewHeight) / bgSprite->getTexture()->getSize().y;
         bgSprite->setScale(scaleX, scaleY);
         window->draw(*bgSprite);
     } else {
@@ -82,8 +204,26 @@ void GameRenderer::RenderBackground() {
     }
 }
 
+void GameRenderer::RenderPlayfield(const Snake& snake, const Food& food, int score) {
+    RenderBackground();
+    RenderGameBounds();  // Renderizar límites del área de juego
+    RenderFood(food);
+    RenderSnake(snake);
+    RenderScore(score);
+}
+
 void GameRenderer::RenderSnake(const Snake& snake) {
+    BuildSnakeBatch(snake, snakeBatch);
+    
+    for (const auto& command : snakeBatch) {
+        RenderSpriteAt(command.spriteName, command.position);
+    }
+}
+
+void GameRenderer::BuildSnakeBatch(const Snake& snake, std::vector<SpriteCommand>& batch) const {
     const auto& segments = snake.GetSegments();
+    batch.clear();
+    batch.reserve(segments.size());
     
     for (size_t i = 0; i < segments.size(); i++) {
         sf::Vector2f position = CalculateGridPosition(segments[i].x, segments[i].y);
@@ -106,10 +246,10 @@ void GameRenderer::RenderSnake(const Snake& snake) {
                     break;
             }
             
-            RenderSpriteAt(headSpriteName, position);
+            batch.push_back({headSpriteName, position});
         } else if (i == segments.size() - 1 && snake.GetGrowthFrames() > 0) {
             // Cola recién crecida - usar segmento.png para simular crecimiento
-            RenderSpriteAt("snake_segment", position);
+            batch.push_back({"snake_segment", position});
         } else {
             // Cuerpo - determinar orientación según segmentos adyacentes
             std::string bodySprite = "snake_body"; // Por defecto (horizontal)
@@ -133,7 +273,7 @@ void GameRenderer::RenderSnake(const Snake& snake) {
                 }
             }
             
-            RenderSpriteAt(bodySprite, position);
+            batch.push_back({bodySprite, position});
         }
     }
 }
@@ -157,11 +297,18 @@ void GameRenderer::RenderScore(int score) {
 }
 
 void GameRenderer::RenderStartScreen() {
+    if (rasterizer) {
+        if (!RasterizeImage("start_screen", 0.0f, 0.0f, rasterizer->GetWidth(), rasterizer->GetHeight())) {
+            rasterizer->Clear(sf::Color(100, 100, 100));
+        }
+        return;
+    }
+    
     sf::Sprite* startSprite = GetSprite("start_screen");
     if (startSprite) {
         // Escalar la imagen de inicio para que se ajuste a la nueva resolución
-        float scaleX = 1200.0f / startSprite->getTexture()->getSize().x;
-        float scaleY = 900.0f / startSprite->getTexture()->getSize().y;
+        float scaleX = static_cast<float>(viewWidth) / startSprite->getTexture()->getSize().x;
+        float scaleY = static_cast<float>(viewHeight) / startSprite->getTexture()->getSize().y;
         startSprite->setScale(scaleX, scaleY);
         window->draw(*startSprite);
     } else {
@@ -170,12 +317,19 @@ void GameRenderer::RenderStartScreen() {
     }
 }
 
-void GameRenderer::RenderGameOverScreen() {
+void GameRenderer::RenderGameOverScreen(std::uint64_t rank, std::uint64_t total) {
+    if (rasterizer) {
+        if (!RasterizeImage("game_over", 0.0f, 0.0f, rasterizer->GetWidth(), rasterizer->GetHeight())) {
+            rasterizer->Clear(sf::Color(150, 50, 50));
+        }
+        return;
+    }
+    
     sf::Sprite* gameOverSprite = GetSprite("game_over");
     if (gameOverSprite) {
         // Escalar la imagen de game over para que se ajuste a la nueva resolución
-        float scaleX = 1200.0f / gameOverSprite->getTexture()->getSize().x;
-        float scaleY = 900.0f / gameOverSprite->getTexture()->getSize().y;
+        float scaleX = static_cast<float>(viewWidth) / gameOverSprite->getTexture()->getSize().x;
+        float scaleY = static_cast<float>(viewHeight) / gameOverSprite->getTexture()->getSize().y;
         gameOverSprite->setScale(scaleX, scaleY);
         window->draw(*gameOverSprite);
     } else {
@@ -183,28 +337,62 @@ void GameRenderer::RenderGameOverScreen() {
         RenderText("GAME OVER", 500.0f, 400.0f, sf::Color::White);
         RenderText("PRESS ANY KEY TO RESTART", 380.0f, 500.0f, sf::Color::White);
     }
+    
+    // Puesto de la partida entre todas las guardadas
+    if (rank > 0) {
+        RenderText("RANK #" + std::to_string(rank) + " OF " + std::to_string(total),
+                   20.0f, 80.0f, sf::Color::White);
+    }
 }
 
 void GameRenderer::RenderPauseScreen() {
-    sf::RectangleShape overlay(sf::Vector2f(1200, 900));  // Ajustado a la nueva resolución
+    if (rasterizer) {
+        rasterizer->FillRect(0, 0, rasterizer->GetWidth(), rasterizer->GetHeight(), sf::Color(0, 0, 0, 128));
+        return;
+    }
+    
+    sf::RectangleShape overlay(sf::Vector2f(viewWidth, viewHeight));
     overlay.setFillColor(sf::Color(0, 0, 0, 128));
     window->draw(overlay);
     
     RenderText("PAUSED", 550.0f, 450.0f, sf::Color::White);  // Centrado en la nueva resolución
 }
 
+void GameRenderer::RenderLoadingScreen(float progress) {
+    progress = std::min(std::max(progress, 0.0f), 1.0f);
+    
+    // Barra de progreso centrada en la pantalla
+    const float barWidth = 600.0f;
+    const float barHeight = 30.0f;
+    const float barX = (viewWidth - barWidth) / 2.0f;
+    const float barY = (viewHeight - barHeight) / 2.0f;
+    
+    if (rasterizer) {
+        rasterizer->Clear(sf::Color(30, 30, 30));
+    } else {
+        window->clear(sf::Color(30, 30, 30));
+        RenderText("LOADING...", barX, barY - 60.0f, sf::Color::White);
+    }
+    
+    RenderRect(sf::FloatRect(barX, barY, barWidth, barHeight), sf::Color(70, 70, 70));
+    RenderRect(sf::FloatRect(barX, barY, barWidth * progress, barHeight), sf::Color(0, 200, 0));
+}
+
 void GameRenderer::RenderGameBounds() {
     // Definir dimensiones del área de juego
-    const float margin = 100.0f;  // Reducido de 200 a 100 píxeles
+    const float margin = GetGameAreaMargin();
     const float gameAreaX = margin;
     const float gameAreaY = margin;
-    const float gameAreaWidth = 1200.0f - (2 * margin);  // 1000 píxeles
-    const float gameAreaHeight = 900.0f - (2 * margin);  // 700 píxeles
+    const float gameAreaWidth = GetGameAreaWidth();
+    const float gameAreaHeight = GetGameAreaHeight();
     
     // Color y grosor del borde
     const float borderThickness = 3.0f;
     const sf::Color borderColor(255, 255, 255, 0); // Blanco completamente transparente (invisible)
     
+    // Los bordes son invisibles, el rasterizador descarta alfa 0
+    if (rasterizer) return;
+    
     // Renderizar los cuatro bordes del área de juego
     
     // Borde superior
@@ -233,6 +421,27 @@ void GameRenderer::RenderGameBounds() {
 }
 
 bool GameRenderer::LoadTexture(const std::string& name, const std::string& path) {
+    if (rasterizer) {
+        RasterImage image;
+        if (!SoftwareRasterizer::LoadImage(path, image)) {
+            return false;
+        }
+        AddImage(name, std::move(image));
+        return true;
+    }
+    
+    // Reemplazar la imagen de un asset gestionado por la caché (decodifica aquí, no al dibujar)
+    if (textureCache.IsRegistered(name)) {
+        sf::Image image;
+        if (!image.loadFromFile(path)) {
+            std::cerr << "Failed to load texture: " << path << std::endl;
+            return false;
+        }
+        textureCache.Register(name, path, GetImageDrawSize(name));
+        textureCache.Stage(name, image.getPixelsPtr(), image.getSize().x, image.getSize().y);
+        return textureCache.Acquire(name) != nullptr;
+    }
+    
     sf::Texture texture;
     if (!texture.loadFromFile(path)) {
         std::cerr << "Failed to load texture: " << path << std::endl;
@@ -244,23 +453,95 @@ bool GameRenderer::LoadTexture(const std::string& name, const std::string& path)
 }
 
 sf::Texture* GameRenderer::GetTexture(const std::string& name) {
+    if (textureCache.IsRegistered(name)) {
+        return textureCache.Acquire(name);
+    }
+    
     auto it = textures.find(name);
     return (it != textures.end()) ? &it->second : nullptr;
 }
 
 sf::Sprite* GameRenderer::GetSprite(const std::string& name) {
+    // La textura puede haberse descartado y recargado desde el último frame
+    if (textureCache.IsRegistered(name)) {
+        sf::Texture* texture = textureCache.Acquire(name);
+        if (!texture) return nullptr;
+        
+        sf::Sprite& sprite = sprites[name];
+        sprite.setTexture(*texture, true);
+        return &sprite;
+    }
+    
     auto it = sprites.find(name);
     return (it != sprites.end()) ? &it->second : nullptr;
 }
 
 void GameRenderer::CreateSprite(const std::string& name, const std::string& textureName) {
+    // En modo sin ventana se dibuja directamente desde las imágenes
+    if (rasterizer) return;
+    
     sf::Texture* texture = GetTexture(textureName);
     if (texture) {
         sprites[name] = sf::Sprite(*texture);
     }
 }
 
+void GameRenderer::AddImage(const std::string& name, RasterImage image) {
+    images[name] = std::make_shared<const RasterImage>(std::move(image));
+    
+    // Invalidar versiones escaladas de la imagen anterior
+    scaledImages.erase(name);
+}
+
+void GameRenderer::ShareImages(const GameRenderer& source) {
+    // Las originales no cambian después de cargarse; las escaladas son de cada renderer
+    images = source.images;
+    scaledImages.clear();
+}
+
+bool GameRenderer::CaptureFrame(const std::string& path) const {
+    if (!rasterizer) {
+        std::cerr << "Frame capture requires headless mode!" << std::endl;
+        return false;
+    }
+    return rasterizer->SaveToFile(path);
+}
+
+sf::Vector2i GameRenderer::GetImageDrawSize(const std::string& name) const {
+    // Tamaño en pantalla con el que se dibuja cada imagen; (0, 0) = tamaño original
+    if (name == "background" || name == "start_screen" || name == "game_over") {
+        if (window) {
+            return sf::Vector2i(static_cast<int>(window->getSize().x), static_cast<int>(window->getSize().y));
+        }
+        return sf::Vector2i(viewWidth, viewHeight);
+    }
+    if (name.find("snake_") == 0 || name == "food") {
+        return sf::Vector2i(gridSize, gridSize);
+    }
+    if (name.find("num_") == 0) {
+        return sf::Vector2i(40, 40);
+    }
+    return sf::Vector2i(0, 0);
+}
+
 void GameRenderer::RenderSprite(const std::string& spriteName, float x, float y) {
+    if (rasterizer) {
+        auto it = images.find(spriteName);
+        int width = gridSize;
+        int height = gridSize;
+        
+        // Mismo criterio de escala que con sprites: serpiente y comida a tamaño de celda
+        if (it != images.end() && spriteName.find("snake_") != 0 && spriteName != "food") {
+            width = it->second->width;
+            height = it->second->height;
+        }
+        
+        if (!RasterizeImage(spriteName, x, y, width, height)) {
+            rasterizer->FillRect(static_cast<int>(x), static_cast<int>(y), gridSize, gridSize, sf::Color::Green);
+        }
+        return;
+    }
+    
     sf::Sprite* sprite = GetSprite(spriteName);
     if (sprite) {
         sprite->setPosition(x, y);
@@ -297,6 +578,12 @@ void GameRenderer::RenderSpriteAt(const std::string& spriteName, const sf::Vecto
 }
 
 void GameRenderer::RenderRect(const sf::FloatRect& rect, const sf::Color& color) {
+    if (rasterizer) {
+        rasterizer->FillRect(static_cast<int>(rect.left), static_cast<int>(rect.top),
+                             static_cast<int>(rect.width), static_cast<int>(rect.height), color);
+        return;
+    }
+    
     sf::RectangleShape rectangle(sf::Vector2f(rect.width, rect.height));
     rectangle.setPosition(rect.left, rect.top);
     rectangle.setFillColor(color);
@@ -304,6 +591,9 @@ void GameRenderer::RenderRect(const sf::FloatRect& rect, const sf::Color& color)
 }
 
 void GameRenderer::RenderText(const std::string& text, float x, float y, const sf::Color& color) {
+    // El rasterizador no dibuja fuentes; el texto solo aparece en los fallbacks
+    if (rasterizer) return;
+    
     sf::Text sfText;
     sfText.setFont(font);
     sfText.setString(text);
@@ -314,66 +604,16 @@ void GameRenderer::RenderText(const std::string& text, float x, float y, const s
 }
 
 // Métodos privados
-bool GameRenderer::LoadSnakeTextures() {
-    LoadTexture("snake_head", "assets/images/cabeza.png");
-    LoadTexture("snake_head_right", "assets/images/derecha.png");
-    LoadTexture("snake_head_left", "assets/images/izquierda.png");
-    LoadTexture("snake_head_back", "assets/images/trasera.png");
-    LoadTexture("snake_body", "assets/images/cuerpo.png");
-    LoadTexture("snake_body_vertical", "assets/images/cuerpovertical.png");  // Nueva textura para cuerpo vertical
-    LoadTexture("snake_segment", "assets/images/segmento.png");
-    
-    // Crear sprites
-    CreateSprite("snake_head", "snake_head");
-    CreateSprite("snake_head_right", "snake_head_right");
-    CreateSprite("snake_head_left", "snake_head_left");
-    CreateSprite("snake_head_back", "snake_head_back");
-    CreateSprite("snake_body", "snake_body");
-    CreateSprite("snake_body_vertical", "snake_body_vertical");  // Sprite para cuerpo vertical
-    CreateSprite("snake_segment", "snake_segment");
-    
-    return true;
-}
-
-bool GameRenderer::LoadUITextures() {
-    LoadTexture("background", "assets/images/fondo.jpg");
-    LoadTexture("food", "assets/images/comida.png");
-    LoadTexture("start_screen", "assets/images/pantalla de inicio.jpg");
-    LoadTexture("game_over", "assets/images/pantalla final.jpg");
-    
-    // Crear sprites
-    CreateSprite("background", "background");
-    CreateSprite("food", "food");
-    CreateSprite("start_screen", "start_screen");
-    CreateSprite("game_over", "game_over");
-    
-    return true;
-}
-
-bool GameRenderer::LoadNumberTextures() {
-    LoadTexture("num_0", "assets/images/cero.png");
-    LoadTexture("num_1", "assets/images/uno.png");
-    LoadTexture("num_2", "assets/images/dos.png");
-    LoadTexture("num_3", "assets/images/tres.png");
-    LoadTexture("num_4", "assets/images/cuatro.png");
-    LoadTexture("num_5", "assets/images/cinco.png");
-    LoadTexture("num_6", "assets/images/seis.png");
-    LoadTexture("num_7", "assets/images/siete.png");
-    LoadTexture("num_8", "assets/images/ocho.png");
-    LoadTexture("num_9", "assets/images/nueve.png");
-    
-    // Crear sprites para números
-    for (int i = 0; i <= 9; i++) {
-        CreateSprite("num_" + std::to_string(i), "num_" + std::to_string(i));
-    }
-    
-    return true;
-}
-
 void GameRenderer::RenderDigit(int digit, float x, float y) {
     if (digit < 0 || digit > 9) return;
     
     std::string spriteName = "num_" + std::to_string(digit);
+    
+    if (rasterizer) {
+        RasterizeImage(spriteName, x, y, 40, 40);
+        return;
+    }
+    
     sf::Sprite* sprite = GetSprite(spriteName);
     if (sprite) {
         sprite->setPosition(x, y);
@@ -392,7 +632,56 @@ void GameRenderer::RenderDigit(int digit, float x, float y) {
     }
 }
 
+void GameRenderer::RegisterTextures() {
+    // Las imágenes llegan decodificadas (FinishLoading) o desde el pack; se suben al primer uso
+    for (const ImageAsset& asset : IMAGE_ASSETS) {
+        textureCache.Register(asset.name, GetAssetPath(asset.path), GetImageDrawSize(asset.name));
+    }
+    
+    // Cargar fuente por defecto
+    if (!font.loadFromFile(GetAssetPath("fonts/arial.ttf"))) {
+        std::cerr << "Could not load font, using default font" << std::endl;
+        // SFML cargará la fuente por defecto automáticamente
+        // Por ahora continuamos sin fuente personalizada
+    }
+}
+
+std::string GameRenderer::GetAssetPath(const std::string& relativePath) const {
+    return assetDirectory + "/" + relativePath;
+}
+
 sf::Vector2f GameRenderer::CalculateGridPosition(int gridX, int gridY) const {
     const float margin = GetGameAreaMargin();
     return sf::Vector2f(margin + (gridX * gridSize), margin + (gridY * gridSize));
+}
+
+bool GameRenderer::RasterizeImage(const std::string& name, float x, float y, int width, int height) {
+    auto it = images.find(name);
+    if (it == images.end()) {
+        return false;
+    }
+    
+    const RasterImage* image = it->second.get();
+    
+    // Escalar una sola vez por tamaño destino; las siguientes copias son blits sin escala
+    if (image->width != width || image->height != height) {
+        std::vector<RasterImage>& variants = scaledImages[name];
+        const RasterImage* scaled = nullptr;
+        for (const auto& variant : variants) {
+            if (variant.width == width && variant.height == height) {
+                scaled = &variant;
+                break;
+            }
+        }
+        
+        if (!scaled) {
+            variants.emplace_back();
+            SoftwareRasterizer::ScaleImage(*image, width, height, variants.back());
+            scaled = &variants.back();
+        }
+        image = scaled;
+    }
+    
+    rasterizer->BlitImage(*image, static_cast<int>(x), static_cast<int>(y));
+    return true;
 }
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "GameRules.hpp"
+#include <sstream>
+
+std::string GameRules::ToString() const {
+    std::string text;
+    if (wrapWalls) text += "wrap,";
+    if (!selfCollision) text += "no-self,";
+    if (multiCellGrowth) text += "multi-grow,";
+
+    if (text.empty()) return "classic";
+    text.pop_back();
+    return text;
+}
+
+bool GameRules::FromString(const std::string& text, GameRules& rules) {
+    GameRules parsed;
+    std::istringstream fields(text);
+    std::string name;
+
+    while (std::getline(fields, name, ',')) {
+        if (name == "classic") {
+            continue;
+        } else if (name == "wrap") {
+            parsed.wrapWalls = true;
+        } else if (name == "no-self") {
+            parsed.selfCollision = false;
+        } else if (name == "multi-grow") {
+            parsed.multiCellGrowth = true;
+        } else {
+            return false;
+        }
+    }
+
+    rules = parsed;
+    return true;
+}
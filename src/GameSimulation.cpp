@@ -0,0 +1,123 @@
+#include "GameSimulation.hpp"
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace RulePolicy;
+using SingleGrowth = GrowBy<1>;
+using MultiGrowth = GrowBy<GameRules::MULTI_CELL_GROWTH>;
+
+} // namespace
+
+GameSimulation::GameSimulation(int width, int height)
+    : gridWidth(width), gridHeight(height), snake(width / 2, height / 2),
+      score(0), gameOver(false), tickCount(0), seed(0),
+      tickFunction(SelectTickFunction(GameRules())) {
+}
+
+GameSimulation::~GameSimulation() {
+}
+
+void GameSimulation::Reset(std::uint32_t newSeed) {
+    seed = newSeed;
+    score = 0;
+    gameOver = false;
+    tickCount = 0;
+    
+    snake.Reset(gridWidth / 2, gridHeight / 2);
+    food.Seed(seed);
+    food.GenerateNewPosition(gridWidth, gridHeight, snake);
+}
+
+void GameSimulation::SetRules(const GameRules& newRules) {
+    rules = newRules;
+    tickFunction = SelectTickFunction(rules);
+}
+
+void GameSimulation::ChangeDirection(Direction direction) {
+    if (!gameOver) {
+        snake.ChangeDirection(direction);
+    }
+}
+
+std::uint32_t GameSimulation::GenerateSeed() {
+    std::random_device rd;
+    return rd();
+}
+
+GameSimulation::TickFunction GameSimulation::SelectTickFunction(const GameRules& rules) {
+    // Una especialización por combinación; el índice solo se calcula aquí
+    static const TickFunction variants[8] = {
+        TickWithRules<SolidWalls, SelfCollision, SingleGrowth>,
+        TickWithRules<SolidWalls, SelfCollision, MultiGrowth>,
+        TickWithRules<SolidWalls, NoSelfCollision, SingleGrowth>,
+        TickWithRules<SolidWalls, NoSelfCollision, MultiGrowth>,
+        TickWithRules<WrapWalls, SelfCollision, SingleGrowth>,
+        TickWithRules<WrapWalls, SelfCollision, MultiGrowth>,
+        TickWithRules<WrapWalls, NoSelfCollision, SingleGrowth>,
+        TickWithRules<WrapWalls, NoSelfCollision, MultiGrowth>,
+    };
+    
+    int index = (rules.wrapWalls ? 4 : 0) + (rules.selfCollision ? 0 : 2) + (rules.multiCellGrowth ? 1 : 0);
+    return variants[index];
+}
+
+// Métodos privados
+bool GameSimulation::HasFreeCell() const {
+    const std::vector<Position>& segments = snake.GetSegments();
+    int cellCount = gridWidth * gridHeight;
+    if (static_cast<int>(segments.size()) < cellCount) {
+        return true;
+    }
+
+    // Sin choque consigo misma los segmentos pueden solaparse: contar celdas distintas,
+    // igual que BatchEnvironment (todos los segmentos están dentro tras las paredes)
+    std::vector<bool> occupied(static_cast<size_t>(cellCount), false);
+    int occupiedCount = 0;
+    for (const Position& segment : segments) {
+        size_t cell = static_cast<size_t>(segment.y) * gridWidth + segment.x;
+        if (!occupied[cell]) {
+            occupied[cell] = true;
+            occupiedCount++;
+        }
+    }
+    return occupiedCount < cellCount;
+}
+
+template <typename WallPolicy, typename CollisionPolicy, typename GrowthPolicy>
+TickResult GameSimulation::TickWithRules(GameSimulation& simulation) {
+    if (simulation.gameOver) return TickResult::NONE;
+    
+    Snake& snake = simulation.snake;
+    snake.Update();
+    simulation.food.Update();
+    simulation.tickCount++;
+    
+    // Verificar colisiones
+    if (WallPolicy::HitsWall(snake, simulation.gridWidth, simulation.gridHeight)) {
+        simulation.gameOver = true;
+        return TickResult::HIT_WALL;
+    }
+    
+    if (CollisionPolicy::HitsSelf(snake)) {
+        simulation.gameOver = true;
+        return TickResult::HIT_SELF;
+    }
+    
+    // Verificar si la serpiente comió la comida
+    if (simulation.food.IsEatenBy(snake)) {
+        snake.Grow(GrowthPolicy::CELLS);
+        simulation.AddScore(simulation.food.GetNutritionalValue());
+        
+        // Grilla llena: no queda sitio para la comida y la partida termina
+        if (!simulation.HasFreeCell()) {
+            simulation.gameOver = true;
+            return TickResult::BOARD_FILLED;
+        }
+        simulation.food.GenerateNewPosition(simulation.gridWidth, simulation.gridHeight, snake);
+        return TickResult::ATE_FOOD;
+    }
+    
+    return TickResult::NONE;
+}
@@ -0,0 +1,108 @@
+#include "Histogram.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+
+Histogram::Histogram() {
+    Clear();
+}
+
+void Histogram::Record(std::uint64_t value) {
+    buckets[GetBucketIndex(value)]++;
+    count++;
+    sum += value;
+    minValue = std::min(minValue, value);
+    maxValue = std::max(maxValue, value);
+}
+
+void Histogram::Merge(const Histogram& other) {
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        buckets[i] += other.buckets[i];
+    }
+    count += other.count;
+    sum += other.sum;
+    minValue = std::min(minValue, other.minValue);
+    maxValue = std::max(maxValue, other.maxValue);
+}
+
+void Histogram::Clear() {
+    buckets.fill(0);
+    count = 0;
+    sum = 0;
+    minValue = std::numeric_limits<std::uint64_t>::max();
+    maxValue = 0;
+}
+
+void Histogram::Print(std::ostream& stream, const std::string& unit) const {
+    stream << "count " << count << "  mean " << std::fixed << std::setprecision(1) << GetMean() << ' ' << unit
+           << "  p50 " << GetPercentile(50.0) << "  p90 " << GetPercentile(90.0)
+           << "  p99 " << GetPercentile(99.0) << "  p99.9 " << GetPercentile(99.9)
+           << "  max " << GetMax() << ' ' << unit << '\n';
+    if (count == 0) return;
+
+    // Una barra por potencia de dos (16 cubetas), escalada a la más poblada
+    const size_t groupCount = BUCKET_COUNT / SUB_BUCKET_COUNT;
+    std::array<std::uint64_t, BUCKET_COUNT / SUB_BUCKET_COUNT> groups{};
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        groups[i / SUB_BUCKET_COUNT] += buckets[i];
+    }
+
+    const std::uint64_t peak = *std::max_element(groups.begin(), groups.end());
+    for (size_t group = 0; group < groupCount; group++) {
+        if (groups[group] == 0) continue;
+
+        size_t first = group * SUB_BUCKET_COUNT;
+        int width = static_cast<int>(std::ceil(40.0 * groups[group] / peak));
+        stream << std::setw(10) << GetBucketLowerBound(first) << " - " << std::setw(10)
+               << GetBucketUpperBound(first + SUB_BUCKET_COUNT - 1) << ' ' << unit
+               << std::setw(10) << groups[group] << ' ' << std::string(width, '#') << '\n';
+    }
+}
+
+std::uint64_t Histogram::GetPercentile(double percentile) const {
+    if (count == 0) return 0;
+
+    // Rango del valor buscado (1..count); se devuelve el límite superior de su cubeta
+    double clamped = std::min(std::max(percentile, 0.0), 100.0);
+    std::uint64_t rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(clamped / 100.0 * count)));
+
+    std::uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            return std::min(GetBucketUpperBound(i), maxValue);
+        }
+    }
+    return maxValue;
+}
+
+// Métodos privados
+size_t Histogram::GetBucketIndex(std::uint64_t value) {
+    if (value < 2 * SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(value);
+    }
+
+    // Bits significativos por encima de los SUB_BUCKET_BITS + 1 superiores
+    unsigned int shift = 63 - __builtin_clzll(value) - SUB_BUCKET_BITS;
+    return (shift + 1) * SUB_BUCKET_COUNT + ((value >> shift) & (SUB_BUCKET_COUNT - 1));
+}
+
+std::uint64_t Histogram::GetBucketLowerBound(size_t index) {
+    if (index < 2 * SUB_BUCKET_COUNT) {
+        return index;
+    }
+
+    unsigned int shift = static_cast<unsigned int>(index / SUB_BUCKET_COUNT) - 1;
+    std::uint64_t subBucket = index % SUB_BUCKET_COUNT;
+    return (SUB_BUCKET_COUNT + subBucket) << shift;
+}
+
+std::uint64_t Histogram::GetBucketUpperBound(size_t index) {
+    if (index < 2 * SUB_BUCKET_COUNT) {
+        return index;
+    }
+
+    unsigned int shift = static_cast<unsigned int>(index / SUB_BUCKET_COUNT) - 1;
+    return GetBucketLowerBound(index) + ((std::uint64_t(1) << shift) - 1);
+}
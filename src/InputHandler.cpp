@@ -1,5 +1,6 @@
 #include "InputHandler.hpp"
 #include "Game.hpp"
+#include "Metrics.hpp"
 #include <iostream>
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
@@ -7,6 +8,40 @@
 #include <SFML/Audio.hpp>
 #include <SFML/Network.hpp>
 
+namespace {
+
+// Acciones por defecto; reciben el Game en lugar de capturarlo
+void StartOrRestartGame(Game* game) {
+    if (game) {
+        if (!game->IsGameStarted()) {
+            game->StartGame();
+        } else if (game->IsGameOver()) {
+            game->RestartGame();
+        }
+    }
+}
+
+void PauseGame(Game* game) {
+    if (game && game->IsGameStarted() && !game->IsGameOver()) {
+        // Implementar pausa
+        game->PauseGame();
+    }
+}
+
+void CycleTickMode(Game* game) {
+    if (game) {
+        game->CycleTickMode();
+    }
+}
+
+void QuitGame(Game* game) {
+    if (game) {
+        game->SetRunning(false);
+    }
+}
+
+} // namespace
+
 InputHandler::InputHandler() : gameInstance(nullptr), isEnabled(true) {
 }
 
@@ -20,55 +55,46 @@ void InputHandler::Initialize(Game* game) {
 }
 
 void InputHandler::ConfigureDefaultKeys() {
-    // Configurar teclas de dirección
-    MapKeyToDirection(sf::Keyboard::W, Direction::UP);
-    MapKeyToDirection(sf::Keyboard::S, Direction::DOWN);
-    MapKeyToDirection(sf::Keyboard::A, Direction::LEFT);
-    MapKeyToDirection(sf::Keyboard::D, Direction::RIGHT);
-    MapKeyToDirection(sf::Keyboard::Up, Direction::UP);
-    MapKeyToDirection(sf::Keyboard::Down, Direction::DOWN);
-    MapKeyToDirection(sf::Keyboard::Left, Direction::LEFT);
-    MapKeyToDirection(sf::Keyboard::Right, Direction::RIGHT);
-    
-    // Configurar teclas de acción
-    MapKeyToAction(sf::Keyboard::Space, [this]() {
-        if (gameInstance) {
-            if (!gameInstance->IsGameStarted()) {
-                gameInstance->StartGame();
-            } else if (gameInstance->IsGameOver()) {
-                gameInstance->RestartGame();
-            }
-        }
-    });
-    
-    MapKeyToAction(sf::Keyboard::Enter, [this]() {
-        if (gameInstance) {
-            if (!gameInstance->IsGameStarted()) {
-                gameInstance->StartGame();
-            } else if (gameInstance->IsGameOver()) {
-                gameInstance->RestartGame();
-            }
-        }
-    });
-    
-    MapKeyToAction(sf::Keyboard::P, [this]() {
-        if (gameInstance && gameInstance->IsGameStarted() && !gameInstance->IsGameOver()) {
-            // Implementar pausa
-            gameInstance->PauseGame();
-        }
-    });
+    ApplyKeyBindings(GameConfig::GetDefaultKeyBindings());
+}
+
+void InputHandler::ApplyKeyBindings(const std::vector<KeyBindingConfig>& bindings) {
+    // Reemplaza la tabla completa; se llama entre ticks al recargar la configuración
+    keyBindings.fill(KeyBinding());
     
-    MapKeyToAction(sf::Keyboard::Escape, [this]() {
-        if (gameInstance) {
-            gameInstance->SetRunning(false);
+    for (const KeyBindingConfig& binding : bindings) {
+        switch (binding.command) {
+            case KeyCommand::UP:
+                MapKeyToDirection(binding.key, Direction::UP);
+                break;
+            case KeyCommand::DOWN:
+                MapKeyToDirection(binding.key, Direction::DOWN);
+                break;
+            case KeyCommand::LEFT:
+                MapKeyToDirection(binding.key, Direction::LEFT);
+                break;
+            case KeyCommand::RIGHT:
+                MapKeyToDirection(binding.key, Direction::RIGHT);
+                break;
+            case KeyCommand::START:
+                MapKeyToAction(binding.key, StartOrRestartGame);
+                break;
+            case KeyCommand::PAUSE:
+                MapKeyToAction(binding.key, PauseGame);
+                break;
+            case KeyCommand::TICK_MODE:
+                MapKeyToAction(binding.key, CycleTickMode);
+                break;
+            case KeyCommand::QUIT:
+                MapKeyToAction(binding.key, QuitGame);
+                break;
         }
-    });
+    }
 }
 
 void InputHandler::Cleanup() {
-    keyToDirectionMap.clear();
-    keyActionMap.clear();
-    keyState.clear();
+    keyBindings.fill(KeyBinding());
+    keyState.reset();
     gameInstance = nullptr;
 }
 
@@ -88,10 +114,12 @@ void InputHandler::ProcessEvent(const sf::Event& event) {
             break;
             
         case sf::Event::KeyPressed:
+            Metrics::Increment(MetricCounter::INPUT_EVENTS);
             ProcessKeyPressed(event.key.code);
             break;
             
         case sf::Event::KeyReleased:
+            Metrics::Increment(MetricCounter::INPUT_EVENTS);
             ProcessKeyReleased(event.key.code);
             break;
             
@@ -101,12 +129,19 @@ void InputHandler::ProcessEvent(const sf::Event& event) {
 }
 
 void InputHandler::ProcessKeyPressed(sf::Keyboard::Key key) {
+    if (!IsKeyInRange(key)) return;
+    
     UpdateKeyState(key, true);
     
-    if (IsDirectionKey(key)) {
-        HandleDirectionInput(key);
-    } else if (IsActionKey(key)) {
-        HandleActionInput(key);
+    switch (keyBindings[key].type) {
+        case KeyBindingType::DIRECTION:
+            HandleDirectionInput(key);
+            break;
+        case KeyBindingType::ACTION:
+            HandleActionInput(key);
+            break;
+        case KeyBindingType::NONE:
+            break;
     }
 }
 
@@ -121,21 +156,32 @@ void InputHandler::ProcessWindowClosed() {
 }
 
 void InputHandler::MapKeyToDirection(sf::Keyboard::Key key, Direction direction) {
-    keyToDirectionMap[key] = direction;
+    if (!IsKeyInRange(key)) return;
+    
+    // Una tecla tiene una sola asignación: dirección o acción
+    keyBindings[key] = KeyBinding();
+    keyBindings[key].type = KeyBindingType::DIRECTION;
+    keyBindings[key].direction = direction;
 }
 
-void InputHandler::MapKeyToAction(sf::Keyboard::Key key, std::function<void()> action) {
-    keyActionMap[key] = action;
+void InputHandler::MapKeyToAction(sf::Keyboard::Key key, KeyActionFunction action) {
+    if (!IsKeyInRange(key)) return;
+    
+    keyBindings[key] = KeyBinding();
+    if (action) {
+        keyBindings[key].type = KeyBindingType::ACTION;
+        keyBindings[key].action = action;
+    }
 }
 
 void InputHandler::RemoveKeyMapping(sf::Keyboard::Key key) {
-    keyToDirectionMap.erase(key);
-    keyActionMap.erase(key);
+    if (IsKeyInRange(key)) {
+        keyBindings[key] = KeyBinding();
+    }
 }
 
 void InputHandler::ResetKeyMappings() {
-    keyToDirectionMap.clear();
-    keyActionMap.clear();
+    keyBindings.fill(KeyBinding());
     ConfigureDefaultKeys();
 }
 
@@ -152,25 +198,19 @@ void InputHandler::ToggleEnabled() {
 }
 
 bool InputHandler::IsKeyPressed(sf::Keyboard::Key key) const {
-    auto it = keyState.find(key);
-    return (it != keyState.end()) ? it->second : false;
+    return IsKeyInRange(key) && keyState.test(key);
 }
 
 bool InputHandler::IsAnyKeyPressed() const {
-    for (const auto& pair : keyState) {
-        if (pair.second) {
-            return true;
-        }
-    }
-    return false;
+    return keyState.any();
 }
 
 bool InputHandler::IsValidDirectionKey(sf::Keyboard::Key key) const {
-    return keyToDirectionMap.find(key) != keyToDirectionMap.end();
+    return GetKeyBinding(key).type == KeyBindingType::DIRECTION;
 }
 
 bool InputHandler::IsValidActionKey(sf::Keyboard::Key key) const {
-    return keyActionMap.find(key) != keyActionMap.end();
+    return GetKeyBinding(key).type == KeyBindingType::ACTION;
 }
 
 bool InputHandler::CanChangeDirection(Direction newDirection, Direction currentDirection) const {
@@ -188,19 +228,26 @@ bool InputHandler::CanChangeDirection(Direction newDirection, Direction currentD
 }
 
 Direction InputHandler::GetDirectionFromKey(sf::Keyboard::Key key) const {
-    auto it = keyToDirectionMap.find(key);
-    return (it != keyToDirectionMap.end()) ? it->second : Direction::UP;
+    const KeyBinding& binding = GetKeyBinding(key);
+    return (binding.type == KeyBindingType::DIRECTION) ? binding.direction : Direction::UP;
+}
+
+const KeyBinding& InputHandler::GetKeyBinding(sf::Keyboard::Key key) const {
+    static const KeyBinding unbound;
+    return IsKeyInRange(key) ? keyBindings[key] : unbound;
 }
 
 // Métodos privados
 void InputHandler::UpdateKeyState(sf::Keyboard::Key key, bool isPressed) {
-    keyState[key] = isPressed;
+    if (IsKeyInRange(key)) {
+        keyState.set(key, isPressed);
+    }
 }
 
 void InputHandler::ExecuteKeyAction(sf::Keyboard::Key key) {
-    auto it = keyActionMap.find(key);
-    if (it != keyActionMap.end() && it->second) {
-        it->second();
+    const KeyBinding& binding = GetKeyBinding(key);
+    if (binding.type == KeyBindingType::ACTION) {
+        binding.action(gameInstance);
     }
 }
 
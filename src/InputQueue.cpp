@@ -0,0 +1,54 @@
+#include "InputQueue.hpp"
+
+InputQueue::InputQueue() : head(0), count(0), droppedInputs(0), discardedInputs(0) {
+}
+
+bool InputQueue::Push(Direction direction, std::chrono::steady_clock::time_point timestamp) {
+    // Tecla repetida (autorepetición o doble pulsación): no ocupa hueco
+    if (count > 0 && inputs[(head + count - 1) % CAPACITY].direction == direction) {
+        discardedInputs++;
+        return false;
+    }
+
+    // Con la cola llena se descarta lo más nuevo: lo antiguo ya se pidió antes
+    if (count == CAPACITY) {
+        droppedInputs++;
+        return false;
+    }
+
+    inputs[(head + count) % CAPACITY] = DirectionInput{ direction, timestamp };
+    count++;
+    return true;
+}
+
+bool InputQueue::Pop(Direction currentDirection, DirectionInput& input) {
+    while (count > 0) {
+        input = inputs[head];
+        head = (head + 1) % CAPACITY;
+        count--;
+
+        if (IsTurn(input.direction, currentDirection)) {
+            return true;
+        }
+        discardedInputs++;
+    }
+    return false;
+}
+
+void InputQueue::Clear() {
+    head = 0;
+    count = 0;
+}
+
+// Métodos privados
+bool InputQueue::IsTurn(Direction newDirection, Direction currentDirection) {
+    switch (newDirection) {
+        case Direction::UP:
+        case Direction::DOWN:
+            return currentDirection == Direction::LEFT || currentDirection == Direction::RIGHT;
+        case Direction::LEFT:
+        case Direction::RIGHT:
+            return currentDirection == Direction::UP || currentDirection == Direction::DOWN;
+    }
+    return false;
+}
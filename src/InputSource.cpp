@@ -0,0 +1,255 @@
+#include "InputSource.hpp"
+#include "GameSimulation.hpp"
+#include "Metrics.hpp"
+#include "ObservationEncoder.hpp"
+#include "PolicyNetwork.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace {
+
+bool IsOpposite(Direction a, Direction b) {
+    switch (a) {
+        case Direction::UP:
+            return b == Direction::DOWN;
+        case Direction::DOWN:
+            return b == Direction::UP;
+        case Direction::LEFT:
+            return b == Direction::RIGHT;
+        case Direction::RIGHT:
+            return b == Direction::LEFT;
+    }
+    return false;
+}
+
+Position Step(const Position& position, Direction direction) {
+    switch (direction) {
+        case Direction::UP:
+            return Position(position.x, position.y - 1);
+        case Direction::DOWN:
+            return Position(position.x, position.y + 1);
+        case Direction::LEFT:
+            return Position(position.x - 1, position.y);
+        case Direction::RIGHT:
+            return Position(position.x + 1, position.y);
+    }
+    return position;
+}
+
+DirectionInput MakeInput(Direction direction) {
+    // Sin marca de tiempo: la entrada no viene de una persona
+    return DirectionInput{ direction, std::chrono::steady_clock::time_point() };
+}
+
+} // namespace
+
+bool InputSource::Apply(GameSimulation& simulation, DirectionInput& input) {
+    if (simulation.IsGameOver() || !NextDirection(simulation, input)) {
+        return false;
+    }
+    simulation.ChangeDirection(input.direction);
+    return true;
+}
+
+bool KeyboardInputSource::Push(Direction direction, std::chrono::steady_clock::time_point timestamp) {
+    return queue.Push(direction, timestamp);
+}
+
+bool KeyboardInputSource::NextDirection(const GameSimulation& simulation, DirectionInput& input) {
+    return queue.Pop(simulation.GetSnake().GetCurrentDirection(), input);
+}
+
+ScriptedInputSource::ScriptedInputSource() : cursor(0) {
+}
+
+bool ScriptedInputSource::LoadFromFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Failed to open input script: " << path << std::endl;
+        return false;
+    }
+
+    inputs.clear();
+    cursor = 0;
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (line.empty() || line[0] == '#') continue;
+
+        std::istringstream fields(line);
+        std::uint64_t tick;
+        char value;
+        Direction direction;
+        if (!(fields >> tick >> value) || !Replay::CharToDirection(value, direction) ||
+            (!inputs.empty() && tick < inputs.back().tick)) {
+            std::cerr << path << ":" << lineNumber << ": invalid input script line" << std::endl;
+            return false;
+        }
+        inputs.emplace_back(tick, direction);
+    }
+
+    return true;
+}
+
+void ScriptedInputSource::AddInput(std::uint64_t tick, Direction direction) {
+    inputs.emplace_back(tick, direction);
+}
+
+bool ScriptedInputSource::NextDirection(const GameSimulation& simulation, DirectionInput& input) {
+    // Un giro por tick; los que coinciden en el mismo tick pasan a los siguientes
+    if (cursor < inputs.size() && inputs[cursor].tick <= simulation.GetTickCount()) {
+        input = MakeInput(inputs[cursor].direction);
+        cursor++;
+        return true;
+    }
+    return false;
+}
+
+ReplayInputSource::ReplayInputSource(const Replay& source) : replay(source), cursor(0) {
+}
+
+bool ReplayInputSource::NextDirection(const GameSimulation& simulation, DirectionInput& input) {
+    const std::vector<ReplayEvent>& events = replay.GetEvents();
+    const Direction current = simulation.GetSnake().GetCurrentDirection();
+
+    bool found = false;
+    while (cursor < events.size() && events[cursor].tick <= simulation.GetTickCount()) {
+        if (!IsOpposite(events[cursor].direction, current)) {
+            input = MakeInput(events[cursor].direction);
+            found = true;
+        }
+        cursor++;
+    }
+    return found;
+}
+
+bool ReplayInputSource::IsFinished() const {
+    return cursor >= replay.GetEvents().size();
+}
+
+bool BotInputSource::NextDirection(const GameSimulation& simulation, DirectionInput& input) {
+    const Snake& snake = simulation.GetSnake();
+    const Direction current = snake.GetCurrentDirection();
+    const Position& head = snake.GetHead();
+    const Position& food = simulation.GetFood().GetPosition();
+
+    const Direction candidates[] = { current, Direction::UP, Direction::DOWN, Direction::LEFT, Direction::RIGHT };
+
+    // Entre las casillas seguras, la más cercana a la comida; en empate, seguir recto
+    Direction best = current;
+    int bestDistance = -1;
+    for (Direction candidate : candidates) {
+        if (IsOpposite(candidate, current)) continue;
+
+        Position next = Step(head, candidate);
+        if (!IsSafe(simulation, next)) continue;
+
+        int distance = std::abs(next.x - food.x) + std::abs(next.y - food.y);
+        if (bestDistance < 0 || distance < bestDistance) {
+            best = candidate;
+            bestDistance = distance;
+        }
+    }
+
+    if (best == current) return false;
+    input = MakeInput(best);
+    return true;
+}
+
+RandomInputSource::RandomInputSource(std::uint64_t randomSeed, int turnRate)
+    : seed(randomSeed ? randomSeed : 1), state(seed), turnsPerHundredTicks(turnRate) {
+}
+
+bool RandomInputSource::NextDirection(const GameSimulation& simulation, DirectionInput& input) {
+    if (static_cast<int>(NextRandom() % 100) >= turnsPerHundredTicks) {
+        return false;
+    }
+
+    // Cualquier dirección, incluidas las inválidas: Snake debe rechazarlas
+    (void)simulation;
+    input = MakeInput(static_cast<Direction>(NextRandom() % 4));
+    return true;
+}
+
+// Métodos privados
+bool BotInputSource::IsSafe(const GameSimulation& simulation, const Position& position) {
+    const GameRules& rules = simulation.GetRules();
+    Position target = position;
+    if (rules.wrapWalls) {
+        target.x = (target.x + simulation.GetGridWidth()) % simulation.GetGridWidth();
+        target.y = (target.y + simulation.GetGridHeight()) % simulation.GetGridHeight();
+    } else if (target.x < 0 || target.x >= simulation.GetGridWidth() ||
+               target.y < 0 || target.y >= simulation.GetGridHeight()) {
+        return false;
+    }
+    if (!rules.selfCollision) {
+        return true;
+    }
+
+    // La cola se mueve en este tick salvo que la serpiente acabe de crecer
+    const Snake& snake = simulation.GetSnake();
+    const std::vector<Position>& segments = snake.GetSegments();
+    size_t checked = snake.HasGrown() ? segments.size() : segments.size() - 1;
+    for (size_t i = 0; i < checked; i++) {
+        if (segments[i] == target) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::uint64_t RandomInputSource::NextRandom() {
+    // xorshift64*: rápido y reproducible en cualquier plataforma
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 2685821657736338717ULL;
+}
+
+PolicyInputSource::PolicyInputSource(std::shared_ptr<const PolicyNetwork> policy)
+    : network(std::move(policy)), workspace(std::make_unique<PolicyWorkspace>()) {
+}
+
+PolicyInputSource::~PolicyInputSource() {
+}
+
+bool PolicyInputSource::NextDirection(const GameSimulation& simulation, DirectionInput& input) {
+    auto start = std::chrono::steady_clock::now();
+
+    // Tablero y reglas pueden cambiar entre partidas; con ellos cambian los límites y la distancia a la pared
+    if (!encoder || encoder->GetGridWidth() != simulation.GetGridWidth() ||
+        encoder->GetGridHeight() != simulation.GetGridHeight() ||
+        encoder->IsWrapWalls() != simulation.GetRules().wrapWalls) {
+        encoder = std::make_unique<ObservationEncoder>(simulation.GetGridWidth(), simulation.GetGridHeight(),
+                                                       simulation.GetRules(), ObservationEncoder::Format::UINT8,
+                                                       (network->GetInputWidth() - 1) / 2);
+        observation.resize(encoder->GetObservationSize());
+        networkInput.resize(network->GetInputSize());
+    }
+
+    encoder->EncodeSimulation(simulation, observation.data());
+    encoder->ConvertToPolicyInput(observation.data(), networkInput.data());
+    std::int8_t action = 0;
+    network->SelectActions(networkInput.data(), 1, &action, *workspace);
+
+    Metrics::Observe(MetricHistogram::POLICY_TIME, static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()));
+
+    // Seguir recto o dar media vuelta (Snake la rechazaría) no es un giro
+    Direction direction = static_cast<Direction>(action);
+    Direction current = simulation.GetSnake().GetCurrentDirection();
+    if (direction == current || IsOpposite(direction, current)) return false;
+    input = MakeInput(direction);
+    return true;
+}
+
+bool PolicyInputSource::IsCompatible(const PolicyNetwork& policy) {
+    return policy.IsConfigured() && policy.GetInputChannels() == ObservationEncoder::PLANE_COUNT &&
+           policy.GetInputWidth() == policy.GetInputHeight() && policy.GetInputWidth() % 2 == 1 &&
+           policy.GetInputWidth() >= 3;
+}
@@ -0,0 +1,124 @@
+#include "Leaderboard.hpp"
+#include <algorithm>
+
+namespace {
+
+const size_t INITIAL_CAPACITY = 1024;
+
+} // namespace
+
+Leaderboard::Leaderboard() : totalCount(0), bestScore(0) {
+    Clear();
+}
+
+void Leaderboard::Build(const std::vector<ScoreRecord>& records) {
+    Clear();
+
+    int maxScore = 0;
+    for (const ScoreRecord& record : records) {
+        maxScore = std::max(maxScore, ClampScore(record.score));
+    }
+    Reserve(maxScore);
+
+    // Contar y construir el árbol de una vez: O(n + S) en lugar de n inserciones
+    for (const ScoreRecord& record : records) {
+        counts[ClampScore(record.score)]++;
+    }
+    totalCount = records.size();
+    bestScore = records.empty() ? 0 : maxScore;
+    RebuildTree();
+}
+
+void Leaderboard::Insert(int score) {
+    score = ClampScore(score);
+    Reserve(score);
+
+    counts[score]++;
+    for (size_t i = static_cast<size_t>(score) + 1; i < tree.size(); i += i & (~i + 1)) {
+        tree[i]++;
+    }
+
+    bestScore = (totalCount == 0) ? score : std::max(bestScore, score);
+    totalCount++;
+}
+
+void Leaderboard::Clear() {
+    counts.assign(INITIAL_CAPACITY, 0);
+    tree.assign(INITIAL_CAPACITY + 1, 0);
+    totalCount = 0;
+    bestScore = 0;
+}
+
+std::uint64_t Leaderboard::GetRank(int score) const {
+    // Los empates comparten puesto
+    return CountAbove(score) + 1;
+}
+
+std::uint64_t Leaderboard::CountAbove(int score) const {
+    return totalCount - CountAtMost(score);
+}
+
+int Leaderboard::GetScoreAtRank(std::uint64_t rank) const {
+    if (rank == 0 || rank > totalCount) return -1;
+
+    // La rank-ésima mejor es la (total - rank + 1)-ésima peor: descenso por
+    // potencias de dos buscando la última posición con prefijo < target
+    std::uint64_t target = totalCount - rank + 1;
+    size_t position = 0;
+    for (size_t step = counts.size(); step > 0; step >>= 1) {
+        size_t next = position + step;
+        if (next < tree.size() && tree[next] < target) {
+            position = next;
+            target -= tree[next];
+        }
+    }
+    return static_cast<int>(position);
+}
+
+void Leaderboard::GetTopScores(size_t count, std::vector<int>& scores) const {
+    scores.clear();
+
+    // Un descenso por puntuación distinta; los empates se copian sin consultar
+    std::uint64_t rank = 1;
+    while (scores.size() < count && rank <= totalCount) {
+        int score = GetScoreAtRank(rank);
+        size_t copies = std::min<size_t>(counts[score], count - scores.size());
+        scores.insert(scores.end(), copies, score);
+        rank += counts[score];
+    }
+}
+
+// Métodos privados
+void Leaderboard::Reserve(int score) {
+    if (static_cast<size_t>(score) < counts.size()) return;
+
+    size_t capacity = counts.size();
+    while (capacity <= static_cast<size_t>(score)) {
+        capacity *= 2;
+    }
+    counts.resize(capacity, 0);
+    RebuildTree();
+}
+
+void Leaderboard::RebuildTree() {
+    // Construcción lineal: cada nodo suma su valor a su padre
+    tree.assign(counts.size() + 1, 0);
+    for (size_t i = 1; i < tree.size(); i++) {
+        tree[i] += counts[i - 1];
+        size_t parent = i + (i & (~i + 1));
+        if (parent < tree.size()) {
+            tree[parent] += tree[i];
+        }
+    }
+}
+
+std::uint64_t Leaderboard::CountAtMost(int score) const {
+    if (score < 0) return 0;
+
+    size_t end = std::min(static_cast<size_t>(score) + 1, counts.size());
+    std::uint64_t sum = 0;
+    for (size_t i = end; i > 0; i -= i & (~i + 1)) {
+        sum += tree[i];
+    }
+    return sum;
+}
@@ -0,0 +1,288 @@
+#include "Metrics.hpp"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SNAKE_METRICS_POSIX 1
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+struct MetricInfo {
+    const char* name;
+    const char* labels;     // Vacío o '{clave="valor"}'
+    const char* help;
+};
+
+const MetricInfo COUNTER_INFO[MetricShard::COUNTER_COUNT] = {
+    { "snake_ticks_total", "", "Simulation ticks run." },
+    { "snake_frames_total", "", "Frames rendered." },
+    { "snake_food_eaten_total", "", "Food items eaten." },
+    { "snake_deaths_total", "{cause=\"wall\"}", "Games lost, by cause." },
+    { "snake_deaths_total", "{cause=\"self\"}", "Games lost, by cause." },
+    { "snake_audio_triggers_total", "", "Sound effects started by the audio thread." },
+    { "snake_input_events_total", "", "Key presses and releases handled." }
+};
+
+const MetricInfo HISTOGRAM_INFO[MetricShard::HISTOGRAM_COUNT] = {
+    { "snake_frame_time_seconds", "", "Time spent rendering a frame." },
+    { "snake_tick_time_seconds", "", "Time spent running a game tick." },
+    { "snake_policy_decision_seconds", "", "Time spent by the neural policy on one decision." }
+};
+
+const int POLL_INTERVAL_MS = 200;       // Cada cuánto mira el servidor si debe parar
+const size_t MAX_REQUEST_BYTES = 4096;
+
+// Cubeta con límite superior 2^i µs; la última es +Inf
+size_t GetBucketIndex(std::uint64_t microseconds) {
+    if (microseconds <= 1) return 0;
+    size_t index = 64 - static_cast<size_t>(__builtin_clzll(microseconds - 1));
+    return index < MetricShard::BUCKET_COUNT - 1 ? index : MetricShard::BUCKET_COUNT - 1;
+}
+
+} // namespace
+
+MetricShard::MetricShard(bool shared) : isShared(shared) {
+    Clear();
+}
+
+void MetricShard::Clear() {
+    for (std::atomic<std::uint64_t>& counter : counters) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    for (HistogramCells& histogram : histograms) {
+        for (std::atomic<std::uint64_t>& bucket : histogram.buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        histogram.sum.store(0, std::memory_order_relaxed);
+    }
+}
+
+MetricShard Metrics::shards[Metrics::MAX_SHARDS];
+MetricShard Metrics::sharedShard(true);
+std::atomic<size_t> Metrics::shardCount(0);
+thread_local MetricShard* Metrics::threadShard = nullptr;
+
+void Metrics::Observe(MetricHistogram histogram, std::uint64_t microseconds) {
+    MetricShard::HistogramCells& cells = GetThreadShard().histograms[static_cast<size_t>(histogram)];
+    Add(cells.buckets[GetBucketIndex(microseconds)], 1);
+    Add(cells.sum, microseconds);
+}
+
+void Metrics::WritePrometheus(std::ostream& stream) {
+    const char* lastName = "";
+    for (size_t i = 0; i < MetricShard::COUNTER_COUNT; i++) {
+        const MetricInfo& info = COUNTER_INFO[i];
+        if (std::strcmp(info.name, lastName) != 0) {
+            stream << "# HELP " << info.name << ' ' << info.help << '\n'
+                   << "# TYPE " << info.name << " counter\n";
+            lastName = info.name;
+        }
+        stream << info.name << info.labels << ' ' << GetCounter(static_cast<MetricCounter>(i)) << '\n';
+    }
+
+    size_t count = GetShardCount();
+    for (size_t h = 0; h < MetricShard::HISTOGRAM_COUNT; h++) {
+        const MetricInfo& info = HISTOGRAM_INFO[h];
+        stream << "# HELP " << info.name << ' ' << info.help << '\n'
+               << "# TYPE " << info.name << " histogram\n";
+
+        // Prometheus espera cubetas acumuladas, con límites en segundos
+        std::uint64_t cumulative = 0;
+        std::uint64_t sum = 0;
+        for (size_t b = 0; b < MetricShard::BUCKET_COUNT; b++) {
+            for (size_t s = 0; s < count; s++) {
+                cumulative += GetShard(s).histograms[h].buckets[b].load(std::memory_order_relaxed);
+            }
+            char bound[32];
+            if (b + 1 < MetricShard::BUCKET_COUNT) {
+                std::snprintf(bound, sizeof(bound), "%.6f", static_cast<double>(1ULL << b) / 1e6);
+            } else {
+                std::snprintf(bound, sizeof(bound), "+Inf");
+            }
+            stream << info.name << "_bucket{le=\"" << bound << "\"} " << cumulative << '\n';
+        }
+        for (size_t s = 0; s < count; s++) {
+            sum += GetShard(s).histograms[h].sum.load(std::memory_order_relaxed);
+        }
+
+        char seconds[32];
+        std::snprintf(seconds, sizeof(seconds), "%.6f", static_cast<double>(sum) / 1e6);
+        stream << info.name << "_sum " << seconds << '\n'
+               << info.name << "_count " << cumulative << '\n';
+    }
+}
+
+void Metrics::Reset() {
+    for (MetricShard& shard : shards) {
+        shard.Clear();
+    }
+    sharedShard.Clear();
+}
+
+std::uint64_t Metrics::GetCounter(MetricCounter counter) {
+    std::uint64_t total = 0;
+    size_t count = GetShardCount();
+    for (size_t s = 0; s < count; s++) {
+        total += GetShard(s).counters[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+std::uint64_t Metrics::GetHistogramCount(MetricHistogram histogram) {
+    std::uint64_t total = 0;
+    size_t count = GetShardCount();
+    for (size_t s = 0; s < count; s++) {
+        for (const std::atomic<std::uint64_t>& bucket : GetShard(s).histograms[static_cast<size_t>(histogram)].buckets) {
+            total += bucket.load(std::memory_order_relaxed);
+        }
+    }
+    return total;
+}
+
+size_t Metrics::GetShardCount() {
+    // Incluye el compartido si algún hilo llegó a usarlo
+    size_t count = shardCount.load(std::memory_order_acquire);
+    return count <= MAX_SHARDS ? count : MAX_SHARDS + 1;
+}
+
+// Métodos privados
+MetricShard& Metrics::AcquireShard() {
+    // Los shards no se reciclan: los totales de un hilo que termina se conservan
+    size_t index = shardCount.fetch_add(1, std::memory_order_acq_rel);
+    threadShard = &GetShard(index);
+    return *threadShard;
+}
+
+MetricsServer::MetricsServer() : isStopping(false), listenSocket(-1), port(0) {
+}
+
+MetricsServer::~MetricsServer() {
+    Stop();
+}
+
+bool MetricsServer::Start(int listenPort) {
+    Stop();
+
+#ifdef SNAKE_METRICS_POSIX
+    listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenSocket < 0) {
+        std::cerr << "Failed to create metrics socket" << std::endl;
+        return false;
+    }
+
+    int reuse = 1;
+    setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    // Solo localhost: las métricas no se exponen fuera de la máquina
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(static_cast<std::uint16_t>(listenPort));
+    socklen_t addressLength = sizeof(address);
+
+    if (bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+        listen(listenSocket, 8) < 0 ||
+        getsockname(listenSocket, reinterpret_cast<sockaddr*>(&address), &addressLength) < 0) {
+        std::cerr << "Failed to listen for metrics on 127.0.0.1:" << listenPort << std::endl;
+        close(listenSocket);
+        listenSocket = -1;
+        return false;
+    }
+
+    port = ntohs(address.sin_port);
+    isStopping = false;
+    thread = std::thread(&MetricsServer::Serve, this);
+    return true;
+#else
+    (void)listenPort;
+    std::cerr << "Failed to start metrics endpoint: not supported on this platform" << std::endl;
+    return false;
+#endif
+}
+
+void MetricsServer::Stop() {
+    if (thread.joinable()) {
+        isStopping = true;
+        thread.join();
+    }
+#ifdef SNAKE_METRICS_POSIX
+    if (listenSocket >= 0) {
+        close(listenSocket);
+        listenSocket = -1;
+    }
+#endif
+}
+
+// Métodos privados
+void MetricsServer::Serve() {
+#ifdef SNAKE_METRICS_POSIX
+    while (!isStopping) {
+        pollfd descriptor = { listenSocket, POLLIN, 0 };
+        if (poll(&descriptor, 1, POLL_INTERVAL_MS) <= 0) continue;
+
+        int connection = accept(listenSocket, nullptr, nullptr);
+        if (connection < 0) continue;
+        HandleConnection(connection);
+        close(connection);
+    }
+#endif
+}
+
+void MetricsServer::HandleConnection(int connection) {
+#ifdef SNAKE_METRICS_POSIX
+    // Un cliente lento no bloquea el servidor más de un segundo
+    timeval timeout = { 1, 0 };
+    setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    std::string request;
+    char buffer[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST_BYTES) {
+        ssize_t received = recv(connection, buffer, sizeof(buffer), 0);
+        if (received <= 0) break;
+        request.append(buffer, static_cast<size_t>(received));
+    }
+
+    std::ostringstream body;
+    const char* status = "200 OK";
+    if (request.compare(0, 13, "GET /metrics ") == 0 || request.compare(0, 6, "GET / ") == 0) {
+        Metrics::WritePrometheus(body);
+    } else {
+        status = "404 Not Found";
+        body << "Not found\n";
+    }
+
+    std::string content = body.str();
+    std::ostringstream response;
+    response << "HTTP/1.1 " << status << "\r\n"
+             << "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+             << "Content-Length: " << content.size() << "\r\n"
+             << "Connection: close\r\n\r\n"
+             << content;
+
+    std::string data = response.str();
+#ifdef MSG_NOSIGNAL
+    const int flags = MSG_NOSIGNAL;
+#else
+    const int flags = 0;
+#endif
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t written = send(connection, data.data() + sent, data.size() - sent, flags);
+        if (written <= 0) break;
+        sent += static_cast<size_t>(written);
+    }
+#else
+    (void)connection;
+#endif
+}
@@ -0,0 +1,367 @@
+#include "ObservationEncoder.hpp"
+#include "GameSimulation.hpp"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define SNAKE_ENCODER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+const std::uint8_t NO_WALL_DISTANCE = 255;
+
+// Módulo siempre positivo (para ventanas que dan la vuelta al tablero)
+inline int WrapCoordinate(int value, int size) {
+    int wrapped = value % size;
+    return wrapped < 0 ? wrapped + size : wrapped;
+}
+
+inline void SetBit(std::uint8_t* bits, int index) {
+    bits[index >> 3] |= static_cast<std::uint8_t>(1u << (index & 7));
+}
+
+#ifdef SNAKE_ENCODER_X86
+// 32 celdas por iteración: comparar, empaquetar a bytes y dejar 0 o 1
+__attribute__((target("avx2")))
+int EncodeBodyBytesAvx2(const std::int32_t* cells, std::int32_t tail, int count, std::uint8_t* output) {
+    const __m256i tailVector = _mm256_set1_epi32(tail);
+    const __m256i ones = _mm256_set1_epi8(1);
+    // packs intercala las dos mitades de 128 bits; esto devuelve el orden de las celdas
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    int cell = 0;
+    for (; cell + 32 <= count; cell += 32) {
+        const __m256i* source = reinterpret_cast<const __m256i*>(cells + cell);
+        __m256i occupied0 = _mm256_cmpgt_epi32(_mm256_loadu_si256(source), tailVector);
+        __m256i occupied1 = _mm256_cmpgt_epi32(_mm256_loadu_si256(source + 1), tailVector);
+        __m256i occupied2 = _mm256_cmpgt_epi32(_mm256_loadu_si256(source + 2), tailVector);
+        __m256i occupied3 = _mm256_cmpgt_epi32(_mm256_loadu_si256(source + 3), tailVector);
+
+        __m256i words01 = _mm256_packs_epi32(occupied0, occupied1);
+        __m256i words23 = _mm256_packs_epi32(occupied2, occupied3);
+        __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_packs_epi16(words01, words23), order);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + cell), _mm256_and_si256(bytes, ones));
+    }
+    return cell;
+}
+
+// 32 celdas -> 32 bits: una máscara de 8 bits por comparación
+__attribute__((target("avx2")))
+int EncodeBodyBitsAvx2(const std::int32_t* cells, std::int32_t tail, int count, std::uint8_t* output) {
+    const __m256i tailVector = _mm256_set1_epi32(tail);
+
+    int cell = 0;
+    for (; cell + 32 <= count; cell += 32) {
+        std::uint32_t bits = 0;
+        for (int group = 0; group < 4; group++) {
+            __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cells + cell + group * 8));
+            __m256i occupied = _mm256_cmpgt_epi32(values, tailVector);
+            bits |= static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(occupied))) << (group * 8);
+        }
+        std::memcpy(output + cell / 8, &bits, sizeof(bits));
+    }
+    return cell;
+}
+
+__attribute__((target("avx2")))
+int PackBitsAvx2(const std::uint8_t* values, int count, bool isWallPlane, std::uint8_t* output) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi8(1);
+
+    int index = 0;
+    for (; index + 32 <= count; index += 32) {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index));
+        // Pared: valor <= 1 (min(v, 1) == v); resto: valor != 0
+        __m256i matches = isWallPlane ? _mm256_cmpeq_epi8(_mm256_min_epu8(bytes, one), bytes)
+                                      : _mm256_cmpeq_epi8(bytes, zero);
+        std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(matches));
+        std::uint32_t bits = isWallPlane ? mask : ~mask;
+        std::memcpy(output + index / 8, &bits, sizeof(bits));
+    }
+    return index;
+}
+#endif
+
+} // namespace
+
+ObservationEncoder::ObservationEncoder(const BatchEnvironment& environment, Format outputFormat, int radius)
+    : ObservationEncoder(environment.GetGridWidth(), environment.GetGridHeight(), environment.GetRules(), outputFormat,
+                         radius) {
+}
+
+ObservationEncoder::ObservationEncoder(int width, int height, const GameRules& rules, Format outputFormat, int radius)
+    : gridWidth(width), gridHeight(height), wrapWalls(rules.wrapWalls), format(outputFormat), viewRadius(std::max(radius, 0)),
+      viewWidth(viewRadius ? 2 * viewRadius + 1 : gridWidth), viewHeight(viewRadius ? 2 * viewRadius + 1 : gridHeight),
+      planeSize(0), simdLevel(BatchEnvironment::DetectSimdLevel()),
+      wallDistances(static_cast<size_t>(gridWidth) * gridHeight) {
+    size_t viewCells = static_cast<size_t>(viewWidth) * viewHeight;
+    planeSize = (format == Format::UINT8) ? viewCells : (viewCells + 7) / 8;
+    if (viewRadius && format == Format::BITS) {
+        viewPlanes.resize(viewCells * PLANE_COUNT);
+    }
+
+    // La distancia a la pared no cambia: se calcula una vez y se copia
+    for (int y = 0; y < gridHeight; y++) {
+        for (int x = 0; x < gridWidth; x++) {
+            int distance = std::min(std::min(x, gridWidth - 1 - x), std::min(y, gridHeight - 1 - y));
+            wallDistances[y * gridWidth + x] = wrapWalls ? NO_WALL_DISTANCE
+                                                         : static_cast<std::uint8_t>(std::min(distance + 1, 255));
+        }
+    }
+    if (!viewRadius && format == Format::BITS) {
+        wallBits.resize(planeSize);
+        PackBits(wallDistances.data(), gridWidth * gridHeight, true, wallBits.data());
+    }
+}
+
+void ObservationEncoder::Encode(const BatchEnvironment& environment, std::uint8_t* output) {
+    for (size_t game = 0; game < environment.GetGameCount(); game++) {
+        // La ventana de la siguiente partida llega de memoria mientras se codifica esta
+        if (viewRadius && game + 1 < environment.GetGameCount()) {
+            PrefetchView(environment, game + 1);
+        }
+        EncodeGame(environment, game, output + game * GetObservationSize());
+    }
+}
+
+void ObservationEncoder::EncodeGame(const BatchEnvironment& environment, size_t game, std::uint8_t* output) {
+    if (viewRadius == 0) {
+        EncodeFullBoard(environment, game, output);
+        return;
+    }
+    if (format == Format::UINT8) {
+        EncodeView(environment, game, output);
+        return;
+    }
+
+    // La ventana no empieza en un byte del tablero: se arma en bytes y se empaqueta
+    int viewCells = viewWidth * viewHeight;
+    EncodeView(environment, game, viewPlanes.data());
+    for (int plane = 0; plane < PLANE_COUNT; plane++) {
+        PackBits(&viewPlanes[plane * viewCells], viewCells, plane == PLANE_WALL_DISTANCE,
+                 output + plane * planeSize);
+    }
+}
+
+void ObservationEncoder::EncodeSimulation(const GameSimulation& simulation, std::uint8_t* output) {
+    int viewCells = viewWidth * viewHeight;
+    std::uint8_t* planes = output;
+    if (format == Format::BITS) {
+        if (viewPlanes.size() < static_cast<size_t>(viewCells) * PLANE_COUNT) {
+            viewPlanes.resize(static_cast<size_t>(viewCells) * PLANE_COUNT);
+        }
+        planes = viewPlanes.data();
+    }
+
+    // Una sola partida: recorrer el cuerpo cuesta poco y no hay tablero de ocupación
+    const Snake& snake = simulation.GetSnake();
+    const Position& head = snake.GetHead();
+    int originX = viewRadius ? head.x - viewRadius : 0;
+    int originY = viewRadius ? head.y - viewRadius : 0;
+    std::memset(planes, 0, static_cast<size_t>(viewCells) * PLANE_COUNT);
+    for (const Position& segment : snake.GetSegments()) {
+        MarkCell(planes, segment.x, segment.y, originX, originY);
+    }
+    MarkCell(planes + viewCells, head.x, head.y, originX, originY);
+    if (simulation.GetFood().IsActive()) {
+        const Position& food = simulation.GetFood().GetPosition();
+        MarkCell(planes + 2 * viewCells, food.x, food.y, originX, originY);
+    }
+
+    std::uint8_t* wall = planes + 3 * viewCells;
+    for (int row = 0; row < viewHeight; row++) {
+        int y = wrapWalls ? WrapCoordinate(originY + row, gridHeight) : originY + row;
+        if (y < 0 || y >= gridHeight) continue;
+        for (int column = 0; column < viewWidth; column++) {
+            int x = wrapWalls ? WrapCoordinate(originX + column, gridWidth) : originX + column;
+            if (x >= 0 && x < gridWidth) {
+                wall[row * viewWidth + column] = wallDistances[y * gridWidth + x];
+            }
+        }
+    }
+
+    if (format == Format::BITS) {
+        for (int plane = 0; plane < PLANE_COUNT; plane++) {
+            PackBits(planes + plane * viewCells, viewCells, plane == PLANE_WALL_DISTANCE, output + plane * planeSize);
+        }
+    }
+}
+
+void ObservationEncoder::ConvertToPolicyInput(const std::uint8_t* observation, float* input) const {
+    // Cuerpo, cabeza y comida tal cual; la pared como cercanía: 1 fuera, 1/2 en el borde, 1/3...
+    // y 0 sin paredes (wrapWalls), no 1/256
+    size_t viewCells = static_cast<size_t>(viewWidth) * viewHeight;
+    for (size_t index = 0; index < viewCells * PLANE_WALL_DISTANCE; index++) {
+        input[index] = observation[index];
+    }
+    const std::uint8_t* wall = observation + viewCells * PLANE_WALL_DISTANCE;
+    float* proximity = input + viewCells * PLANE_WALL_DISTANCE;
+    for (size_t index = 0; index < viewCells; index++) {
+        std::uint8_t distance = wall[index];
+        proximity[index] = distance == NO_WALL_DISTANCE ? 0.0f : (distance ? 1.0f / (distance + 1) : 1.0f);
+    }
+}
+
+void ObservationEncoder::SetSimdLevel(BatchEnvironment::SimdLevel level) {
+    // No permitir un nivel que la CPU no soporte
+    simdLevel = (level == BatchEnvironment::SimdLevel::AVX2) ? BatchEnvironment::DetectSimdLevel()
+                                                              : BatchEnvironment::SimdLevel::SCALAR;
+}
+
+// Métodos privados
+
+void ObservationEncoder::EncodeFullBoard(const BatchEnvironment& environment, size_t game, std::uint8_t* output) const {
+    int cellCount = gridWidth * gridHeight;
+    std::uint8_t* body = output;
+    std::uint8_t* head = output + planeSize;
+    std::uint8_t* food = head + planeSize;
+    std::uint8_t* wall = food + planeSize;
+    int headCell = environment.GetHeadY()[game] * gridWidth + environment.GetHeadX()[game];
+    int foodX = environment.GetFoodX()[game];
+    int foodCell = environment.GetFoodY()[game] * gridWidth + foodX;
+
+    std::memset(head, 0, planeSize * 2);
+    if (format == Format::UINT8) {
+        EncodeBodyBytes(environment.GetOccupancy(game), environment.GetTailSteps()[game], cellCount, body);
+        head[headCell] = 1;
+        if (foodX >= 0) food[foodCell] = 1;
+        std::memcpy(wall, wallDistances.data(), planeSize);
+    } else {
+        EncodeBodyBits(environment.GetOccupancy(game), environment.GetTailSteps()[game], cellCount, body);
+        SetBit(head, headCell);
+        if (foodX >= 0) SetBit(food, foodCell);
+        std::memcpy(wall, wallBits.data(), planeSize);
+    }
+}
+
+void ObservationEncoder::EncodeView(const BatchEnvironment& environment, size_t game, std::uint8_t* planes) const {
+    int viewCells = viewWidth * viewHeight;
+    std::uint8_t* body = planes;
+    std::uint8_t* head = planes + viewCells;
+    std::uint8_t* food = head + viewCells;
+    std::uint8_t* wall = food + viewCells;
+    const std::int32_t* cells = environment.GetOccupancy(game);
+    std::int32_t tail = environment.GetTailSteps()[game];
+    int originX = environment.GetHeadX()[game] - viewRadius;
+    int originY = environment.GetHeadY()[game] - viewRadius;
+
+    // Fuera del tablero: sin cuerpo y distancia 0 (pared); un solo memset para todos los planos
+    std::memset(planes, 0, static_cast<size_t>(viewCells) * PLANE_COUNT);
+
+    for (int row = 0; row < viewHeight; row++) {
+        std::uint8_t* bodyRow = body + row * viewWidth;
+        std::uint8_t* wallRow = wall + row * viewWidth;
+        int y = originY + row;
+
+        if (wrapWalls) {
+            // La fila puede dar una o más vueltas: se copia por tramos contiguos
+            y = WrapCoordinate(y, gridHeight);
+            int x = WrapCoordinate(originX, gridWidth);
+            for (int column = 0; column < viewWidth;) {
+                int span = std::min(viewWidth - column, gridWidth - x);
+                int cell = y * gridWidth + x;
+                EncodeBodyBytes(cells + cell, tail, span, bodyRow + column);
+                std::memcpy(wallRow + column, &wallDistances[cell], span);
+                column += span;
+                x = 0;
+            }
+            continue;
+        }
+
+        if (y < 0 || y >= gridHeight) continue;
+
+        int begin = std::max(originX, 0);
+        int end = std::min(originX + viewWidth, gridWidth);
+        if (begin < end) {
+            int cell = y * gridWidth + begin;
+            EncodeBodyBytes(cells + cell, tail, end - begin, bodyRow + (begin - originX));
+            std::memcpy(wallRow + (begin - originX), &wallDistances[cell], end - begin);
+        }
+    }
+
+    // La cabeza está en el centro (y en sus repeticiones si la ventana da la vuelta)
+    MarkCell(head, environment.GetHeadX()[game], environment.GetHeadY()[game], originX, originY);
+    if (environment.GetFoodX()[game] >= 0) {
+        MarkCell(food, environment.GetFoodX()[game], environment.GetFoodY()[game], originX, originY);
+    }
+}
+
+void ObservationEncoder::MarkCell(std::uint8_t* plane, int x, int y, int originX, int originY) const {
+    int firstRow = y - originY;
+    int firstColumn = x - originX;
+    int rowStep = viewHeight;
+    int columnStep = viewWidth;
+    if (wrapWalls) {
+        // Con una ventana mayor que el tablero la celda aparece varias veces
+        firstRow = WrapCoordinate(firstRow, gridHeight);
+        firstColumn = WrapCoordinate(firstColumn, gridWidth);
+        rowStep = gridHeight;
+        columnStep = gridWidth;
+    }
+    for (int row = firstRow; row >= 0 && row < viewHeight; row += rowStep) {
+        for (int column = firstColumn; column >= 0 && column < viewWidth; column += columnStep) {
+            plane[row * viewWidth + column] = 1;
+        }
+    }
+}
+
+void ObservationEncoder::PrefetchView(const BatchEnvironment& environment, size_t game) const {
+    const std::int32_t* cells = environment.GetOccupancy(game);
+    int originX = environment.GetHeadX()[game] - viewRadius;
+    int originY = environment.GetHeadY()[game] - viewRadius;
+
+    // Cada fila de la ventana está en otras líneas de caché
+    for (int row = 0; row < viewHeight; row++) {
+        int y = wrapWalls ? WrapCoordinate(originY + row, gridHeight) : originY + row;
+        if (y < 0 || y >= gridHeight) continue;
+        int begin = wrapWalls ? 0 : std::max(originX, 0);
+        int end = wrapWalls ? gridWidth : std::min(originX + viewWidth, gridWidth);
+        for (int x = begin; x < end; x += 16) {
+            __builtin_prefetch(cells + y * gridWidth + x);
+        }
+        __builtin_prefetch(cells + y * gridWidth + end - 1);
+    }
+}
+
+void ObservationEncoder::EncodeBodyBytes(const std::int32_t* cells, std::int32_t tail, int count,
+                                         std::uint8_t* output) const {
+    int cell = 0;
+#ifdef SNAKE_ENCODER_X86
+    if (simdLevel == BatchEnvironment::SimdLevel::AVX2 && count >= 32) {
+        cell = EncodeBodyBytesAvx2(cells, tail, count, output);
+    }
+#endif
+    for (; cell < count; cell++) {
+        output[cell] = cells[cell] > tail ? 1 : 0;
+    }
+}
+
+void ObservationEncoder::EncodeBodyBits(const std::int32_t* cells, std::int32_t tail, int count,
+                                        std::uint8_t* output) const {
+    int cell = 0;
+#ifdef SNAKE_ENCODER_X86
+    if (simdLevel == BatchEnvironment::SimdLevel::AVX2) {
+        cell = EncodeBodyBitsAvx2(cells, tail, count, output);
+    }
+#endif
+    // Resto: bytes completos sin arrastrar basura en los bits finales
+    std::memset(output + cell / 8, 0, (count + 7) / 8 - cell / 8);
+    for (; cell < count; cell++) {
+        if (cells[cell] > tail) SetBit(output, cell);
+    }
+}
+
+void ObservationEncoder::PackBits(const std::uint8_t* values, int count, bool isWallPlane, std::uint8_t* output) const {
+    int index = 0;
+#ifdef SNAKE_ENCODER_X86
+    if (simdLevel == BatchEnvironment::SimdLevel::AVX2) {
+        index = PackBitsAvx2(values, count, isWallPlane, output);
+    }
+#endif
+    std::memset(output + index / 8, 0, (count + 7) / 8 - index / 8);
+    for (; index < count; index++) {
+        if (isWallPlane ? values[index] <= 1 : values[index] != 0) SetBit(output, index);
+    }
+}
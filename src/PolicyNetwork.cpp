@@ -0,0 +1,509 @@
+#include "PolicyNetwork.hpp"
+#include "Checksum.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define SNAKE_POLICY_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+const char FILE_MAGIC[8] = { 'S', 'N', 'K', 'P', 'O', 'L', 'C', 'Y' };
+const std::uint32_t FORMAT_VERSION = 1;
+const int BLOCK_WIDTH = 8;                  // Salidas por bloque empaquetado (un registro AVX)
+const int MAX_LAYER_COUNT = 64;
+const int MAX_DIMENSION = 4096;
+const size_t MAX_ACTIVATION_SIZE = 1 << 24;     // Floats por muestra de una activación o de im2col
+const size_t MAX_PARAMETER_COUNT = 1 << 26;     // 256 MiB de pesos empaquetados
+
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t inputChannels;
+    std::uint32_t inputHeight;
+    std::uint32_t inputWidth;
+    std::uint32_t layerCount;
+    std::uint32_t parameterCount;
+    std::uint32_t checksum;                 // De las capas y los parámetros
+};
+
+struct FileLayer {
+    std::uint32_t type;
+    std::uint32_t outputs;
+    std::uint32_t hasRelu;
+};
+
+int RoundUpToBlock(int value) {
+    return (value + BLOCK_WIDTH - 1) / BLOCK_WIDTH * BLOCK_WIDTH;
+}
+
+BatchEnvironment::SimdLevel DetectPolicySimdLevel() {
+#ifdef SNAKE_POLICY_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return BatchEnvironment::SimdLevel::AVX2;
+    }
+#endif
+    return BatchEnvironment::SimdLevel::SCALAR;
+}
+
+#ifdef SNAKE_POLICY_X86
+// ROWS filas x BLOCKS bloques de 8 salidas; los acumuladores quedan en registros
+template <int ROWS, int BLOCKS>
+__attribute__((target("avx2,fma")))
+inline void MultiplyTileAvx2(const float* rows, size_t rowStride, const float* weights, size_t blockStride, int depth,
+                             const float* bias, bool hasRelu, float* output, size_t outputStride) {
+    // Bucles de tamaño fijo desenrollados: sin esto los acumuladores van a la pila
+    __m256 sums[ROWS][BLOCKS];
+#pragma GCC unroll 4
+    for (int block = 0; block < BLOCKS; block++) {
+        __m256 start = _mm256_loadu_ps(bias + block * BLOCK_WIDTH);
+#pragma GCC unroll 8
+        for (int row = 0; row < ROWS; row++) {
+            sums[row][block] = start;
+        }
+    }
+
+    for (int k = 0; k < depth; k++) {
+        __m256 columnWeights[BLOCKS];
+#pragma GCC unroll 4
+        for (int block = 0; block < BLOCKS; block++) {
+            columnWeights[block] = _mm256_loadu_ps(weights + block * blockStride + k * BLOCK_WIDTH);
+        }
+#pragma GCC unroll 8
+        for (int row = 0; row < ROWS; row++) {
+            __m256 value = _mm256_broadcast_ss(rows + row * rowStride + k);
+#pragma GCC unroll 4
+            for (int block = 0; block < BLOCKS; block++) {
+                sums[row][block] = _mm256_fmadd_ps(value, columnWeights[block], sums[row][block]);
+            }
+        }
+    }
+
+    const __m256 zero = _mm256_setzero_ps();
+#pragma GCC unroll 8
+    for (int row = 0; row < ROWS; row++) {
+#pragma GCC unroll 4
+        for (int block = 0; block < BLOCKS; block++) {
+            __m256 result = hasRelu ? _mm256_max_ps(sums[row][block], zero) : sums[row][block];
+            _mm256_storeu_ps(output + row * outputStride + block * BLOCK_WIDTH, result);
+        }
+    }
+}
+
+template <int ROWS>
+__attribute__((target("avx2,fma")))
+inline void MultiplyRowsAvx2(const float* rows, size_t rowStride, const float* weights, int depth, int blockCount,
+                             const float* bias, bool hasRelu, float* output, size_t outputStride) {
+    size_t blockStride = static_cast<size_t>(depth) * BLOCK_WIDTH;
+    int block = 0;
+    // Con una sola fila hacen falta más bloques para tener FMAs independientes en vuelo
+    if (ROWS == 1) {
+        for (; block + 4 <= blockCount; block += 4) {
+            MultiplyTileAvx2<ROWS, 4>(rows, rowStride, weights + block * blockStride, blockStride, depth,
+                                      bias + block * BLOCK_WIDTH, hasRelu, output + block * BLOCK_WIDTH, outputStride);
+        }
+    }
+    for (; block + 2 <= blockCount; block += 2) {
+        MultiplyTileAvx2<ROWS, 2>(rows, rowStride, weights + block * blockStride, blockStride, depth,
+                                  bias + block * BLOCK_WIDTH, hasRelu, output + block * BLOCK_WIDTH, outputStride);
+    }
+    if (block < blockCount) {
+        MultiplyTileAvx2<ROWS, 1>(rows, rowStride, weights + block * blockStride, blockStride, depth,
+                                  bias + block * BLOCK_WIDTH, hasRelu, output + block * BLOCK_WIDTH, outputStride);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+void MultiplyAvx2(const float* rows, size_t rowCount, size_t rowStride, const float* weights, int depth,
+                  int blockCount, const float* bias, bool hasRelu, float* output, size_t outputStride) {
+    size_t row = 0;
+    // Un solo bloque (convolución de 8 canales): más filas para no esperar a cada FMA
+    if (blockCount == 1) {
+        for (; row + 8 <= rowCount; row += 8) {
+            MultiplyRowsAvx2<8>(rows + row * rowStride, rowStride, weights, depth, blockCount, bias, hasRelu,
+                                output + row * outputStride, outputStride);
+        }
+    }
+    for (; row + 4 <= rowCount; row += 4) {
+        MultiplyRowsAvx2<4>(rows + row * rowStride, rowStride, weights, depth, blockCount, bias, hasRelu,
+                            output + row * outputStride, outputStride);
+    }
+    for (; row < rowCount; row++) {
+        MultiplyRowsAvx2<1>(rows + row * rowStride, rowStride, weights, depth, blockCount, bias, hasRelu,
+                            output + row * outputStride, outputStride);
+    }
+}
+#endif
+
+} // namespace
+
+PolicyNetwork::PolicyNetwork()
+    : inputChannels(0), inputHeight(0), inputWidth(0), simdLevel(DetectPolicySimdLevel()) {
+}
+
+bool PolicyNetwork::Configure(int channels, int height, int width, const std::vector<PolicyLayer>& layerSpecs) {
+    if (channels <= 0 || height <= 0 || width <= 0 || channels > MAX_DIMENSION || height > MAX_DIMENSION ||
+        width > MAX_DIMENSION || layerSpecs.empty() || static_cast<int>(layerSpecs.size()) > MAX_LAYER_COUNT) {
+        std::cerr << "Failed to configure policy: invalid input shape or layer count" << std::endl;
+        return false;
+    }
+    if (layerSpecs.back().type != PolicyLayerType::DENSE || layerSpecs.back().outputs != ACTION_COUNT) {
+        std::cerr << "Failed to configure policy: the last layer must be dense with " << ACTION_COUNT << " outputs"
+                  << std::endl;
+        return false;
+    }
+
+    // Tamaños en size_t y con tope: un archivo manipulado no desborda int ni pide gigas
+    size_t pixels = static_cast<size_t>(height) * width;
+    std::vector<LayerShape> layerShapes;
+    size_t parameterCount = 0;
+    size_t packedCount = 0;
+    size_t previousWidth = channels * pixels;   // Ancho de la activación que entra en la capa
+    size_t previousChannels = channels;
+    bool isPlanar = true;
+    bool hasDense = false;
+    if (previousWidth > MAX_ACTIVATION_SIZE) {
+        std::cerr << "Failed to configure policy: input is too large" << std::endl;
+        return false;
+    }
+
+    for (const PolicyLayer& layer : layerSpecs) {
+        LayerShape shape;
+        bool isConvolution = layer.type == PolicyLayerType::CONV3X3;
+        // Las salidas de una convolución no se rellenan: la siguiente las lee sin huecos
+        if (layer.outputs <= 0 || layer.outputs > MAX_DIMENSION || (isConvolution && layer.outputs % BLOCK_WIDTH != 0) ||
+            (isConvolution && hasDense)) {
+            std::cerr << "Failed to configure policy: invalid layer (convolutions need a multiple of " << BLOCK_WIDTH
+                      << " channels and must come before dense layers)" << std::endl;
+            return false;
+        }
+
+        size_t outputs = static_cast<size_t>(layer.outputs);
+        size_t paddedOutputs = static_cast<size_t>(RoundUpToBlock(layer.outputs));
+        size_t inputs = isConvolution ? previousChannels * 9 : previousChannels * (hasDense ? 1 : pixels);
+        size_t depth = isConvolution ? inputs : previousWidth;
+        size_t outputWidth = isConvolution ? outputs * pixels : paddedOutputs;
+        size_t columnCount = isConvolution ? pixels * inputs : 0;
+        size_t packedSize = paddedOutputs * depth + paddedOutputs;
+        if (inputs > MAX_ACTIVATION_SIZE || outputWidth > MAX_ACTIVATION_SIZE || columnCount > MAX_ACTIVATION_SIZE ||
+            packedSize > MAX_PARAMETER_COUNT - packedCount) {
+            std::cerr << "Failed to configure policy: network is too large" << std::endl;
+            return false;
+        }
+
+        // Por debajo de los topes todo cabe en int
+        shape.inputStride = static_cast<int>(previousWidth);
+        shape.inputChannels = static_cast<int>(previousChannels);
+        shape.isInputPlanar = isPlanar;
+        shape.inputs = static_cast<int>(inputs);
+        shape.depth = static_cast<int>(depth);
+        shape.paddedOutputs = static_cast<int>(paddedOutputs);
+        shape.parameterOffset = parameterCount;
+        shape.packedOffset = packedCount;
+        parameterCount += outputs * inputs + outputs;
+        packedCount += packedSize;
+        layerShapes.push_back(shape);
+
+        previousWidth = outputWidth;
+        isPlanar = isPlanar && !isConvolution;
+        hasDense = hasDense || !isConvolution;
+        previousChannels = outputs;
+    }
+
+    inputChannels = channels;
+    inputHeight = height;
+    inputWidth = width;
+    layers = layerSpecs;
+    shapes = layerShapes;
+    parameters.assign(parameterCount, 0.0f);
+    packedWeights.assign(packedCount, 0.0f);
+    return true;
+}
+
+void PolicyNetwork::InitializeRandom(std::uint64_t seed) {
+    std::uint64_t state = seed * 0x9E3779B97F4A7C15ULL + 1;
+
+    // Uniforme de He: varianza 2 / entradas, para que ReLU no apague la señal
+    for (size_t index = 0; index < layers.size(); index++) {
+        const LayerShape& shape = shapes[index];
+        size_t weightCount = static_cast<size_t>(layers[index].outputs) * shape.inputs;
+        float limit = std::sqrt(6.0f / static_cast<float>(shape.inputs));
+        float* weights = &parameters[shape.parameterOffset];
+
+        for (size_t i = 0; i < weightCount; i++) {
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            double unit = static_cast<double>((state * 0x2545F4914F6CDD1DULL) >> 11) * (1.0 / 9007199254740992.0);
+            weights[i] = static_cast<float>((unit * 2.0 - 1.0) * limit);
+        }
+        std::fill(weights + weightCount, weights + weightCount + layers[index].outputs, 0.0f);
+    }
+    PackWeights();
+}
+
+bool PolicyNetwork::LoadFromFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Failed to open policy: " << path << std::endl;
+        return false;
+    }
+
+    FileHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, FILE_MAGIC, sizeof(header.magic)) != 0 || header.version != FORMAT_VERSION ||
+        header.layerCount == 0 || header.layerCount > static_cast<std::uint32_t>(MAX_LAYER_COUNT)) {
+        std::cerr << "Failed to load policy (not a policy file or unsupported version): " << path << std::endl;
+        return false;
+    }
+
+    std::vector<FileLayer> fileLayers(header.layerCount);
+    std::vector<PolicyLayer> layerSpecs;
+    if (!file.read(reinterpret_cast<char*>(fileLayers.data()), fileLayers.size() * sizeof(FileLayer))) {
+        std::cerr << "Failed to load policy (truncated): " << path << std::endl;
+        return false;
+    }
+    for (const FileLayer& fileLayer : fileLayers) {
+        if (fileLayer.type > static_cast<std::uint32_t>(PolicyLayerType::DENSE) ||
+            fileLayer.outputs > static_cast<std::uint32_t>(MAX_DIMENSION)) {
+            std::cerr << "Failed to load policy (invalid layer): " << path << std::endl;
+            return false;
+        }
+        layerSpecs.emplace_back(static_cast<PolicyLayerType>(fileLayer.type), static_cast<int>(fileLayer.outputs),
+                                fileLayer.hasRelu != 0);
+    }
+
+    PolicyNetwork loaded;
+    if (!loaded.Configure(static_cast<int>(std::min<std::uint32_t>(header.inputChannels, MAX_DIMENSION + 1)),
+                          static_cast<int>(std::min<std::uint32_t>(header.inputHeight, MAX_DIMENSION + 1)),
+                          static_cast<int>(std::min<std::uint32_t>(header.inputWidth, MAX_DIMENSION + 1)), layerSpecs) ||
+        loaded.GetParameterCount() != header.parameterCount) {
+        std::cerr << "Failed to load policy (shape does not match the parameters): " << path << std::endl;
+        return false;
+    }
+
+    std::vector<float> values(header.parameterCount);
+    if (!file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(float))) {
+        std::cerr << "Failed to load policy (truncated): " << path << std::endl;
+        return false;
+    }
+    std::uint32_t checksum = Checksum::Crc32c(fileLayers.data(), fileLayers.size() * sizeof(FileLayer));
+    checksum = Checksum::Crc32c(values.data(), values.size() * sizeof(float), checksum);
+    if (checksum != header.checksum) {
+        std::cerr << "Failed to load policy (checksum mismatch): " << path << std::endl;
+        return false;
+    }
+
+    // Solo se sustituye la red actual si todo el archivo es válido
+    loaded.SetParameters(values.data());
+    loaded.simdLevel = simdLevel;
+    *this = std::move(loaded);
+    return true;
+}
+
+bool PolicyNetwork::SaveToFile(const std::string& path) const {
+    std::vector<FileLayer> fileLayers;
+    for (const PolicyLayer& layer : layers) {
+        FileLayer fileLayer;
+        fileLayer.type = static_cast<std::uint32_t>(layer.type);
+        fileLayer.outputs = static_cast<std::uint32_t>(layer.outputs);
+        fileLayer.hasRelu = layer.hasRelu ? 1 : 0;
+        fileLayers.push_back(fileLayer);
+    }
+
+    FileHeader header;
+    std::memcpy(header.magic, FILE_MAGIC, sizeof(header.magic));
+    header.version = FORMAT_VERSION;
+    header.inputChannels = static_cast<std::uint32_t>(inputChannels);
+    header.inputHeight = static_cast<std::uint32_t>(inputHeight);
+    header.inputWidth = static_cast<std::uint32_t>(inputWidth);
+    header.layerCount = static_cast<std::uint32_t>(fileLayers.size());
+    header.parameterCount = static_cast<std::uint32_t>(parameters.size());
+    header.checksum = Checksum::Crc32c(fileLayers.data(), fileLayers.size() * sizeof(FileLayer));
+    header.checksum = Checksum::Crc32c(parameters.data(), parameters.size() * sizeof(float), header.checksum);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "Failed to create policy: " << path << std::endl;
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(fileLayers.data()), fileLayers.size() * sizeof(FileLayer));
+    file.write(reinterpret_cast<const char*>(parameters.data()), parameters.size() * sizeof(float));
+    if (!file) {
+        std::cerr << "Failed to write policy: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void PolicyNetwork::Forward(const float* inputs, size_t batch, float* logits, PolicyWorkspace& workspace) const {
+    size_t pixels = static_cast<size_t>(inputHeight) * inputWidth;
+    size_t activationWidth = 0;
+    size_t columnCount = 0;
+    for (size_t index = 0; index < layers.size(); index++) {
+        bool isConvolution = layers[index].type == PolicyLayerType::CONV3X3;
+        activationWidth = std::max(activationWidth, isConvolution ? pixels * layers[index].outputs
+                                                                  : static_cast<size_t>(shapes[index].paddedOutputs));
+        if (isConvolution) {
+            columnCount = std::max(columnCount, pixels * shapes[index].inputs);
+        }
+    }
+
+    // Solo crecen: con el mismo lote no se reserva nada
+    for (std::vector<float>& activation : workspace.activations) {
+        if (activation.size() < batch * activationWidth) activation.resize(batch * activationWidth);
+    }
+    if (workspace.columns.size() < columnCount) workspace.columns.resize(columnCount);
+
+    const float* current = inputs;
+    size_t currentStride = GetInputSize();
+    for (size_t index = 0; index < layers.size(); index++) {
+        const LayerShape& shape = shapes[index];
+        float* output = workspace.activations[index % 2].data();
+
+        if (layers[index].type == PolicyLayerType::CONV3X3) {
+            // Cada muestra: sus columnas caben en caché y se multiplican enseguida
+            size_t outputStride = pixels * layers[index].outputs;
+            for (size_t sample = 0; sample < batch; sample++) {
+                BuildColumns(current + sample * currentStride, shape, workspace.columns.data());
+                Multiply(workspace.columns.data(), pixels, shape.inputs, shape, layers[index].hasRelu,
+                         output + sample * outputStride);
+            }
+            currentStride = outputStride;
+        } else {
+            Multiply(current, batch, currentStride, shape, layers[index].hasRelu, output);
+            currentStride = shape.paddedOutputs;
+        }
+        current = output;
+    }
+
+    for (size_t sample = 0; sample < batch; sample++) {
+        std::memcpy(logits + sample * ACTION_COUNT, current + sample * currentStride, ACTION_COUNT * sizeof(float));
+    }
+}
+
+void PolicyNetwork::SelectActions(const float* inputs, size_t batch, std::int8_t* actions,
+                                  PolicyWorkspace& workspace) const {
+    if (workspace.logits.size() < batch * ACTION_COUNT) workspace.logits.resize(batch * ACTION_COUNT);
+    Forward(inputs, batch, workspace.logits.data(), workspace);
+
+    for (size_t sample = 0; sample < batch; sample++) {
+        const float* values = &workspace.logits[sample * ACTION_COUNT];
+        actions[sample] = static_cast<std::int8_t>(std::max_element(values, values + ACTION_COUNT) - values);
+    }
+}
+
+void PolicyNetwork::SetParameters(const float* values) {
+    std::copy(values, values + parameters.size(), parameters.begin());
+    PackWeights();
+}
+
+void PolicyNetwork::SetSimdLevel(BatchEnvironment::SimdLevel level) {
+    // No permitir un nivel que la CPU no soporte
+    simdLevel = (level == BatchEnvironment::SimdLevel::AVX2) ? DetectPolicySimdLevel() : BatchEnvironment::SimdLevel::SCALAR;
+}
+
+// Métodos privados
+
+void PolicyNetwork::PackWeights() {
+    // Bloque b: para cada fila k de la entrada, los pesos de las salidas 8b..8b+7 seguidos
+    for (size_t index = 0; index < layers.size(); index++) {
+        const LayerShape& shape = shapes[index];
+        int outputs = layers[index].outputs;
+        const float* weights = &parameters[shape.parameterOffset];
+        const float* bias = weights + static_cast<size_t>(outputs) * shape.inputs;
+        float* packed = &packedWeights[shape.packedOffset];
+        float* packedBias = packed + static_cast<size_t>(shape.paddedOutputs) * shape.depth;
+
+        for (int output = 0; output < shape.paddedOutputs; output++) {
+            float* column = packed + static_cast<size_t>(output / BLOCK_WIDTH) * shape.depth * BLOCK_WIDTH +
+                            output % BLOCK_WIDTH;
+            for (int k = 0; k < shape.depth; k++) {
+                bool isReal = output < outputs && k < shape.inputs;
+                column[static_cast<size_t>(k) * BLOCK_WIDTH] = isReal ? weights[static_cast<size_t>(output) * shape.inputs + k] : 0.0f;
+            }
+            packedBias[output] = output < outputs ? bias[output] : 0.0f;
+        }
+    }
+}
+
+void PolicyNetwork::BuildColumns(const float* input, const LayerShape& shape, float* columns) const {
+    int channels = shape.inputChannels;
+    int planeSize = inputHeight * inputWidth;
+
+    // Fila por píxel; columna c * 9 + ky * 3 + kx, como los pesos canónicos
+    for (int y = 0; y < inputHeight; y++) {
+        for (int x = 0; x < inputWidth; x++) {
+            float* row = columns + static_cast<size_t>(y * inputWidth + x) * shape.inputs;
+            bool isInterior = y > 0 && y < inputHeight - 1 && x > 0 && x < inputWidth - 1;
+
+            // Caso común: vecindad dentro del tablero y entrada por planos, tres tramos de 3 seguidos
+            if (isInterior && shape.isInputPlanar) {
+                const float* source = input + (y - 1) * inputWidth + (x - 1);
+                for (int channel = 0; channel < channels; channel++, source += planeSize, row += 9) {
+                    for (int ky = 0; ky < 3; ky++) {
+                        row[ky * 3] = source[ky * inputWidth];
+                        row[ky * 3 + 1] = source[ky * inputWidth + 1];
+                        row[ky * 3 + 2] = source[ky * inputWidth + 2];
+                    }
+                }
+                continue;
+            }
+
+            for (int channel = 0; channel < channels; channel++) {
+                for (int ky = 0; ky < 3; ky++) {
+                    int sourceY = y + ky - 1;
+                    for (int kx = 0; kx < 3; kx++) {
+                        int sourceX = x + kx - 1;
+                        float value = 0.0f;
+                        if (sourceY >= 0 && sourceY < inputHeight && sourceX >= 0 && sourceX < inputWidth) {
+                            int pixel = sourceY * inputWidth + sourceX;
+                            value = shape.isInputPlanar ? input[channel * planeSize + pixel]
+                                                        : input[pixel * channels + channel];
+                        }
+                        row[channel * 9 + ky * 3 + kx] = value;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void PolicyNetwork::Multiply(const float* rows, size_t rowCount, size_t rowStride, const LayerShape& shape,
+                             bool hasRelu, float* output) const {
+    const float* weights = &packedWeights[shape.packedOffset];
+    const float* bias = weights + static_cast<size_t>(shape.paddedOutputs) * shape.depth;
+    int blockCount = shape.paddedOutputs / BLOCK_WIDTH;
+    size_t outputStride = shape.paddedOutputs;
+
+#ifdef SNAKE_POLICY_X86
+    if (simdLevel == BatchEnvironment::SimdLevel::AVX2) {
+        MultiplyAvx2(rows, rowCount, rowStride, weights, shape.depth, blockCount, bias, hasRelu, output, outputStride);
+        return;
+    }
+#endif
+
+    for (size_t row = 0; row < rowCount; row++) {
+        const float* values = rows + row * rowStride;
+        for (int block = 0; block < blockCount; block++) {
+            const float* blockWeights = weights + static_cast<size_t>(block) * shape.depth * BLOCK_WIDTH;
+            float sums[BLOCK_WIDTH];
+            std::copy(bias + block * BLOCK_WIDTH, bias + (block + 1) * BLOCK_WIDTH, sums);
+            for (int k = 0; k < shape.depth; k++) {
+                for (int lane = 0; lane < BLOCK_WIDTH; lane++) {
+                    sums[lane] += values[k] * blockWeights[k * BLOCK_WIDTH + lane];
+                }
+            }
+            for (int lane = 0; lane < BLOCK_WIDTH; lane++) {
+                output[row * outputStride + block * BLOCK_WIDTH + lane] = hasRelu ? std::max(sums[lane], 0.0f) : sums[lane];
+            }
+        }
+    }
+}
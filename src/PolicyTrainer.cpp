@@ -0,0 +1,531 @@
+#include "PolicyTrainer.hpp"
+#include "BatchEnvironment.hpp"
+#include "Checksum.hpp"
+#include "ObservationEncoder.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iostream>
+
+namespace {
+
+const char CHECKPOINT_MAGIC[8] = { 'S', 'N', 'K', 'T', 'R', 'A', 'I', 'N' };
+const std::uint32_t FORMAT_VERSION = 2;            // 2: el CRC cubre también la cabecera
+const std::uint32_t MAX_LAYER_COUNT = 64;
+const std::uint64_t MAX_POPULATION = 1 << 20;
+
+// Campos de 64 bits primero: sin relleno entre campos
+struct CheckpointHeader {
+    char magic[8];
+    std::uint64_t seed;
+    std::uint64_t generation;
+    std::uint64_t randomState;
+    std::uint64_t populationSize;
+    std::uint64_t eliteCount;
+    std::uint64_t gamesPerEvaluation;
+    std::uint64_t historyCount;
+    std::uint32_t version;
+    std::uint32_t gridWidth;
+    std::uint32_t gridHeight;
+    std::uint32_t rules;                    // Bits: 1 wrapWalls, 2 selfCollision, 4 multiCellGrowth
+    std::uint32_t viewRadius;
+    std::uint32_t layerCount;
+    std::uint32_t tournamentSize;
+    std::uint32_t maxEpisodeTicks;
+    std::uint32_t parameterCount;
+    float mutationStrength;
+    float crossoverRate;
+    float bestFitness;
+    std::uint32_t checksum;                 // Del archivo entero, con este campo a 0
+    std::uint32_t reserved;
+};
+
+struct CheckpointLayer {
+    std::uint32_t type;
+    std::uint32_t outputs;
+    std::uint32_t hasRelu;
+};
+
+std::uint32_t PackRules(const GameRules& rules) {
+    return (rules.wrapWalls ? 1u : 0u) | (rules.selfCollision ? 2u : 0u) | (rules.multiCellGrowth ? 4u : 0u);
+}
+
+GameRules UnpackRules(std::uint32_t bits) {
+    GameRules rules;
+    rules.wrapWalls = (bits & 1u) != 0;
+    rules.selfCollision = (bits & 2u) != 0;
+    rules.multiCellGrowth = (bits & 4u) != 0;
+    return rules;
+}
+
+// Red completa: capas ocultas + salida lineal de un logit por dirección
+std::vector<PolicyLayer> BuildLayers(const TrainerConfig& config) {
+    std::vector<PolicyLayer> layers = config.hiddenLayers;
+    layers.emplace_back(PolicyLayerType::DENSE, PolicyNetwork::ACTION_COUNT, false);
+    return layers;
+}
+
+// Semilla de las partidas de una generación: la misma para toda la población
+std::uint64_t GenerationSeed(std::uint64_t seed, std::uint64_t generation) {
+    std::uint64_t state = seed + (generation + 1) * 0x9E3779B97F4A7C15ULL;
+    state = (state ^ (state >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    state = (state ^ (state >> 27)) * 0x94D049BB133111EBULL;
+    return state ^ (state >> 31);
+}
+
+// Escribe en un temporal y lo renombra: un corte no deja un archivo a medias
+bool ReplaceFile(const std::string& temporaryPath, const std::string& path) {
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error) {
+        std::cerr << "Failed to replace " << path << ": " << error.message() << std::endl;
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+/**
+ * Todo lo que necesita un hilo para evaluar genomas. Se crea una vez por
+ * hilo; después evaluar solo reutiliza estos buffers.
+ */
+struct alignas(64) PolicyTrainer::EvaluationArena {
+    BatchEnvironment environment;
+    ObservationEncoder encoder;
+    PolicyNetwork network;
+    PolicyWorkspace workspace;
+    std::vector<std::uint8_t> observation;      // Una partida
+    std::vector<float> inputs;                  // Partidas en curso, compactadas
+    std::vector<std::int8_t> activeActions;
+    std::vector<std::int8_t> actions;           // Una por partida del entorno
+    std::vector<std::uint32_t> activeGames;
+    std::vector<std::int32_t> foods;
+    std::vector<std::int32_t> ticks;
+    std::uint64_t steps;
+
+    EvaluationArena(const TrainerConfig& config, const PolicyNetwork& prototype)
+        : environment(config.gamesPerEvaluation, config.gridWidth, config.gridHeight, config.rules),
+          encoder(environment, ObservationEncoder::Format::UINT8, config.viewRadius), network(prototype),
+          observation(encoder.GetObservationSize()), inputs(config.gamesPerEvaluation * prototype.GetInputSize()),
+          activeActions(config.gamesPerEvaluation), actions(config.gamesPerEvaluation),
+          activeGames(config.gamesPerEvaluation), foods(config.gamesPerEvaluation), ticks(config.gamesPerEvaluation),
+          steps(0) {
+        environment.SetMaxEpisodeTicks(config.maxEpisodeTicks);
+    }
+};
+
+PolicyTrainer::PolicyTrainer()
+    : parameterCount(0), bestFitness(0.0f), generation(0), randomState(1),
+      threadCount(ThreadPool::GetDefaultThreadCount()) {
+}
+
+PolicyTrainer::~PolicyTrainer() = default;
+
+// Métodos principales (verbos)
+bool PolicyTrainer::Configure(const TrainerConfig& trainerConfig) {
+    if (trainerConfig.populationSize < 2 || trainerConfig.populationSize > MAX_POPULATION ||
+        trainerConfig.eliteCount >= trainerConfig.populationSize || trainerConfig.tournamentSize < 1 ||
+        trainerConfig.gamesPerEvaluation == 0 || trainerConfig.viewRadius < 1 ||
+        trainerConfig.mutationStrength < 0.0f || trainerConfig.maxEpisodeTicks == 0) {
+        std::cerr << "Failed to configure trainer: invalid population or evaluation settings" << std::endl;
+        return false;
+    }
+
+    int side = 2 * trainerConfig.viewRadius + 1;
+    PolicyNetwork network;
+    if (!network.Configure(ObservationEncoder::PLANE_COUNT, side, side, BuildLayers(trainerConfig))) {
+        std::cerr << "Failed to configure trainer: invalid network layers" << std::endl;
+        return false;
+    }
+
+    config = trainerConfig;
+    prototype = std::move(network);
+    parameterCount = prototype.GetParameterCount();
+    population.resize(config.populationSize * parameterCount);
+    nextPopulation.resize(population.size());
+    fitness.assign(config.populationSize, 0.0f);
+    ranking.resize(config.populationSize);
+    bestGenome.assign(parameterCount, 0.0f);
+    bestFitness = 0.0f;
+    generation = 0;
+    randomState = GenerationSeed(config.seed, ~0ULL) | 1;
+    history.clear();
+
+    // Cada individuo con su propia inicialización de He
+    for (size_t member = 0; member < config.populationSize; member++) {
+        prototype.InitializeRandom(config.seed * config.populationSize + member);
+        std::copy(prototype.GetParameters().begin(), prototype.GetParameters().end(),
+                  population.begin() + member * parameterCount);
+    }
+    bestGenome.assign(population.begin(), population.begin() + parameterCount);
+
+    // Las arenas dependen de la configuración: se crean en el próximo Evaluate
+    pool.reset();
+    arenas.clear();
+    return true;
+}
+
+GenerationStats PolicyTrainer::Evaluate() {
+    GenerationStats stats = GenerationStats();
+    stats.generation = generation;
+    if (!IsConfigured()) return stats;
+
+    if (arenas.empty()) {
+        BuildArenas();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::uint64_t seed = GenerationSeed(config.seed, generation);
+    std::atomic<size_t> nextMember(0);
+
+    // Un trabajo por hilo; cada uno toma genomas hasta agotar la población
+    std::vector<std::future<void>> pending;
+    for (size_t worker = 0; worker < arenas.size(); worker++) {
+        EvaluationArena* arena = arenas[worker].get();
+        arena->steps = 0;
+        pending.push_back(pool->Submit([this, arena, seed, &nextMember]() {
+            for (size_t member = nextMember.fetch_add(1); member < config.populationSize;
+                 member = nextMember.fetch_add(1)) {
+                fitness[member] = EvaluateGenome(*arena, &population[member * parameterCount], seed);
+            }
+        }));
+    }
+    for (std::future<void>& result : pending) {
+        result.get();
+    }
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Orden estable: con aptitudes iguales gana el índice menor
+    for (size_t member = 0; member < ranking.size(); member++) {
+        ranking[member] = member;
+    }
+    std::stable_sort(ranking.begin(), ranking.end(), [this](size_t a, size_t b) { return fitness[a] > fitness[b]; });
+
+    double sum = 0.0;
+    for (float value : fitness) {
+        sum += value;
+    }
+    for (const std::unique_ptr<EvaluationArena>& arena : arenas) {
+        stats.steps += arena->steps;
+    }
+    stats.evaluations = config.populationSize;
+    stats.bestFitness = fitness[ranking.front()];
+    stats.meanFitness = static_cast<float>(sum / static_cast<double>(fitness.size()));
+    stats.medianFitness = fitness[ranking[ranking.size() / 2]];
+    stats.worstFitness = fitness[ranking.back()];
+    return stats;
+}
+
+GenerationStats PolicyTrainer::RunGeneration() {
+    GenerationStats stats = Evaluate();
+    if (!IsConfigured()) return stats;
+
+    const float* best = &population[ranking.front() * parameterCount];
+    bestGenome.assign(best, best + parameterCount);
+    bestFitness = stats.bestFitness;
+    history.push_back(stats);
+
+    Breed();
+    generation++;
+    return stats;
+}
+
+bool PolicyTrainer::SaveCheckpoint(const std::string& path) const {
+    if (!IsConfigured()) return false;
+
+    std::vector<CheckpointLayer> layers;
+    for (const PolicyLayer& layer : config.hiddenLayers) {
+        CheckpointLayer fileLayer;
+        fileLayer.type = static_cast<std::uint32_t>(layer.type);
+        fileLayer.outputs = static_cast<std::uint32_t>(layer.outputs);
+        fileLayer.hasRelu = layer.hasRelu ? 1 : 0;
+        layers.push_back(fileLayer);
+    }
+
+    CheckpointHeader header = CheckpointHeader();
+    std::memcpy(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic));
+    header.seed = config.seed;
+    header.generation = generation;
+    header.randomState = randomState;
+    header.populationSize = config.populationSize;
+    header.eliteCount = config.eliteCount;
+    header.gamesPerEvaluation = config.gamesPerEvaluation;
+    header.historyCount = history.size();
+    header.version = FORMAT_VERSION;
+    header.gridWidth = static_cast<std::uint32_t>(config.gridWidth);
+    header.gridHeight = static_cast<std::uint32_t>(config.gridHeight);
+    header.rules = PackRules(config.rules);
+    header.viewRadius = static_cast<std::uint32_t>(config.viewRadius);
+    header.layerCount = static_cast<std::uint32_t>(layers.size());
+    header.tournamentSize = static_cast<std::uint32_t>(config.tournamentSize);
+    header.maxEpisodeTicks = config.maxEpisodeTicks;
+    header.parameterCount = static_cast<std::uint32_t>(parameterCount);
+    header.mutationStrength = config.mutationStrength;
+    header.crossoverRate = config.crossoverRate;
+    header.bestFitness = bestFitness;
+
+    std::uint32_t checksum = Checksum::Crc32c(&header, sizeof(header));
+    checksum = Checksum::Crc32c(layers.data(), layers.size() * sizeof(CheckpointLayer), checksum);
+    checksum = Checksum::Crc32c(history.data(), history.size() * sizeof(GenerationStats), checksum);
+    checksum = Checksum::Crc32c(bestGenome.data(), bestGenome.size() * sizeof(float), checksum);
+    header.checksum = Checksum::Crc32c(population.data(), population.size() * sizeof(float), checksum);
+
+    const std::string temporaryPath = path + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            std::cerr << "Failed to create checkpoint: " << temporaryPath << std::endl;
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(layers.data()), layers.size() * sizeof(CheckpointLayer));
+        file.write(reinterpret_cast<const char*>(history.data()), history.size() * sizeof(GenerationStats));
+        file.write(reinterpret_cast<const char*>(bestGenome.data()), bestGenome.size() * sizeof(float));
+        file.write(reinterpret_cast<const char*>(population.data()), population.size() * sizeof(float));
+        if (!file.flush()) {
+            std::cerr << "Failed to write checkpoint: " << temporaryPath << std::endl;
+            return false;
+        }
+    }
+    return ReplaceFile(temporaryPath, path);
+}
+
+bool PolicyTrainer::LoadCheckpoint(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Failed to open checkpoint: " << path << std::endl;
+        return false;
+    }
+
+    CheckpointHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic)) != 0 || header.version != FORMAT_VERSION ||
+        header.layerCount > MAX_LAYER_COUNT || header.populationSize > MAX_POPULATION) {
+        std::cerr << "Failed to load checkpoint (not a checkpoint or unsupported version): " << path << std::endl;
+        return false;
+    }
+
+    std::vector<CheckpointLayer> layers(header.layerCount);
+    if (!file.read(reinterpret_cast<char*>(layers.data()), layers.size() * sizeof(CheckpointLayer))) {
+        std::cerr << "Failed to load checkpoint (truncated): " << path << std::endl;
+        return false;
+    }
+
+    // Lo que queda del archivo tiene que ser exactamente historial + mejor genoma + población,
+    // antes de reservar nada con los tamaños de la cabecera
+    std::error_code error;
+    std::uint64_t fileSize = std::filesystem::file_size(path, error);
+    std::uint64_t position = static_cast<std::uint64_t>(file.tellg());
+    std::uint64_t genomeBytes = (header.populationSize + 1) * header.parameterCount * sizeof(float);
+    std::uint64_t remaining = (!error && fileSize >= position) ? fileSize - position : 0;
+    if (genomeBytes > remaining || header.historyCount != (remaining - genomeBytes) / sizeof(GenerationStats) ||
+        (remaining - genomeBytes) % sizeof(GenerationStats) != 0) {
+        std::cerr << "Failed to load checkpoint (truncated): " << path << std::endl;
+        return false;
+    }
+
+    TrainerConfig loadedConfig;
+    loadedConfig.gridWidth = static_cast<int>(header.gridWidth);
+    loadedConfig.gridHeight = static_cast<int>(header.gridHeight);
+    loadedConfig.rules = UnpackRules(header.rules);
+    loadedConfig.viewRadius = static_cast<int>(header.viewRadius);
+    loadedConfig.hiddenLayers.clear();
+    for (const CheckpointLayer& layer : layers) {
+        if (layer.type > static_cast<std::uint32_t>(PolicyLayerType::DENSE)) {
+            std::cerr << "Failed to load checkpoint (invalid layer): " << path << std::endl;
+            return false;
+        }
+        loadedConfig.hiddenLayers.emplace_back(static_cast<PolicyLayerType>(layer.type),
+                                               static_cast<int>(layer.outputs), layer.hasRelu != 0);
+    }
+    loadedConfig.populationSize = static_cast<size_t>(header.populationSize);
+    loadedConfig.eliteCount = static_cast<size_t>(header.eliteCount);
+    loadedConfig.tournamentSize = static_cast<int>(header.tournamentSize);
+    loadedConfig.mutationStrength = header.mutationStrength;
+    loadedConfig.crossoverRate = header.crossoverRate;
+    loadedConfig.gamesPerEvaluation = static_cast<size_t>(header.gamesPerEvaluation);
+    loadedConfig.maxEpisodeTicks = header.maxEpisodeTicks;
+    loadedConfig.seed = header.seed;
+
+    // Configure valida la forma; los datos se leen aparte y solo se aplican si el CRC cuadra
+    PolicyTrainer loaded;
+    if (!loaded.Configure(loadedConfig) || loaded.parameterCount != header.parameterCount) {
+        std::cerr << "Failed to load checkpoint (shape does not match the parameters): " << path << std::endl;
+        return false;
+    }
+
+    std::vector<GenerationStats> loadedHistory(static_cast<size_t>(header.historyCount));
+    if (!file.read(reinterpret_cast<char*>(loadedHistory.data()), loadedHistory.size() * sizeof(GenerationStats)) ||
+        !file.read(reinterpret_cast<char*>(loaded.bestGenome.data()), loaded.bestGenome.size() * sizeof(float)) ||
+        !file.read(reinterpret_cast<char*>(loaded.population.data()), loaded.population.size() * sizeof(float))) {
+        std::cerr << "Failed to load checkpoint (truncated): " << path << std::endl;
+        return false;
+    }
+
+    CheckpointHeader checkedHeader = header;
+    checkedHeader.checksum = 0;
+    std::uint32_t checksum = Checksum::Crc32c(&checkedHeader, sizeof(checkedHeader));
+    checksum = Checksum::Crc32c(layers.data(), layers.size() * sizeof(CheckpointLayer), checksum);
+    checksum = Checksum::Crc32c(loadedHistory.data(), loadedHistory.size() * sizeof(GenerationStats), checksum);
+    checksum = Checksum::Crc32c(loaded.bestGenome.data(), loaded.bestGenome.size() * sizeof(float), checksum);
+    checksum = Checksum::Crc32c(loaded.population.data(), loaded.population.size() * sizeof(float), checksum);
+    if (checksum != header.checksum) {
+        std::cerr << "Failed to load checkpoint (checksum mismatch): " << path << std::endl;
+        return false;
+    }
+
+    config = loadedConfig;
+    prototype = std::move(loaded.prototype);
+    parameterCount = loaded.parameterCount;
+    population = std::move(loaded.population);
+    nextPopulation.resize(population.size());
+    fitness.assign(config.populationSize, 0.0f);
+    ranking.resize(config.populationSize);
+    bestGenome = std::move(loaded.bestGenome);
+    bestFitness = header.bestFitness;
+    generation = header.generation;
+    randomState = header.randomState != 0 ? header.randomState : 1;
+    history = std::move(loadedHistory);
+
+    pool.reset();
+    arenas.clear();
+    return true;
+}
+
+bool PolicyTrainer::SaveBestPolicy(const std::string& path) const {
+    if (!IsConfigured()) return false;
+
+    PolicyNetwork network = prototype;
+    network.SetParameters(bestGenome.data());
+    const std::string temporaryPath = path + ".tmp";
+    return network.SaveToFile(temporaryPath) && ReplaceFile(temporaryPath, path);
+}
+
+// Setters
+void PolicyTrainer::SetThreadCount(size_t count) {
+    threadCount = std::max<size_t>(count, 1);
+    pool.reset();
+    arenas.clear();
+}
+
+// Métodos privados
+void PolicyTrainer::BuildArenas() {
+    for (size_t worker = 0; worker < threadCount; worker++) {
+        arenas.push_back(std::make_unique<EvaluationArena>(config, prototype));
+    }
+    pool = std::make_unique<ThreadPool>(threadCount);
+}
+
+float PolicyTrainer::EvaluateGenome(EvaluationArena& arena, const float* genome, std::uint64_t seed) const {
+    const size_t gameCount = config.gamesPerEvaluation;
+    const size_t inputSize = prototype.GetInputSize();
+
+    arena.network.SetParameters(genome);
+    arena.environment.Reset(seed);
+    for (size_t game = 0; game < gameCount; game++) {
+        arena.activeGames[game] = static_cast<std::uint32_t>(game);
+    }
+    std::fill(arena.foods.begin(), arena.foods.end(), 0);
+    std::fill(arena.ticks.begin(), arena.ticks.end(), 0);
+
+    // Cuenta solo la primera partida de cada entorno. Las que ya terminaron
+    // se reinician solas y siguen recto, pero no pasan por la red
+    size_t activeCount = gameCount;
+    while (activeCount > 0) {
+        for (size_t slot = 0; slot < activeCount; slot++) {
+            arena.encoder.EncodeGame(arena.environment, arena.activeGames[slot], arena.observation.data());
+            arena.encoder.ConvertToPolicyInput(arena.observation.data(), &arena.inputs[slot * inputSize]);
+        }
+        arena.network.SelectActions(arena.inputs.data(), activeCount, arena.activeActions.data(), arena.workspace);
+
+        std::fill(arena.actions.begin(), arena.actions.end(), static_cast<std::int8_t>(BatchEnvironment::NO_ACTION));
+        for (size_t slot = 0; slot < activeCount; slot++) {
+            arena.actions[arena.activeGames[slot]] = arena.activeActions[slot];
+        }
+        arena.environment.Step(arena.actions.data());
+        arena.steps += activeCount;
+
+        const float* rewards = arena.environment.GetRewards();
+        const std::uint8_t* dones = arena.environment.GetDones();
+        size_t kept = 0;
+        for (size_t slot = 0; slot < activeCount; slot++) {
+            std::uint32_t game = arena.activeGames[slot];
+            arena.ticks[game]++;
+            if (rewards[game] > 0.0f) arena.foods[game]++;
+            if (!dones[game]) arena.activeGames[kept++] = game;
+        }
+        activeCount = kept;
+    }
+
+    double total = 0.0;
+    for (size_t game = 0; game < gameCount; game++) {
+        total += arena.foods[game] + SURVIVAL_BONUS * arena.ticks[game];
+    }
+    return static_cast<float>(total / static_cast<double>(gameCount));
+}
+
+void PolicyTrainer::Breed() {
+    // ranking ya está ordenado por Evaluate; las élites se copian tal cual
+    for (size_t member = 0; member < config.eliteCount; member++) {
+        std::copy_n(&population[ranking[member] * parameterCount], parameterCount,
+                    &nextPopulation[member * parameterCount]);
+    }
+
+    for (size_t member = config.eliteCount; member < config.populationSize; member++) {
+        float* child = &nextPopulation[member * parameterCount];
+        const float* parent = &population[SelectParent() * parameterCount];
+        std::copy_n(parent, parameterCount, child);
+
+        if (config.crossoverRate > 0.0f && NextUniform() < config.crossoverRate) {
+            const float* other = &population[SelectParent() * parameterCount];
+            for (size_t index = 0; index < parameterCount; index += 64) {
+                // Un número aleatorio decide 64 pesos seguidos
+                std::uint64_t mask = NextRandom();
+                size_t end = std::min(parameterCount, index + 64);
+                for (size_t i = index; i < end; i++) {
+                    if ((mask >> (i - index)) & 1) child[i] = other[i];
+                }
+            }
+        }
+
+        for (size_t index = 0; index < parameterCount; index++) {
+            child[index] += config.mutationStrength * NextGaussian();
+        }
+    }
+
+    population.swap(nextPopulation);
+}
+
+size_t PolicyTrainer::SelectParent() {
+    // Torneo: el mejor de tournamentSize individuos al azar (menor posición en ranking)
+    size_t best = config.populationSize;
+    for (int round = 0; round < config.tournamentSize; round++) {
+        best = std::min<size_t>(best, NextRandom() % config.populationSize);
+    }
+    return ranking[best];
+}
+
+std::uint64_t PolicyTrainer::NextRandom() {
+    // xorshift64*, igual que PolicyNetwork::InitializeRandom
+    randomState ^= randomState >> 12;
+    randomState ^= randomState << 25;
+    randomState ^= randomState >> 27;
+    return randomState * 0x2545F4914F6CDD1DULL;
+}
+
+double PolicyTrainer::NextUniform() {
+    return static_cast<double>(NextRandom() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+float PolicyTrainer::NextGaussian() {
+    // Box-Muller; se usa solo uno de los dos valores para no guardar estado extra
+    double radius = std::sqrt(-2.0 * std::log(1.0 - NextUniform()));
+    return static_cast<float>(radius * std::cos(6.283185307179586 * NextUniform()));
+}
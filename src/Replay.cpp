@@ -0,0 +1,151 @@
+#include "Replay.hpp"
+#include "GameSimulation.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+Replay::Replay() : gridWidth(0), gridHeight(0), seed(0), tickCount(0) {
+}
+
+Replay::~Replay() {
+}
+
+void Replay::Begin(int width, int height, std::uint32_t newSeed, const GameRules& gameRules) {
+    gridWidth = width;
+    gridHeight = height;
+    seed = newSeed;
+    rules = gameRules;
+    tickCount = 0;
+    events.clear();
+}
+
+void Replay::RecordDirection(std::uint64_t tick, Direction direction) {
+    events.emplace_back(tick, direction);
+}
+
+void Replay::Finish(std::uint64_t totalTicks) {
+    tickCount = totalTicks;
+}
+
+size_t Replay::ApplyPendingEvents(GameSimulation& simulation, size_t cursor) const {
+    // Aplicar en orden todas las entradas registradas para el tick actual
+    while (cursor < events.size() && events[cursor].tick <= simulation.GetTickCount()) {
+        simulation.ChangeDirection(events[cursor].direction);
+        cursor++;
+    }
+    return cursor;
+}
+
+bool Replay::SaveToFile(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Failed to save replay: " << path << std::endl;
+        return false;
+    }
+    
+    file << "SNAKE_REPLAY 1\n";
+    file << "grid " << gridWidth << " " << gridHeight << "\n";
+    file << "seed " << seed << "\n";
+    if (rules != GameRules()) {
+        file << "rules " << rules.ToString() << "\n";
+    }
+    file << "ticks " << tickCount << "\n";
+    for (const auto& event : events) {
+        file << "turn " << event.tick << " " << DirectionToChar(event.direction) << "\n";
+    }
+    
+    return static_cast<bool>(file);
+}
+
+bool Replay::LoadFromFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Failed to open replay: " << path << std::endl;
+        return false;
+    }
+    
+    std::string line;
+    if (!std::getline(file, line) || line != "SNAKE_REPLAY 1") {
+        std::cerr << "Invalid replay header: " << path << std::endl;
+        return false;
+    }
+    
+    Begin(0, 0, 0);
+    
+    int lineNumber = 1;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (line.empty()) continue;
+        
+        std::istringstream fields(line);
+        std::string key;
+        fields >> key;
+        
+        bool valid = true;
+        if (key == "grid") {
+            valid = static_cast<bool>(fields >> gridWidth >> gridHeight);
+        } else if (key == "seed") {
+            valid = static_cast<bool>(fields >> seed);
+        } else if (key == "rules") {
+            std::string names;
+            valid = (fields >> names) && GameRules::FromString(names, rules);
+        } else if (key == "ticks") {
+            valid = static_cast<bool>(fields >> tickCount);
+        } else if (key == "turn") {
+            std::uint64_t tick;
+            char value;
+            Direction direction;
+            valid = (fields >> tick >> value) && CharToDirection(value, direction);
+            if (valid) {
+                RecordDirection(tick, direction);
+            }
+        } else {
+            valid = false;
+        }
+        
+        if (!valid) {
+            std::cerr << path << ":" << lineNumber << ": invalid replay line" << std::endl;
+            return false;
+        }
+    }
+    
+    if (gridWidth <= 0 || gridHeight <= 0) {
+        std::cerr << "Replay has no grid size: " << path << std::endl;
+        return false;
+    }
+    
+    return true;
+}
+
+// Métodos de utilidad
+char Replay::DirectionToChar(Direction direction) {
+    switch (direction) {
+        case Direction::UP:
+            return 'U';
+        case Direction::DOWN:
+            return 'D';
+        case Direction::LEFT:
+            return 'L';
+        case Direction::RIGHT:
+            return 'R';
+    }
+    return 'R';
+}
+
+bool Replay::CharToDirection(char value, Direction& direction) {
+    switch (value) {
+        case 'U':
+            direction = Direction::UP;
+            return true;
+        case 'D':
+            direction = Direction::DOWN;
+            return true;
+        case 'L':
+            direction = Direction::LEFT;
+            return true;
+        case 'R':
+            direction = Direction::RIGHT;
+            return true;
+    }
+    return false;
+}
@@ -0,0 +1,296 @@
+#include "ReplayExporter.hpp"
+#include "GameRenderer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <thread>
+#include <utility>
+
+namespace {
+
+const std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+const std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+// Variante de FNV-1a que consume palabras de 64 bits (8 veces menos
+// multiplicaciones dependientes que la versión byte a byte)
+std::uint64_t HashBytes(const std::uint8_t* data, size_t size, std::uint64_t hash = FNV_OFFSET_BASIS) {
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash ^= word;
+        hash *= FNV_PRIME;
+    }
+    for (; i < size; i++) {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+inline std::uint8_t ClampByte(int value) {
+    return static_cast<std::uint8_t>(std::min(std::max(value, 0), 255));
+}
+
+} // namespace
+
+ReplayExporter::ReplayExporter(const ExportOptions& exportOptions)
+    : options(exportOptions), framesWritten(0), failed(false) {
+}
+
+ReplayExporter::~ReplayExporter() {
+}
+
+bool ReplayExporter::Export(const Replay& replay, ExportStats& stats) {
+    stats = ExportStats();
+    framesWritten = 0;
+    failed = false;
+
+    const int workerCount = std::max(1, options.threadCount);
+    const std::uint64_t maxFramesInFlight = static_cast<std::uint64_t>(std::max(1, options.queueCapacity));
+
+    BoundedQueue<FrameJob> jobs(maxFramesInFlight);
+    BoundedQueue<EncodedFrame> encoded(maxFramesInFlight);
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Decodificar los assets una vez; los workers comparten las imágenes (solo lectura)
+    GameRenderer assets;
+    if (assets.InitializeHeadless(1, 1)) {
+        assets.LoadAssets();
+    }
+
+    std::thread writer(&ReplayExporter::RunWriter, this, std::ref(encoded), std::ref(stats));
+    std::vector<std::thread> workers;
+    for (int i = 0; i < workerCount; i++) {
+        workers.emplace_back(&ReplayExporter::RunRenderWorker, this, std::cref(assets), std::ref(jobs),
+                             std::ref(encoded));
+    }
+
+    // Etapa 1: reproducir la partida y emitir un estado por tick
+    GameSimulation simulation(replay.GetGridWidth(), replay.GetGridHeight());
+    simulation.SetRules(replay.GetRules());
+    simulation.Reset(replay.GetSeed());
+
+    size_t cursor = 0;
+    std::uint64_t frameCount = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(progressMutex);
+            progressChanged.wait(lock, [&]() {
+                return failed || frameCount - framesWritten < maxFramesInFlight;
+            });
+            if (failed) break;
+        }
+
+        const Food& food = simulation.GetFood();
+        FrameJob job{ frameCount, simulation.GetSnake(), food.GetPosition(), food.IsActive(),
+                      simulation.GetScore(), simulation.IsGameOver() };
+        if (!jobs.Push(std::move(job))) break;
+        frameCount++;
+
+        if (simulation.IsGameOver() || simulation.GetTickCount() >= replay.GetTickCount()) {
+            break;
+        }
+
+        cursor = replay.ApplyPendingEvents(simulation, cursor);
+        simulation.Tick();
+    }
+
+    jobs.Close();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    encoded.Close();
+    writer.join();
+
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return !failed && stats.frames == frameCount;
+}
+
+void ReplayExporter::ConvertToI420(const std::uint8_t* rgba, int width, int height, std::vector<std::uint8_t>& output) {
+    const int chromaWidth = (width + 1) / 2;
+    const int chromaHeight = (height + 1) / 2;
+    const size_t lumaSize = static_cast<size_t>(width) * height;
+    const size_t chromaSize = static_cast<size_t>(chromaWidth) * chromaHeight;
+
+    size_t offset = output.size();
+    output.resize(offset + lumaSize + 2 * chromaSize);
+
+    std::uint8_t* planeY = output.data() + offset;
+    std::uint8_t* planeU = planeY + lumaSize;
+    std::uint8_t* planeV = planeU + chromaSize;
+
+    // BT.601 rango limitado, aritmética entera
+    for (int y = 0; y < height; y++) {
+        const std::uint8_t* row = rgba + static_cast<size_t>(y) * width * 4;
+        std::uint8_t* lumaRow = planeY + static_cast<size_t>(y) * width;
+        for (int x = 0; x < width; x++) {
+            int r = row[x * 4];
+            int g = row[x * 4 + 1];
+            int b = row[x * 4 + 2];
+            lumaRow[x] = static_cast<std::uint8_t>(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+        }
+    }
+
+    // Croma submuestreado: promedio de cada bloque 2x2
+    for (int cy = 0; cy < chromaHeight; cy++) {
+        int y0 = cy * 2;
+        int y1 = std::min(y0 + 1, height - 1);
+        const std::uint8_t* row0 = rgba + static_cast<size_t>(y0) * width * 4;
+        const std::uint8_t* row1 = rgba + static_cast<size_t>(y1) * width * 4;
+
+        for (int cx = 0; cx < chromaWidth; cx++) {
+            int x0 = cx * 2;
+            int x1 = std::min(x0 + 1, width - 1);
+
+            int r = row0[x0 * 4] + row0[x1 * 4] + row1[x0 * 4] + row1[x1 * 4];
+            int g = row0[x0 * 4 + 1] + row0[x1 * 4 + 1] + row1[x0 * 4 + 1] + row1[x1 * 4 + 1];
+            int b = row0[x0 * 4 + 2] + row0[x1 * 4 + 2] + row1[x0 * 4 + 2] + row1[x1 * 4 + 2];
+            r = (r + 2) >> 2;
+            g = (g + 2) >> 2;
+            b = (b + 2) >> 2;
+
+            size_t index = static_cast<size_t>(cy) * chromaWidth + cx;
+            planeU[index] = ClampByte(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+            planeV[index] = ClampByte(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+        }
+    }
+}
+
+// Métodos privados
+void ReplayExporter::RunRenderWorker(const GameRenderer& assets, BoundedQueue<FrameJob>& jobs,
+                                     BoundedQueue<EncodedFrame>& encoded) {
+    GameRenderer renderer;
+    bool ready = renderer.InitializeHeadless(options.frameWidth, options.frameHeight);
+    if (ready) {
+        renderer.ShareImages(assets);
+    } else {
+        MarkFailed();
+    }
+
+    // La comida del frame se reconstruye sobre un objeto propio del worker
+    Food food;
+    FrameJob job{ 0, Snake(0, 0), Position(), false, 0, false };
+    while (jobs.Pop(job)) {
+        // Si el worker no pudo inicializarse solo vacía la cola
+        if (!ready) continue;
+
+        renderer.Clear();
+        if (job.isGameOver) {
+            renderer.RenderGameOverScreen();
+            renderer.RenderScore(job.score);
+        } else {
+            food.SetPosition(job.foodPosition);
+            food.SetActive(job.isFoodActive);
+            renderer.RenderPlayfield(job.snake, food, job.score);
+        }
+        renderer.Present();
+
+        EncodedFrame frame;
+        frame.index = job.index;
+        frame.hash = FNV_OFFSET_BASIS;
+
+        if (options.format == ExportFormat::PNG_SEQUENCE) {
+            // Cada worker escribe su propio archivo; el escritor solo lleva la cuenta.
+            // La huella es la de los píxeles RGBA, independiente del codificador PNG
+            if (!options.discardOutput && !renderer.CaptureFrame(GetFramePath(job.index))) {
+                MarkFailed();
+            }
+            frame.hash = HashBytes(renderer.GetRasterizer()->GetPixels(),
+                                   static_cast<size_t>(options.frameWidth) * options.frameHeight * 4);
+        } else {
+            static const char frameHeader[] = "FRAME\n";
+            frame.data.reserve(sizeof(frameHeader) - 1 +
+                               static_cast<size_t>(options.frameWidth) * options.frameHeight * 3 / 2);
+            frame.data.assign(frameHeader, frameHeader + sizeof(frameHeader) - 1);
+            ConvertToI420(renderer.GetRasterizer()->GetPixels(), options.frameWidth, options.frameHeight, frame.data);
+            frame.hash = HashBytes(frame.data.data(), frame.data.size());
+        }
+
+        if (!encoded.Push(std::move(frame))) break;
+    }
+}
+
+void ReplayExporter::RunWriter(BoundedQueue<EncodedFrame>& encoded, ExportStats& stats) {
+    std::ofstream file;
+    bool writeFile = options.format == ExportFormat::Y4M && !options.discardOutput;
+
+    stats.checksum = FNV_OFFSET_BASIS;
+
+    if (options.format == ExportFormat::Y4M) {
+        std::string header = GetY4mHeader();
+        stats.checksum = HashBytes(reinterpret_cast<const std::uint8_t*>(header.data()), header.size(), stats.checksum);
+        stats.bytesWritten += header.size();
+
+        if (writeFile) {
+            file.open(options.outputPath, std::ios::binary);
+            if (!file) {
+                std::cerr << "Failed to create video file: " << options.outputPath << std::endl;
+                MarkFailed();
+                writeFile = false;
+            } else {
+                file.write(header.data(), header.size());
+            }
+        }
+    }
+
+    // Los workers terminan en cualquier orden; reordenar por índice
+    std::map<std::uint64_t, EncodedFrame> pending;
+    std::uint64_t nextIndex = 0;
+    EncodedFrame frame;
+
+    while (encoded.Pop(frame)) {
+        std::uint64_t index = frame.index;
+        pending.emplace(index, std::move(frame));
+
+        auto it = pending.find(nextIndex);
+        while (it != pending.end()) {
+            const std::vector<std::uint8_t>& data = it->second.data;
+            stats.checksum = (stats.checksum ^ it->second.hash) * FNV_PRIME;
+            stats.bytesWritten += data.size();
+
+            if (writeFile && !file.write(reinterpret_cast<const char*>(data.data()), data.size())) {
+                std::cerr << "Failed to write video frame " << nextIndex << std::endl;
+                MarkFailed();
+                writeFile = false;
+            }
+
+            pending.erase(it);
+            nextIndex++;
+            stats.frames++;
+            MarkFrameWritten();
+            it = pending.find(nextIndex);
+        }
+    }
+}
+
+std::string ReplayExporter::GetFramePath(std::uint64_t index) const {
+    char suffix[32];
+    std::snprintf(suffix, sizeof(suffix), "_%06llu.png", static_cast<unsigned long long>(index));
+    return options.outputPath + suffix;
+}
+
+std::string ReplayExporter::GetY4mHeader() const {
+    return "YUV4MPEG2 W" + std::to_string(options.frameWidth) +
+           " H" + std::to_string(options.frameHeight) +
+           " F" + std::to_string(options.framesPerSecond) + ":1 Ip A1:1 C420jpeg\n";
+}
+
+void ReplayExporter::MarkFrameWritten() {
+    std::lock_guard<std::mutex> lock(progressMutex);
+    framesWritten++;
+    progressChanged.notify_one();
+}
+
+void ReplayExporter::MarkFailed() {
+    std::lock_guard<std::mutex> lock(progressMutex);
+    failed = true;
+    progressChanged.notify_all();
+}
@@ -0,0 +1,554 @@
+#include "ScoreStore.hpp"
+#include "Checksum.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SNAKE_SCORE_STORE_POSIX 1
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <io.h>
+#endif
+
+namespace {
+
+const char LOG_MAGIC[8] = { 'S', 'N', 'K', 'S', 'L', 'O', 'G', '\0' };
+const char SNAPSHOT_MAGIC[8] = { 'S', 'N', 'K', 'S', 'N', 'A', 'P', '\0' };
+const std::uint32_t FORMAT_VERSION = 1;
+
+struct LogHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t recordSize;
+};
+
+struct SnapshotHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t recordSize;
+    std::uint64_t count;
+    std::uint32_t payloadChecksum;
+    std::uint32_t headerChecksum;       // De los campos anteriores
+};
+
+// Cada entrada del log es el registro seguido de su CRC32C
+const size_t LOG_FRAME_SIZE = sizeof(ScoreRecord) + sizeof(std::uint32_t);
+const size_t CHUNK_RECORDS = 64 * 1024;
+
+std::uint32_t FrameChecksum(const ScoreRecord& record) {
+    return Checksum::Crc32c(&record, sizeof(record));
+}
+
+// fflush solo llega al sistema operativo; esto llega al disco
+bool SyncFile(std::FILE* file) {
+    if (std::fflush(file) != 0) return false;
+#if defined(__linux__)
+    return fdatasync(fileno(file)) == 0;
+#elif defined(SNAKE_SCORE_STORE_POSIX)
+    return fsync(fileno(file)) == 0;
+#elif defined(_WIN32)
+    return _commit(_fileno(file)) == 0;
+#else
+    return true;
+#endif
+}
+
+// Hace duradero un rename o la creación de un archivo en el directorio
+void SyncDirectory(const std::string& directory) {
+#ifdef SNAKE_SCORE_STORE_POSIX
+    int fd = open(directory.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        fsync(fd);
+        close(fd);
+    }
+#else
+    (void)directory;
+#endif
+}
+
+bool WriteLogHeader(std::FILE* file) {
+    LogHeader header;
+    std::memcpy(header.magic, LOG_MAGIC, sizeof(header.magic));
+    header.version = FORMAT_VERSION;
+    header.recordSize = sizeof(ScoreRecord);
+    return std::fwrite(&header, sizeof(header), 1, file) == 1;
+}
+
+bool ReadLogHeader(std::FILE* file) {
+    LogHeader header;
+    return std::fread(&header, sizeof(header), 1, file) == 1 &&
+           std::memcmp(header.magic, LOG_MAGIC, sizeof(header.magic)) == 0 &&
+           header.version == FORMAT_VERSION && header.recordSize == sizeof(ScoreRecord);
+}
+
+bool ReadSnapshotHeader(std::FILE* file, SnapshotHeader& header) {
+    return std::fread(&header, sizeof(header), 1, file) == 1 &&
+           std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) == 0 &&
+           header.version == FORMAT_VERSION && header.recordSize == sizeof(ScoreRecord) &&
+           header.headerChecksum == Checksum::Crc32c(&header, offsetof(SnapshotHeader, headerChecksum));
+}
+
+void AppendFrames(const ScoreRecord* source, size_t count, std::vector<std::uint8_t>& buffer) {
+    size_t offset = buffer.size();
+    buffer.resize(offset + count * LOG_FRAME_SIZE);
+    for (size_t i = 0; i < count; i++) {
+        const ScoreRecord& record = source[i];
+        std::uint32_t checksum = FrameChecksum(record);
+        std::memcpy(buffer.data() + offset, &record, sizeof(record));
+        std::memcpy(buffer.data() + offset + sizeof(record), &checksum, sizeof(checksum));
+        offset += LOG_FRAME_SIZE;
+    }
+}
+
+// Recorre las entradas válidas del log en orden; se detiene en la primera rota.
+// Devuelve el desplazamiento del final de la última entrada válida
+template<typename Visitor>
+std::uint64_t ScanLog(std::FILE* file, Visitor visit) {
+    std::vector<std::uint8_t> chunk(CHUNK_RECORDS * LOG_FRAME_SIZE);
+    std::uint64_t validEnd = sizeof(LogHeader);
+    std::uint64_t lastSequence = 0;
+
+    while (true) {
+        size_t bytes = std::fread(chunk.data(), 1, chunk.size(), file);
+        size_t frames = bytes / LOG_FRAME_SIZE;
+
+        for (size_t i = 0; i < frames; i++) {
+            const std::uint8_t* frame = chunk.data() + i * LOG_FRAME_SIZE;
+            ScoreRecord record;
+            std::uint32_t checksum;
+            std::memcpy(&record, frame, sizeof(record));
+            std::memcpy(&checksum, frame + sizeof(record), sizeof(checksum));
+
+            // Una secuencia que no avanza también es basura de una escritura a medias
+            if (checksum != FrameChecksum(record) || record.sequence <= lastSequence) {
+                return validEnd;
+            }
+            lastSequence = record.sequence;
+            validEnd += LOG_FRAME_SIZE;
+            visit(record);
+        }
+
+        if (bytes < chunk.size()) break;
+    }
+    return validEnd;
+}
+
+} // namespace
+
+ScoreStore::ScoreStore()
+    : nextSequence(1), compactThreshold(DEFAULT_COMPACT_THRESHOLD), isOpen(false),
+      durableSequence(0), isCompactRequested(false), isStopping(false), isFailed(false),
+      logFile(nullptr), logRecordCount(0), logValidEnd(0), isLogDirty(false) {
+}
+
+ScoreStore::~ScoreStore() {
+    Close();
+}
+
+bool ScoreStore::Open(const std::string& storeDirectory) {
+    Close();
+    directory = storeDirectory;
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        std::cerr << "Failed to create score directory: " << directory << std::endl;
+        return false;
+    }
+
+    if (!Recover() || !OpenLogForAppend()) {
+        return false;
+    }
+
+    nextSequence = records.empty() ? 1 : records.back().sequence + 1;
+    durableSequence = nextSequence - 1;
+    isCompactRequested = false;
+    isStopping = false;
+    isFailed = false;
+    flusher = std::thread(&ScoreStore::RunFlusher, this);
+    isOpen = true;
+    return true;
+}
+
+void ScoreStore::Close() {
+    if (!isOpen) return;
+
+    // El hilo de volcado escribe lo pendiente antes de salir
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isStopping = true;
+    }
+    wakeFlusher.notify_one();
+    flusher.join();
+
+    if (logFile) {
+        std::fclose(logFile);
+        logFile = nullptr;
+    }
+    isOpen = false;
+}
+
+const ScoreRecord& ScoreStore::Add(int score, std::uint32_t tickCount, std::uint64_t seed) {
+    ScoreRecord record;
+    record.sequence = nextSequence++;
+    record.timestamp = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    record.seed = seed;
+    record.score = score;
+    record.tickCount = tickCount;
+    records.push_back(record);
+
+    // Sin E/S en el hilo del juego: solo se encola
+    if (isOpen) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.push_back(record);
+        }
+        wakeFlusher.notify_one();
+    }
+    return records.back();
+}
+
+bool ScoreStore::Flush() {
+    if (!isOpen) return false;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    const std::uint64_t target = nextSequence - 1;
+    flushed.wait(lock, [&]() { return durableSequence >= target || isFailed; });
+    return !isFailed;
+}
+
+bool ScoreStore::Compact() {
+    if (!isOpen) return false;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    isCompactRequested = true;
+    wakeFlusher.notify_one();
+    flushed.wait(lock, [&]() { return !isCompactRequested; });
+    return !isFailed;
+}
+
+bool ScoreStore::WriteLog(const std::string& path, const std::vector<ScoreRecord>& logRecords) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        std::cerr << "Failed to create score log: " << path << std::endl;
+        return false;
+    }
+
+    bool isWritten = WriteLogHeader(file);
+    std::vector<std::uint8_t> buffer;
+    for (size_t i = 0; isWritten && i < logRecords.size(); i += CHUNK_RECORDS) {
+        size_t end = std::min(logRecords.size(), i + CHUNK_RECORDS);
+        buffer.clear();
+        AppendFrames(logRecords.data() + i, end - i, buffer);
+        isWritten = std::fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    }
+
+    isWritten = isWritten && SyncFile(file);
+    std::fclose(file);
+    if (!isWritten) {
+        std::cerr << "Failed to write score log: " << path << std::endl;
+    }
+    return isWritten;
+}
+
+// Métodos privados
+bool ScoreStore::Recover() {
+    auto start = std::chrono::steady_clock::now();
+    recoveryStats = ScoreRecoveryStats();
+    records.clear();
+
+    // Reserva única según el tamaño de los archivos, con margen para que Add
+    // no tenga que copiar millones de entradas al crecer
+    std::error_code sizeError;
+    std::uint64_t snapshotSize = std::filesystem::file_size(GetSnapshotPath(), sizeError);
+    if (sizeError) snapshotSize = 0;
+    std::uint64_t logSize = std::filesystem::file_size(GetLogPath(), sizeError);
+    if (sizeError) logSize = 0;
+    size_t estimate = static_cast<size_t>(snapshotSize / sizeof(ScoreRecord) + logSize / LOG_FRAME_SIZE);
+    records.reserve(estimate + std::max<size_t>(estimate / 4, 4096));
+
+    if (std::filesystem::exists(GetSnapshotPath()) && !LoadSnapshot(GetSnapshotPath(), records)) {
+        // El snapshot se reemplaza con rename: uno inválido es corrupción del disco
+        std::cerr << "Score snapshot is corrupt, keeping it as " << GetSnapshotPath() << ".corrupt" << std::endl;
+        std::error_code error;
+        std::filesystem::rename(GetSnapshotPath(), GetSnapshotPath() + ".corrupt", error);
+        records.clear();
+    }
+    recoveryStats.snapshotRecords = records.size();
+
+    std::uint64_t lastSequence = records.empty() ? 0 : records.back().sequence;
+    if (std::filesystem::exists(GetLogPath()) && !ReplayLog(GetLogPath(), lastSequence)) {
+        return false;
+    }
+
+    recoveryStats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+bool ScoreStore::LoadSnapshot(const std::string& path, std::vector<ScoreRecord>& loaded) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return false;
+
+    SnapshotHeader header;
+    bool isValid = ReadSnapshotHeader(file, header);
+    if (isValid) {
+        // Una sola lectura contigua y un CRC de todo el bloque
+        loaded.resize(static_cast<size_t>(header.count));
+        isValid = std::fread(loaded.data(), sizeof(ScoreRecord), loaded.size(), file) == loaded.size() &&
+                  Checksum::Crc32c(loaded.data(), loaded.size() * sizeof(ScoreRecord)) == header.payloadChecksum;
+    }
+
+    std::fclose(file);
+    return isValid;
+}
+
+bool ScoreStore::ReplayLog(const std::string& path, std::uint64_t afterSequence) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        std::cerr << "Failed to open score log: " << path << std::endl;
+        return false;
+    }
+
+    if (!ReadLogHeader(file)) {
+        // Sin cabecera válida no se puede confiar en nada; se aparta y se empieza uno nuevo
+        std::fclose(file);
+        std::cerr << "Invalid score log header, keeping it as " << path << ".corrupt" << std::endl;
+        std::error_code error;
+        std::filesystem::rename(path, path + ".corrupt", error);
+        return true;
+    }
+
+    // Las entradas ya compactadas en el snapshot se saltan
+    std::uint64_t validEnd = ScanLog(file, [&](const ScoreRecord& record) {
+        if (record.sequence > afterSequence) {
+            records.push_back(record);
+            recoveryStats.logRecords++;
+        }
+    });
+    std::fclose(file);
+
+    // Cola de una escritura interrumpida: se trunca para seguir anexando detrás de lo válido
+    std::error_code error;
+    std::uint64_t size = std::filesystem::file_size(path, error);
+    if (!error && size > validEnd) {
+        recoveryStats.discardedBytes = size - validEnd;
+        std::filesystem::resize_file(path, validEnd, error);
+        if (error) {
+            std::cerr << "Failed to truncate score log: " << path << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ScoreStore::OpenLogForAppend() {
+    const std::string path = GetLogPath();
+    std::error_code error;
+    bool isNew = !std::filesystem::exists(path) || std::filesystem::file_size(path, error) == 0;
+
+    logFile = std::fopen(path.c_str(), "ab");
+    if (!logFile) {
+        std::cerr << "Failed to open score log: " << path << std::endl;
+        return false;
+    }
+
+    if (isNew) {
+        if (!WriteLogHeader(logFile) || !SyncFile(logFile)) {
+            std::cerr << "Failed to write score log header: " << path << std::endl;
+            return false;
+        }
+        SyncDirectory(directory);
+    }
+
+    std::uint64_t size = std::filesystem::file_size(path, error);
+    logValidEnd = error ? sizeof(LogHeader) : size;
+    isLogDirty = false;
+    logRecordCount = recoveryStats.logRecords;
+    return true;
+}
+
+void ScoreStore::RunFlusher() {
+    std::vector<ScoreRecord> batch;
+
+    while (true) {
+        bool isCompactNow;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeFlusher.wait(lock, [this]() { return isStopping || isCompactRequested || !pending.empty(); });
+            batch.swap(pending);
+            isCompactNow = isCompactRequested;
+            if (batch.empty() && !isCompactNow && isStopping) break;
+        }
+
+        // Un fdatasync por lote, nunca en el hilo del juego
+        bool isWritten = batch.empty() || AppendToLog(batch);
+        if (isWritten) {
+            logRecordCount += batch.size();
+        }
+
+        bool isCompactDue = compactThreshold > 0 && logRecordCount >= compactThreshold;
+        bool isCompacted = !(isWritten && (isCompactNow || isCompactDue)) || CompactFiles();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!isWritten || !isCompacted) {
+                isFailed = true;
+            } else if (!batch.empty()) {
+                durableSequence = batch.back().sequence;
+            }
+            if (isCompactNow) {
+                isCompactRequested = false;
+            }
+        }
+        flushed.notify_all();
+        batch.clear();
+    }
+}
+
+bool ScoreStore::AppendToLog(const std::vector<ScoreRecord>& batch) {
+    // Lo escrito tras un fallo puede ser un trozo de entrada: se quita antes de
+    // anexar, o las entradas buenas quedarían detrás de basura que la recuperación corta
+    if (isLogDirty && !TruncateLogToValidEnd()) {
+        return false;
+    }
+    if (!logFile) {
+        std::cerr << "Score log is not open: " << GetLogPath() << std::endl;
+        return false;
+    }
+
+    std::vector<std::uint8_t> buffer;
+    AppendFrames(batch.data(), batch.size(), buffer);
+
+    if (std::fwrite(buffer.data(), 1, buffer.size(), logFile) != buffer.size() || !SyncFile(logFile)) {
+        std::cerr << "Failed to write " << batch.size() << " scores to " << GetLogPath() << std::endl;
+        isLogDirty = true;
+        return false;
+    }
+    logValidEnd += buffer.size();
+    return true;
+}
+
+bool ScoreStore::TruncateLogToValidEnd() {
+    // Se cierra para descartar también lo que quedara en el búfer de stdio;
+    // en modo "ab" la siguiente escritura va al nuevo final
+    if (logFile) {
+        std::fclose(logFile);
+        logFile = nullptr;
+    }
+
+    std::error_code error;
+    std::filesystem::resize_file(GetLogPath(), logValidEnd, error);
+    if (!error) {
+        logFile = std::fopen(GetLogPath().c_str(), "ab");
+    }
+    if (error || !logFile || !SyncFile(logFile)) {
+        std::cerr << "Failed to truncate score log: " << GetLogPath() << std::endl;
+        return false;
+    }
+
+    isLogDirty = false;
+    return true;
+}
+
+bool ScoreStore::CompactFiles() {
+    // snapshot actual + log -> temporal -> rename. Solo después se vacía el
+    // log; si se corta antes, las entradas repetidas se saltan por secuencia
+    const std::string snapshotPath = GetSnapshotPath();
+    const std::string temporaryPath = snapshotPath + ".tmp";
+
+    std::FILE* output = std::fopen(temporaryPath.c_str(), "wb");
+    if (!output) {
+        std::cerr << "Failed to create score snapshot: " << temporaryPath << std::endl;
+        return false;
+    }
+
+    SnapshotHeader header = SnapshotHeader();
+    bool isValid = std::fwrite(&header, sizeof(header), 1, output) == 1;
+    std::uint32_t payloadChecksum = 0;
+    std::uint64_t count = 0;
+    std::uint64_t lastSequence = 0;
+
+    // Copiar el snapshot anterior por bloques, verificando su CRC al pasar
+    std::FILE* previous = std::fopen(snapshotPath.c_str(), "rb");
+    if (previous && isValid) {
+        SnapshotHeader previousHeader;
+        isValid = ReadSnapshotHeader(previous, previousHeader);
+        std::vector<ScoreRecord> chunk(CHUNK_RECORDS);
+        std::uint32_t previousChecksum = 0;
+
+        while (isValid && count < previousHeader.count) {
+            size_t wanted = static_cast<size_t>(std::min<std::uint64_t>(chunk.size(), previousHeader.count - count));
+            isValid = std::fread(chunk.data(), sizeof(ScoreRecord), wanted, previous) == wanted &&
+                      std::fwrite(chunk.data(), sizeof(ScoreRecord), wanted, output) == wanted;
+            previousChecksum = Checksum::Crc32c(chunk.data(), wanted * sizeof(ScoreRecord), previousChecksum);
+            count += wanted;
+            if (wanted > 0) lastSequence = chunk[wanted - 1].sequence;
+        }
+
+        isValid = isValid && previousChecksum == previousHeader.payloadChecksum;
+        payloadChecksum = previousChecksum;
+    }
+    if (previous) std::fclose(previous);
+
+    // Añadir las entradas del log que el snapshot todavía no tiene
+    std::FILE* log = isValid ? std::fopen(GetLogPath().c_str(), "rb") : nullptr;
+    if (log && ReadLogHeader(log)) {
+        std::vector<ScoreRecord> fresh;
+        fresh.reserve(CHUNK_RECORDS);
+        auto writeFresh = [&]() {
+            isValid = isValid && std::fwrite(fresh.data(), sizeof(ScoreRecord), fresh.size(), output) == fresh.size();
+            payloadChecksum = Checksum::Crc32c(fresh.data(), fresh.size() * sizeof(ScoreRecord), payloadChecksum);
+            count += fresh.size();
+            fresh.clear();
+        };
+
+        ScanLog(log, [&](const ScoreRecord& record) {
+            if (record.sequence <= lastSequence) return;
+            fresh.push_back(record);
+            if (fresh.size() == CHUNK_RECORDS) writeFresh();
+        });
+        writeFresh();
+    }
+    if (log) std::fclose(log);
+
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = FORMAT_VERSION;
+    header.recordSize = sizeof(ScoreRecord);
+    header.count = count;
+    header.payloadChecksum = payloadChecksum;
+    header.headerChecksum = Checksum::Crc32c(&header, offsetof(SnapshotHeader, headerChecksum));
+
+    isValid = isValid && std::fseek(output, 0, SEEK_SET) == 0 &&
+              std::fwrite(&header, sizeof(header), 1, output) == 1 && SyncFile(output);
+    std::fclose(output);
+
+    std::error_code error;
+    if (!isValid) {
+        std::cerr << "Failed to compact scores into " << snapshotPath << std::endl;
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+
+    std::filesystem::rename(temporaryPath, snapshotPath, error);
+    if (error) {
+        std::cerr << "Failed to replace score snapshot: " << snapshotPath << std::endl;
+        return false;
+    }
+    SyncDirectory(directory);
+
+    // El snapshot ya es duradero: el log vuelve a contener solo la cabecera
+    logValidEnd = sizeof(LogHeader);
+    logRecordCount = 0;
+    isLogDirty = true;
+    if (!TruncateLogToValidEnd()) {
+        std::cerr << "Failed to reset score log: " << GetLogPath() << std::endl;
+        return false;
+    }
+    return true;
+}
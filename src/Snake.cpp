@@ -1,119 +1,11 @@
-#ifndef INPUT_HANDLER_HPP
-#define INPUT_HANDLER_HPP
-
-#include <SFML/Graphics.hpp>
-#include <map>
-#include <functional>
-#include "Snake.hpp"
-#include <SFML/Graphics.hpp>
-#include <SFML/Window.hpp>
-#include <SFML/System.hpp>
-#include <SFML/Audio.hpp>
-#include <SFML/Network.hpp>
-#include "Snake.hpp"
-#include <SFML/Graphics.hpp>
-#include <SFML/Window.hpp>
-#include <SFML/System.hpp>
-
-// Forward declaration
-class Game;
-
-/**
- * @brief Enumeración para los tipos de entrada del usuario
- */
-enum class InputType {
-    KEY_PRESS,
-    KEY_RELEASE,
-    QUIT_EVENT
-};
-
-/**
- * @brief Estructura para representar una entrada del usuario
- */
-struct InputEvent {
-    InputType type;
-    sf::Keyboard::Key key;
-    bool isPressed;
-    
-    InputEvent(InputType t = InputType::KEY_PRESS, sf::Keyboard::Key k = sf::Keyboard::Unknown, bool pressed = false)
-        : type(t), key(k), isPressed(pressed) {}
-};
-
-/**
- * @brief Clase encargada del manejo de entrada del usuario
- * 
- * Procesa eventos del teclado y los traduce a acciones del juego.
- * Maneja configuraciones de teclas y estado de entrada.
- */
-class InputHandler {
-private:
-    std::map<sf::Keyboard::Key, Direction> keyToDirectionMap;
-    std::map<sf::Keyboard::Key, std::function<void()>> keyActionMap;
-    std::map<sf::Keyboard::Key, bool> keyState;
-    Game* gameInstance;
-    bool isEnabled;
-    
-public:
-    InputHandler();
-    ~InputHandler();
-    
-    // Métodos de inicialización (verbos)
-    void Initialize(Game* game);
-    void ConfigureDefaultKeys();
-    void Cleanup();
-    
-    // Métodos de procesamiento de eventos
-    void HandleEvents(sf::RenderWindow& window);
-    void ProcessEvent(const sf::Event& event);
-    void ProcessKeyPressed(sf::Keyboard::Key key);
-    void ProcessKeyReleased(sf::Keyboard::Key key);
-    void ProcessWindowClosed();
-    
-    // Métodos de configuración de teclas
-    void MapKeyToDirection(sf::Keyboard::Key key, Direction direction);
-    void MapKeyToAction(sf::Keyboard::Key key, std::function<void()> action);
-    void RemoveKeyMapping(sf::Keyboard::Key key);
-    void ResetKeyMappings();
-    
-    // Métodos de estado
-    void Enable();
-    void Disable();
-    void ToggleEnabled();
-    bool IsKeyPressed(sf::Keyboard::Key key) const;
-    bool IsAnyKeyPressed() const;
-    
-    // Métodos de validación
-    bool IsValidDirectionKey(sf::Keyboard::Key key) const;
-    bool IsValidActionKey(sf::Keyboard::Key key) const;
-    bool CanChangeDirection(Direction newDirection, Direction currentDirection) const;
-    
-    // Getters
-    bool IsEnabled() const { return isEnabled; }
-    Direction GetDirectionFromKey(sf::Keyboard::Key key) const;
-    const std::map<sf::Keyboard::Key, Direction>& GetKeyDirectionMap() const { return keyToDirectionMap; }
-    
-    // Setters
-    void SetGameInstance(Game* game) { gameInstance = game; }
-    void SetEnabled(bool enabled) { isEnabled = enabled; }
-    
-private:
-    // Métodos privados auxiliares
-    void UpdateKeyState(sf::Keyboard::Key key, bool isPressed);
-    void ExecuteKeyAction(sf::Keyboard::Key key);
-    bool IsDirectionKey(sf::Keyboard::Key key) const;
-    bool IsActionKey(sf::Keyboard::Key key) const;
-    void HandleDirectionInput(sf::Keyboard::Key key);
-    void HandleActionInput(sf::Keyboard::Key key);
-};
-
-#endif // INPUT_HANDLER_HPP
 #include "Snake.hpp"
 #include "GameRenderer.hpp"
+#include "ZobristHash.hpp"
 #include <algorithm>
 
 Snake::Snake(int startX, int startY) 
     : currentDirection(Direction::RIGHT), nextDirection(Direction::RIGHT), 
-      hasGrown(false), length(3), growthFrames(0) {
+      hasGrown(false), length(3), growthFrames(0), pendingGrowth(0), zobrist(nullptr), hash(0) {
     segments.clear();
     segments.push_back(Position(startX, startY));
     segments.push_back(Position(startX - 1, startY));
@@ -128,17 +20,33 @@ void Snake::Move() {
     // Calcular nueva posición de la cabeza
     Position newHead = CalculateNextHeadPosition();
     
+    // Hash: la cabeza cambia de celda y entra una celda de cuerpo; O(1).
+    // Si no crece, sale la cola y el penúltimo segmento pasa a ser la cola
+    if (zobrist) {
+        hash ^= zobrist->GetHeadKey(segments[0]) ^ zobrist->GetHeadKey(newHead) ^ zobrist->GetBodyKey(newHead);
+    }
+    
     // Agregar nueva cabeza
     AddSegment(newHead);
     
     // Remover cola si no ha crecido
     if (!hasGrown) {
+        if (zobrist) {
+            const Position& tail = segments.back();
+            const Position& newTail = segments[segments.size() - 2];
+            hash ^= zobrist->GetBodyKey(tail) ^ zobrist->GetTailKey(tail) ^ zobrist->GetTailKey(newTail);
+        }
         RemoveTail();
     } else {
         // La serpiente ha crecido, mantener todos los segmentos
-        // El flag se mantendrá activo por un frame para mostrar el segmento de crecimiento
-        hasGrown = false;
+        // El flag sigue activo mientras queden celdas por crecer
+        int previousGrowth = pendingGrowth;
+        pendingGrowth = std::max(pendingGrowth - 1, 0);
+        hasGrown = pendingGrowth > 0;
         length++;
+        if (zobrist) {
+            hash ^= zobrist->GetGrowthKey(previousGrowth) ^ zobrist->GetGrowthKey(pendingGrowth);
+        }
     }
 }
 
@@ -148,11 +56,27 @@ void Snake::ChangeDirection(Direction newDirection) {
     }
 }
 
-void Snake::Grow() {
+void Snake::Grow(int cells) {
+    int previousGrowth = pendingGrowth;
+    pendingGrowth += std::max(cells, 1);
+    if (zobrist) {
+        hash ^= zobrist->GetGrowthKey(previousGrowth) ^ zobrist->GetGrowthKey(pendingGrowth);
+    }
     hasGrown = true;
     growthFrames = 3;  // Mostrar el efecto de crecimiento por 3 frames
 }
 
+void Snake::WrapHead(int gridWidth, int gridHeight) {
+    // Bordes con vuelta: la cabeza reaparece por el lado opuesto
+    Position& head = segments[0];
+    Position wrapped((head.x % gridWidth + gridWidth) % gridWidth, (head.y % gridHeight + gridHeight) % gridHeight);
+    if (zobrist && wrapped != head) {
+        hash ^= zobrist->GetHeadKey(head) ^ zobrist->GetBodyKey(head) ^
+                zobrist->GetHeadKey(wrapped) ^ zobrist->GetBodyKey(wrapped);
+    }
+    head = wrapped;
+}
+
 void Snake::Reset(int startX, int startY) {
     segments.clear();
     segments.push_back(Position(startX, startY));
@@ -164,10 +88,15 @@ void Snake::Reset(int startX, int startY) {
     hasGrown = false;
     length = 3;
     growthFrames = 0;
+    pendingGrowth = 0;
+    hash = zobrist ? zobrist->ComputeSnake(*this) : 0;
 }
 
 void Snake::Update() {
     // Actualizar dirección
+    if (zobrist) {
+        hash ^= zobrist->GetDirectionKey(currentDirection) ^ zobrist->GetDirectionKey(nextDirection);
+    }
     currentDirection = nextDirection;
     
     // Decrementar contador de frames de crecimiento
@@ -197,6 +126,11 @@ void Snake::Render(GameRenderer* renderer) {
     }
 }
 
+void Snake::SetZobristHash(const ZobristHash* keys) {
+    zobrist = keys;
+    hash = zobrist ? zobrist->ComputeSnake(*this) : 0;
+}
+
 bool Snake::IsValidDirection(Direction direction) const {
     return CanChangeDirection(direction, currentDirection);
 }
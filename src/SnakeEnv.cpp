@@ -0,0 +1,110 @@
+#include "SnakeEnv.h"
+#include "BatchEnvironment.hpp"
+
+static_assert(SNAKE_ENV_PLANE_COUNT == BatchEnvironment::PLANE_COUNT, "C header and BatchEnvironment disagree");
+
+/**
+ * @brief Objeto opaco de la API C: un BatchEnvironment y nada más
+ */
+struct SnakeEnv {
+    BatchEnvironment batch;
+
+    SnakeEnv(std::uint32_t envCount, const SnakeEnvConfig& config, const GameRules& rules)
+        : batch(envCount, config.width, config.height, rules) {
+        batch.SetMaxEpisodeTicks(config.maxEpisodeTicks);
+    }
+};
+
+namespace {
+
+const std::int32_t MAX_GRID_SIZE = 1024;
+
+} // namespace
+
+extern "C" {
+
+std::uint32_t snake_env_abi_version(void) {
+    return SNAKE_ENV_ABI_VERSION;
+}
+
+void snake_env_default_config(SnakeEnvConfig* config) {
+    if (!config) return;
+    config->width = 16;
+    config->height = 16;
+    config->wrapWalls = 0;
+    config->selfCollision = 1;
+    config->multiCellGrowth = 0;
+    config->maxEpisodeTicks = BatchEnvironment::DEFAULT_MAX_EPISODE_TICKS;
+}
+
+SnakeEnv* snake_env_create(std::uint32_t envCount, const SnakeEnvConfig* config) {
+    SnakeEnvConfig settings;
+    snake_env_default_config(&settings);
+    if (config) {
+        settings = *config;
+    }
+
+    // Los errores no cruzan la frontera C: nada de excepciones hacia quien llama
+    if (envCount == 0 || settings.width <= BatchEnvironment::INITIAL_LENGTH || settings.height < 1 ||
+        settings.width > MAX_GRID_SIZE || settings.height > MAX_GRID_SIZE) {
+        return nullptr;
+    }
+
+    GameRules rules;
+    rules.wrapWalls = settings.wrapWalls != 0;
+    rules.selfCollision = settings.selfCollision != 0;
+    rules.multiCellGrowth = settings.multiCellGrowth != 0;
+
+    // El constructor reserva los arrays de todos los entornos (bad_alloc con lotes enormes)
+    try {
+        return new SnakeEnv(envCount, settings, rules);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void snake_env_destroy(SnakeEnv* env) {
+    delete env;
+}
+
+std::uint32_t snake_env_count(const SnakeEnv* env) {
+    return env ? static_cast<std::uint32_t>(env->batch.GetGameCount()) : 0;
+}
+
+size_t snake_env_observation_size(const SnakeEnv* env) {
+    return env ? env->batch.GetObservationSize() : 0;
+}
+
+int snake_env_reset(SnakeEnv* env, std::uint64_t seed, float* observations) {
+    if (!env) return SNAKE_ENV_ERROR_INVALID_ARGUMENT;
+
+    try {
+        env->batch.SetOutputBuffers(nullptr, nullptr);
+        env->batch.Reset(seed);
+        if (observations) {
+            env->batch.EncodeObservations(observations);
+        }
+    } catch (...) {
+        return SNAKE_ENV_ERROR_INTERNAL;
+    }
+    return SNAKE_ENV_OK;
+}
+
+int snake_env_step(SnakeEnv* env, const std::int8_t* actions, float* observations, float* rewards,
+                   std::uint8_t* dones) {
+    if (!env) return SNAKE_ENV_ERROR_INVALID_ARGUMENT;
+
+    // Recompensas y finales van directos a los buffers de quien llama
+    try {
+        env->batch.SetOutputBuffers(rewards, dones);
+        env->batch.Step(actions);
+        if (observations) {
+            env->batch.EncodeObservations(observations);
+        }
+    } catch (...) {
+        return SNAKE_ENV_ERROR_INTERNAL;
+    }
+    return SNAKE_ENV_OK;
+}
+
+} // extern "C"
@@ -0,0 +1,391 @@
+#include "SoftwareRasterizer.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define SNAKE_RASTER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Mezcla "src sobre dst" con redondeo exacto de la división por 255
+inline std::uint8_t BlendChannel(std::uint32_t src, std::uint32_t dst, std::uint32_t alpha) {
+    std::uint32_t t = src * alpha + dst * (255 - alpha) + 128;
+    return static_cast<std::uint8_t>((t + (t >> 8)) >> 8);
+}
+
+void BlendRowScalar(std::uint8_t* dst, const std::uint8_t* src, int count) {
+    for (int i = 0; i < count; i++, dst += 4, src += 4) {
+        std::uint32_t alpha = src[3];
+        if (alpha == 0) {
+            continue;
+        }
+        if (alpha == 255) {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+        } else {
+            dst[0] = BlendChannel(src[0], dst[0], alpha);
+            dst[1] = BlendChannel(src[1], dst[1], alpha);
+            dst[2] = BlendChannel(src[2], dst[2], alpha);
+        }
+        dst[3] = 255;
+    }
+}
+
+#ifdef SNAKE_RASTER_X86
+
+// Mezcla 2 píxeles expandidos a 16 bits (RGBA RGBA)
+inline __m128i BlendPixels16Sse2(__m128i src, __m128i dst) {
+    const __m128i c255 = _mm_set1_epi16(255);
+    const __m128i c128 = _mm_set1_epi16(128);
+
+    __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src, 0xFF), 0xFF);
+    __m128i t = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(src, alpha),
+                                            _mm_mullo_epi16(dst, _mm_sub_epi16(c255, alpha))),
+                              c128);
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+void BlendRowSse2(std::uint8_t* dst, const std::uint8_t* src, int count) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        __m128i alphas = _mm_and_si128(s, alphaMask);
+
+        // Bloque completamente transparente: nada que hacer
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(alphas, zero)) == 0xFFFF) {
+            continue;
+        }
+
+        __m128i* target = reinterpret_cast<__m128i*>(dst + i * 4);
+
+        // Bloque completamente opaco: copia directa
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(alphas, alphaMask)) == 0xFFFF) {
+            _mm_storeu_si128(target, s);
+            continue;
+        }
+
+        __m128i d = _mm_loadu_si128(target);
+        __m128i lo = BlendPixels16Sse2(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero));
+        __m128i hi = BlendPixels16Sse2(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero));
+        _mm_storeu_si128(target, _mm_or_si128(_mm_packus_epi16(lo, hi), alphaMask));
+    }
+
+    BlendRowScalar(dst + i * 4, src + i * 4, count - i);
+}
+
+__attribute__((target("avx2")))
+inline __m256i BlendPixels16Avx2(__m256i src, __m256i dst) {
+    const __m256i c255 = _mm256_set1_epi16(255);
+    const __m256i c128 = _mm256_set1_epi16(128);
+
+    __m256i alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(src, 0xFF), 0xFF);
+    __m256i t = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(src, alpha),
+                                                  _mm256_mullo_epi16(dst, _mm256_sub_epi16(c255, alpha))),
+                                 c128);
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+__attribute__((target("avx2")))
+void BlendRowAvx2(std::uint8_t* dst, const std::uint8_t* src, int count) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i alphaMask = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 4));
+        __m256i alphas = _mm256_and_si256(s, alphaMask);
+
+        if (_mm256_testz_si256(alphas, alphas)) {
+            continue;
+        }
+
+        __m256i* target = reinterpret_cast<__m256i*>(dst + i * 4);
+
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(alphas, alphaMask)) == -1) {
+            _mm256_storeu_si256(target, s);
+            continue;
+        }
+
+        // unpack/pack trabajan por carriles de 128 bits, así que el orden se conserva
+        __m256i d = _mm256_loadu_si256(target);
+        __m256i lo = BlendPixels16Avx2(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero));
+        __m256i hi = BlendPixels16Avx2(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero));
+        _mm256_storeu_si256(target, _mm256_or_si256(_mm256_packus_epi16(lo, hi), alphaMask));
+    }
+
+    // Evitar la penalización de transición AVX -> SSE antes del resto de la fila
+    _mm256_zeroupper();
+    BlendRowSse2(dst + i * 4, src + i * 4, count - i);
+}
+
+#endif // SNAKE_RASTER_X86
+
+SoftwareRasterizer::BlendRowFunction SelectBlendRow(SoftwareRasterizer::SimdLevel level) {
+#ifdef SNAKE_RASTER_X86
+    switch (level) {
+        case SoftwareRasterizer::SimdLevel::AVX2:
+            return BlendRowAvx2;
+        case SoftwareRasterizer::SimdLevel::SSE2:
+            return BlendRowSse2;
+        case SoftwareRasterizer::SimdLevel::SCALAR:
+            break;
+    }
+#else
+    (void)level;
+#endif
+    return BlendRowScalar;
+}
+
+} // namespace
+
+SoftwareRasterizer::SoftwareRasterizer()
+    : width(0), height(0), simdLevel(SimdLevel::SCALAR), blendRow(BlendRowScalar),
+      hasPendingClear(false) {
+}
+
+SoftwareRasterizer::~SoftwareRasterizer() {
+}
+
+bool SoftwareRasterizer::Initialize(int frameWidth, int frameHeight) {
+    if (frameWidth <= 0 || frameHeight <= 0) {
+        std::cerr << "Invalid framebuffer size: " << frameWidth << "x" << frameHeight << std::endl;
+        return false;
+    }
+
+    width = frameWidth;
+    height = frameHeight;
+    frameBuffer.assign(static_cast<size_t>(width) * height * 4, 0);
+    scratchRow.assign(static_cast<size_t>(width) * 4, 0);
+    SetSimdLevel(DetectSimdLevel());
+    Clear(sf::Color::Black);
+
+    return true;
+}
+
+void SoftwareRasterizer::SetSimdLevel(SimdLevel level) {
+    // No permitir un nivel que la CPU no soporte
+    if (static_cast<int>(level) > static_cast<int>(DetectSimdLevel())) {
+        level = DetectSimdLevel();
+    }
+
+    simdLevel = level;
+    blendRow = SelectBlendRow(level);
+}
+
+void SoftwareRasterizer::Clear(const sf::Color& color) {
+    // Se aplica al primer dibujo; si éste cubre todo el frame con una
+    // imagen opaca (fondos, pantallas) el relleno se omite por completo
+    hasPendingClear = true;
+    pendingClearColor = color;
+}
+
+void SoftwareRasterizer::FillRect(int x, int y, int rectWidth, int rectHeight, const sf::Color& color) {
+    if (color.a == 0) return;
+    FlushPendingClear();
+
+    int x0 = std::max(x, 0);
+    int y0 = std::max(y, 0);
+    int x1 = std::min(x + rectWidth, width);
+    int y1 = std::min(y + rectHeight, height);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    int count = x1 - x0;
+    std::uint8_t pixel[4] = { color.r, color.g, color.b, color.a };
+    std::uint32_t value;
+    std::memcpy(&value, pixel, sizeof(value));
+
+    std::uint32_t* row = reinterpret_cast<std::uint32_t*>(scratchRow.data());
+    std::fill(row, row + count, value);
+
+    for (int py = y0; py < y1; py++) {
+        std::uint8_t* target = GetRow(py) + static_cast<size_t>(x0) * 4;
+        if (color.a == 255) {
+            std::memcpy(target, scratchRow.data(), static_cast<size_t>(count) * 4);
+        } else {
+            blendRow(target, scratchRow.data(), count);
+        }
+    }
+}
+
+void SoftwareRasterizer::BlitImage(const RasterImage& image, int x, int y) {
+    if (image.IsEmpty()) return;
+
+    // Recortar contra los bordes del framebuffer
+    int x0 = std::max(x, 0);
+    int y0 = std::max(y, 0);
+    int x1 = std::min(x + image.width, width);
+    int y1 = std::min(y + image.height, height);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    if (hasPendingClear) {
+        bool coversFrame = image.isOpaque && x0 == 0 && y0 == 0 && x1 == width && y1 == height;
+        if (coversFrame) {
+            hasPendingClear = false;
+        } else {
+            FlushPendingClear();
+        }
+    }
+
+    int count = x1 - x0;
+    int sourceX = x0 - x;
+
+    for (int py = y0; py < y1; py++) {
+        const std::uint8_t* source = image.GetRow(py - y) + static_cast<size_t>(sourceX) * 4;
+        std::uint8_t* target = GetRow(py) + static_cast<size_t>(x0) * 4;
+
+        if (image.isOpaque) {
+            std::memcpy(target, source, static_cast<size_t>(count) * 4);
+        } else {
+            blendRow(target, source, count);
+        }
+    }
+}
+
+bool SoftwareRasterizer::LoadImage(const std::string& path, RasterImage& image) {
+    // sf::Image decodifica en CPU y no necesita contexto OpenGL
+    sf::Image decoded;
+    if (!decoded.loadFromFile(path)) {
+        std::cerr << "Failed to load image: " << path << std::endl;
+        return false;
+    }
+
+    CreateImage(decoded.getPixelsPtr(), decoded.getSize().x, decoded.getSize().y, image);
+    return true;
+}
+
+void SoftwareRasterizer::CreateImage(const std::uint8_t* rgbaPixels, int imageWidth, int imageHeight, RasterImage& image) {
+    size_t byteCount = static_cast<size_t>(imageWidth) * imageHeight * 4;
+
+    image.width = imageWidth;
+    image.height = imageHeight;
+    image.pixels.assign(rgbaPixels, rgbaPixels + byteCount);
+    image.isOpaque = true;
+
+    for (size_t i = 3; i < byteCount; i += 4) {
+        if (image.pixels[i] != 255) {
+            image.isOpaque = false;
+            break;
+        }
+    }
+}
+
+void SoftwareRasterizer::ScaleImage(const RasterImage& source, int targetWidth, int targetHeight, RasterImage& target) {
+    target.width = std::max(targetWidth, 0);
+    target.height = std::max(targetHeight, 0);
+    target.isOpaque = source.isOpaque;
+    target.pixels.assign(static_cast<size_t>(target.width) * target.height * 4, 0);
+    if (source.IsEmpty() || target.pixels.empty()) return;
+
+    // Vecino más cercano muestreando en el centro del píxel, igual que
+    // un sf::Sprite escalado con una textura sin suavizado
+    std::vector<int> sourceColumns(target.width);
+    for (int x = 0; x < target.width; x++) {
+        sourceColumns[x] = static_cast<int>((2LL * x + 1) * source.width / (2LL * target.width));
+    }
+
+    const std::uint32_t* sourcePixels = reinterpret_cast<const std::uint32_t*>(source.pixels.data());
+    std::uint32_t* targetPixels = reinterpret_cast<std::uint32_t*>(target.pixels.data());
+
+    for (int y = 0; y < target.height; y++) {
+        int sourceY = static_cast<int>((2LL * y + 1) * source.height / (2LL * target.height));
+        const std::uint32_t* sourceRow = sourcePixels + static_cast<size_t>(sourceY) * source.width;
+        std::uint32_t* targetRow = targetPixels + static_cast<size_t>(y) * target.width;
+
+        for (int x = 0; x < target.width; x++) {
+            targetRow[x] = sourceRow[sourceColumns[x]];
+        }
+    }
+}
+
+void SoftwareRasterizer::DownscaleImage(const RasterImage& source, int targetWidth, int targetHeight, RasterImage& target) {
+    if (source.IsEmpty() || targetWidth >= source.width || targetHeight >= source.height) {
+        ScaleImage(source, targetWidth, targetHeight, target);
+        return;
+    }
+
+    target.width = std::max(targetWidth, 0);
+    target.height = std::max(targetHeight, 0);
+    target.isOpaque = source.isOpaque;
+    target.pixels.assign(static_cast<size_t>(target.width) * target.height * 4, 0);
+    if (target.pixels.empty()) return;
+
+    // Promedio por área (filtro de caja) ponderado por alfa, para que los
+    // bordes transparentes no oscurezcan el color al reducir
+    for (int y = 0; y < target.height; y++) {
+        int y0 = static_cast<int>(static_cast<long long>(y) * source.height / target.height);
+        int y1 = static_cast<int>(static_cast<long long>(y + 1) * source.height / target.height);
+
+        for (int x = 0; x < target.width; x++) {
+            int x0 = static_cast<int>(static_cast<long long>(x) * source.width / target.width);
+            int x1 = static_cast<int>(static_cast<long long>(x + 1) * source.width / target.width);
+
+            std::uint64_t sumR = 0, sumG = 0, sumB = 0, sumA = 0;
+            for (int sy = y0; sy < y1; sy++) {
+                const std::uint8_t* pixel = source.GetRow(sy) + static_cast<size_t>(x0) * 4;
+                for (int sx = x0; sx < x1; sx++, pixel += 4) {
+                    sumR += pixel[0] * pixel[3];
+                    sumG += pixel[1] * pixel[3];
+                    sumB += pixel[2] * pixel[3];
+                    sumA += pixel[3];
+                }
+            }
+
+            std::uint64_t count = static_cast<std::uint64_t>(x1 - x0) * (y1 - y0);
+            std::uint8_t* out = target.pixels.data() + (static_cast<size_t>(y) * target.width + x) * 4;
+            if (sumA > 0) {
+                out[0] = static_cast<std::uint8_t>((sumR + sumA / 2) / sumA);
+                out[1] = static_cast<std::uint8_t>((sumG + sumA / 2) / sumA);
+                out[2] = static_cast<std::uint8_t>((sumB + sumA / 2) / sumA);
+            }
+            out[3] = static_cast<std::uint8_t>((sumA + count / 2) / count);
+        }
+    }
+}
+
+bool SoftwareRasterizer::SaveToFile(const std::string& path) const {
+    sf::Image image;
+    CopyToImage(image);
+    return image.saveToFile(path);
+}
+
+void SoftwareRasterizer::CopyToImage(sf::Image& image) const {
+    image.create(width, height, GetPixels());
+}
+
+const std::uint8_t* SoftwareRasterizer::GetPixels() const {
+    FlushPendingClear();
+    return frameBuffer.data();
+}
+
+// Métodos privados
+void SoftwareRasterizer::FlushPendingClear() const {
+    if (!hasPendingClear) return;
+    hasPendingClear = false;
+
+    std::uint8_t pixel[4] = { pendingClearColor.r, pendingClearColor.g, pendingClearColor.b, 255 };
+    std::uint32_t value;
+    std::memcpy(&value, pixel, sizeof(value));
+
+    std::uint32_t* pixels = reinterpret_cast<std::uint32_t*>(frameBuffer.data());
+    std::fill(pixels, pixels + static_cast<size_t>(width) * height, value);
+}
+
+SoftwareRasterizer::SimdLevel SoftwareRasterizer::DetectSimdLevel() {
+#ifdef SNAKE_RASTER_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SimdLevel::SSE2;
+    }
+#endif
+    return SimdLevel::SCALAR;
+}
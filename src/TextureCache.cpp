@@ -0,0 +1,174 @@
+#include "TextureCache.hpp"
+#include "AssetPack.hpp"
+#include "SoftwareRasterizer.hpp"
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+TextureCache::TextureCache() : pack(nullptr), downscaleOnLoad(true), currentFrame(1) {
+}
+
+TextureCache::~TextureCache() {
+    Clear();
+}
+
+void TextureCache::Register(const std::string& name, const std::string& path, const sf::Vector2i& targetSize) {
+    Evict(name);
+
+    Entry& entry = entries[name];
+    entry.path = path;
+    entry.targetSize = targetSize;
+    entry.isResident = false;
+    entry.bytes = 0;
+    entry.lastUsedFrame = 0;
+    std::vector<std::uint8_t>().swap(entry.pixels);
+    entry.pixelSize = sf::Vector2u();
+}
+
+bool TextureCache::Stage(const std::string& name, const std::uint8_t* rgbaPixels, unsigned int width, unsigned int height) {
+    auto it = entries.find(name);
+    if (it == entries.end()) {
+        return false;
+    }
+
+    // La textura anterior ya no corresponde a la imagen nueva
+    Evict(name);
+    Entry& entry = it->second;
+
+    // Reducir al tamaño en pantalla; nunca ampliar
+    const int targetWidth = entry.targetSize.x;
+    const int targetHeight = entry.targetSize.y;
+    if (downscaleOnLoad && targetWidth > 0 && targetHeight > 0 &&
+        static_cast<unsigned int>(targetWidth) < width && static_cast<unsigned int>(targetHeight) < height) {
+        RasterImage source;
+        RasterImage scaled;
+        SoftwareRasterizer::CreateImage(rgbaPixels, static_cast<int>(width), static_cast<int>(height), source);
+        SoftwareRasterizer::DownscaleImage(source, targetWidth, targetHeight, scaled);
+        entry.pixels = std::move(scaled.pixels);
+        entry.pixelSize = sf::Vector2u(static_cast<unsigned int>(scaled.width), static_cast<unsigned int>(scaled.height));
+        return true;
+    }
+
+    entry.pixels.assign(rgbaPixels, rgbaPixels + static_cast<size_t>(width) * height * 4);
+    entry.pixelSize = sf::Vector2u(width, height);
+    return true;
+}
+
+void TextureCache::Clear() {
+    for (auto& pair : entries) {
+        Evict(pair.first);
+    }
+    entries.clear();
+    lruOrder.clear();
+}
+
+sf::Texture* TextureCache::Acquire(const std::string& name) {
+    auto it = entries.find(name);
+    if (it == entries.end()) {
+        return nullptr;
+    }
+
+    Entry& entry = it->second;
+    if (!entry.isResident) {
+        if (!Load(name, entry)) {
+            return nullptr;
+        }
+        entry.isResident = true;
+        entry.lruPosition = lruOrder.insert(lruOrder.begin(), name);
+        stats.residentBytes += entry.bytes;
+        stats.peakResidentBytes = std::max(stats.peakResidentBytes, stats.residentBytes);
+    }
+
+    Touch(entry);
+    EnforceBudget();
+    return &entry.texture;
+}
+
+void TextureCache::Evict(const std::string& name) {
+    auto it = entries.find(name);
+    if (it == entries.end() || !it->second.isResident) return;
+
+    Entry& entry = it->second;
+    lruOrder.erase(entry.lruPosition);
+    stats.residentBytes -= entry.bytes;
+    stats.evictions++;
+
+    entry.texture = sf::Texture();
+    entry.isResident = false;
+    entry.bytes = 0;
+}
+
+bool TextureCache::IsResident(const std::string& name) const {
+    auto it = entries.find(name);
+    return it != entries.end() && it->second.isResident;
+}
+
+void TextureCache::SetMemoryBudget(size_t bytes) {
+    stats.budgetBytes = bytes;
+    EnforceBudget();
+}
+
+// Métodos privados
+bool TextureCache::Load(const std::string& name, Entry& entry) {
+    // Solo subidas: se llama mientras se dibuja, así que aquí no se lee ni se decodifica nada
+    if (!entry.pixels.empty()) {
+        return Upload(entry, entry.pixels.data(), entry.pixelSize.x, entry.pixelSize.y);
+    }
+
+    if (pack) {
+        const PackEntry* packEntry = pack->Find("image/" + name);
+        if (packEntry && packEntry->type == static_cast<std::uint32_t>(PackEntryType::IMAGE_RGBA)) {
+            return Upload(entry, pack->GetEntryData(*packEntry), packEntry->width, packEntry->height);
+        }
+    }
+
+    std::cerr << "Failed to load texture, no decoded image: " << entry.path << std::endl;
+    return false;
+}
+
+bool TextureCache::Upload(Entry& entry, const std::uint8_t* rgbaPixels, unsigned int width, unsigned int height) {
+    const int targetWidth = entry.targetSize.x;
+    const int targetHeight = entry.targetSize.y;
+
+    // Reducir al tamaño en pantalla; nunca ampliar
+    if (downscaleOnLoad && targetWidth > 0 && targetHeight > 0 &&
+        static_cast<unsigned int>(targetWidth) < width && static_cast<unsigned int>(targetHeight) < height) {
+        RasterImage source;
+        RasterImage scaled;
+        SoftwareRasterizer::CreateImage(rgbaPixels, static_cast<int>(width), static_cast<int>(height), source);
+        SoftwareRasterizer::DownscaleImage(source, targetWidth, targetHeight, scaled);
+        return Upload(entry, scaled.pixels.data(), static_cast<unsigned int>(scaled.width),
+                      static_cast<unsigned int>(scaled.height));
+    }
+
+    if (!entry.texture.create(width, height)) {
+        std::cerr << "Failed to upload texture: " << entry.path << std::endl;
+        return false;
+    }
+    entry.texture.update(rgbaPixels);
+    entry.bytes = static_cast<size_t>(width) * height * 4;
+    stats.loads++;
+    return true;
+}
+
+void TextureCache::Touch(Entry& entry) {
+    entry.lastUsedFrame = currentFrame;
+    lruOrder.splice(lruOrder.begin(), lruOrder, entry.lruPosition);
+}
+
+void TextureCache::EnforceBudget() {
+    if (stats.budgetBytes == 0) return;
+
+    // Recorrer desde la menos reciente; las del frame actual se conservan
+    auto it = lruOrder.end();
+    while (stats.residentBytes > stats.budgetBytes && it != lruOrder.begin()) {
+        --it;
+        if (entries.at(*it).lastUsedFrame == currentFrame) {
+            break;
+        }
+
+        const std::string name = *it;
+        it = std::next(it);  // Evict borra el nodo actual
+        Evict(name);
+    }
+}
@@ -0,0 +1,140 @@
+#include "TickScheduler.hpp"
+#include <algorithm>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#include <immintrin.h>
+#define SNAKE_CPU_RELAX() _mm_pause()
+#else
+#define SNAKE_CPU_RELAX() std::this_thread::yield()
+#endif
+
+namespace {
+
+#ifdef _WIN32
+// Sleep de Windows redondea a su periodo de reloj (hasta ~15 ms)
+const TickScheduler::Duration DEFAULT_SPIN_THRESHOLD = std::chrono::milliseconds(2);
+#else
+const TickScheduler::Duration DEFAULT_SPIN_THRESHOLD = std::chrono::microseconds(1000);
+#endif
+
+} // namespace
+
+TickScheduler::TickScheduler(Duration interval)
+    : baseInterval(interval), rampStep(Duration::zero()), minimumInterval(interval),
+      currentInterval(interval), spinThreshold(DEFAULT_SPIN_THRESHOLD), mode(TickMode::NORMAL),
+      score(0), maxCatchUpTicks(DEFAULT_MAX_CATCH_UP_TICKS), isStarted(false),
+      tickCount(0), skippedTicks(0) {
+}
+
+void TickScheduler::Start() {
+    isStarted = true;
+    nextTick = Clock::now() + currentInterval;
+}
+
+int TickScheduler::CollectDueTicks() {
+    if (!isStarted) Start();
+
+    const TimePoint now = Clock::now();
+
+    // Avance rápido: siempre hay ticks pendientes, en lotes del tamaño máximo
+    if (mode == TickMode::FAST_FORWARD) {
+        nextTick = now;
+        tickCount += maxCatchUpTicks;
+        return maxCatchUpTicks;
+    }
+
+    int due = 0;
+    while (now >= nextTick && due < maxCatchUpTicks) {
+        lateness.Record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(now - nextTick).count()));
+        nextTick += currentInterval;
+        due++;
+    }
+
+    // Tras un parón largo no se recupera todo: se descartan los ticks restantes
+    if (now >= nextTick) {
+        std::int64_t behind = (now - nextTick) / currentInterval + 1;
+        skippedTicks += static_cast<std::uint64_t>(behind);
+        nextTick += currentInterval * behind;
+    }
+
+    tickCount += due;
+    return due;
+}
+
+void TickScheduler::WaitUntil(TimePoint deadline, bool isPrecise) const {
+    const Duration margin = isPrecise ? spinThreshold : Duration::zero();
+
+    // Dormir mientras falte más que el margen; el sleep puede despertar antes
+    Duration remaining = deadline - Clock::now();
+    while (remaining > margin) {
+        std::this_thread::sleep_for(remaining - margin);
+        remaining = deadline - Clock::now();
+    }
+
+    while (isPrecise && Clock::now() < deadline) {
+        SNAKE_CPU_RELAX();
+    }
+}
+
+void TickScheduler::ResetStats() {
+    tickCount = 0;
+    skippedTicks = 0;
+    lateness.Clear();
+}
+
+void TickScheduler::SetMode(TickMode newMode) {
+    if (mode == newMode) return;
+
+    bool wasFastForward = (mode == TickMode::FAST_FORWARD);
+    mode = newMode;
+    UpdateInterval();
+
+    // Al salir del avance rápido el siguiente tick se cuenta desde ahora
+    if (wasFastForward && isStarted) {
+        nextTick = Clock::now() + currentInterval;
+    }
+}
+
+void TickScheduler::SetBaseInterval(Duration interval) {
+    baseInterval = std::max(interval, Duration(1));
+    minimumInterval = std::min(minimumInterval, baseInterval);
+    UpdateInterval();
+}
+
+void TickScheduler::SetSpeedRamp(Duration stepPerPoint, Duration minimum) {
+    rampStep = std::max(stepPerPoint, Duration::zero());
+    minimumInterval = std::max(std::min(minimum, baseInterval), Duration(1));
+    UpdateInterval();
+}
+
+void TickScheduler::SetScore(int newScore) {
+    if (score == newScore) return;
+
+    score = newScore;
+    UpdateInterval();
+}
+
+void TickScheduler::SetMaxCatchUpTicks(int ticks) {
+    maxCatchUpTicks = std::max(1, ticks);
+}
+
+// Métodos privados
+void TickScheduler::UpdateInterval() {
+    // El nuevo intervalo se aplica a partir del siguiente tick ya planificado
+    Duration ramped = std::max(baseInterval - rampStep * std::max(score, 0), minimumInterval);
+
+    switch (mode) {
+        case TickMode::TURBO:
+            currentInterval = ramped / 2;
+            break;
+        case TickMode::SLOW_MOTION:
+            currentInterval = ramped * 2;
+            break;
+        case TickMode::NORMAL:
+        case TickMode::FAST_FORWARD:
+            currentInterval = ramped;
+            break;
+    }
+}
@@ -0,0 +1,121 @@
+#include "TranspositionTable.hpp"
+#include <algorithm>
+
+namespace {
+
+// Datos de una entrada en 64 bits: valor | profundidad | acción | cota | generación
+std::uint64_t PackEntry(const TranspositionEntry& entry, std::uint32_t generation) {
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(entry.value)) |
+           static_cast<std::uint64_t>(entry.depth) << 32 |
+           static_cast<std::uint64_t>(static_cast<std::uint8_t>(entry.bestAction)) << 40 |
+           static_cast<std::uint64_t>(entry.bound) << 48 |
+           static_cast<std::uint64_t>(generation & 0xFF) << 56;
+}
+
+TranspositionEntry UnpackEntry(std::uint64_t data) {
+    TranspositionEntry entry;
+    entry.value = static_cast<std::int32_t>(static_cast<std::uint32_t>(data));
+    entry.depth = static_cast<std::uint8_t>(data >> 32);
+    entry.bestAction = static_cast<std::int8_t>(static_cast<std::uint8_t>(data >> 40));
+    entry.bound = static_cast<TranspositionBound>(static_cast<std::uint8_t>(data >> 48));
+    return entry;
+}
+
+int EntryDepth(std::uint64_t data) {
+    return static_cast<int>((data >> 32) & 0xFF);
+}
+
+std::uint32_t EntryGeneration(std::uint64_t data) {
+    return static_cast<std::uint32_t>(data >> 56);
+}
+
+const size_t OCCUPANCY_SAMPLE_BUCKETS = 4096;
+
+} // namespace
+
+TranspositionTable::TranspositionTable(size_t sizeBytes) : bucketMask(0), generation(0) {
+    size_t bucketCount = 1;
+    while (bucketCount * 2 * sizeof(Bucket) <= sizeBytes) {
+        bucketCount *= 2;
+    }
+    buckets.reset(new Bucket[bucketCount]);
+    bucketMask = bucketCount - 1;
+    Clear();
+}
+
+// Métodos principales (verbos)
+bool TranspositionTable::Probe(std::uint64_t key, TranspositionEntry& entry) const {
+    const Bucket& bucket = GetBucket(key);
+    for (int slot = 0; slot < BUCKET_SIZE; slot++) {
+        std::uint64_t data = bucket.data[slot].load(std::memory_order_relaxed);
+        std::uint64_t storedKey = bucket.keys[slot].load(std::memory_order_relaxed);
+        if (data != 0 && (storedKey ^ data) == key) {
+            entry = UnpackEntry(data);
+            return true;
+        }
+    }
+    return false;
+}
+
+void TranspositionTable::Store(std::uint64_t key, const TranspositionEntry& entry) {
+    Bucket& bucket = GetBucket(key);
+    std::uint32_t currentGeneration = generation.load(std::memory_order_relaxed);
+
+    // Misma clave o vacía; si no, la de menor profundidad, restando 4 plies por búsqueda de antigüedad
+    int victim = 0;
+    int victimWorth = 0;
+    for (int slot = 0; slot < BUCKET_SIZE; slot++) {
+        std::uint64_t data = bucket.data[slot].load(std::memory_order_relaxed);
+        std::uint64_t storedKey = bucket.keys[slot].load(std::memory_order_relaxed);
+        if (data == 0 || (storedKey ^ data) == key) {
+            // No pisar un resultado más profundo de esta misma búsqueda
+            if (data != 0 && EntryDepth(data) > entry.depth && EntryGeneration(data) == (currentGeneration & 0xFF) &&
+                entry.bound != TranspositionBound::EXACT) {
+                return;
+            }
+            victim = slot;
+            break;
+        }
+
+        int age = static_cast<int>((currentGeneration - EntryGeneration(data)) & 0xFF);
+        int worth = EntryDepth(data) - 4 * age;
+        if (slot == 0 || worth < victimWorth) {
+            victim = slot;
+            victimWorth = worth;
+        }
+    }
+
+    std::uint64_t data = PackEntry(entry, currentGeneration);
+    bucket.data[victim].store(data, std::memory_order_relaxed);
+    bucket.keys[victim].store(key ^ data, std::memory_order_relaxed);
+}
+
+void TranspositionTable::Prefetch(std::uint64_t key) const {
+    __builtin_prefetch(&GetBucket(key));
+}
+
+void TranspositionTable::NewSearch() {
+    generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TranspositionTable::Clear() {
+    for (size_t index = 0; index <= bucketMask; index++) {
+        for (int slot = 0; slot < BUCKET_SIZE; slot++) {
+            buckets[index].keys[slot].store(0, std::memory_order_relaxed);
+            buckets[index].data[slot].store(0, std::memory_order_relaxed);
+        }
+    }
+    generation.store(0, std::memory_order_relaxed);
+}
+
+// Getters
+double TranspositionTable::GetOccupancy() const {
+    size_t sampled = std::min(OCCUPANCY_SAMPLE_BUCKETS, GetBucketCount());
+    size_t used = 0;
+    for (size_t index = 0; index < sampled; index++) {
+        for (int slot = 0; slot < BUCKET_SIZE; slot++) {
+            used += buckets[index].data[slot].load(std::memory_order_relaxed) != 0;
+        }
+    }
+    return static_cast<double>(used) / static_cast<double>(sampled * BUCKET_SIZE);
+}
@@ -0,0 +1,58 @@
+#include "ZobristHash.hpp"
+#include "GameSimulation.hpp"
+#include <algorithm>
+
+namespace {
+
+// splitmix64: claves independientes a partir de una sola semilla
+std::uint64_t NextKey(std::uint64_t& state) {
+    state += 0x9E3779B97F4A7C15ULL;
+    std::uint64_t value = state;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+} // namespace
+
+ZobristHash::ZobristHash(int width, int height, std::uint64_t seed)
+    : gridWidth(std::max(width, 1)), gridHeight(std::max(height, 1)), paddedWidth(gridWidth + 2) {
+    size_t paddedCells = static_cast<size_t>(paddedWidth) * (gridHeight + 2);
+    bodyKeys.resize(paddedCells);
+    headKeys.resize(paddedCells);
+    tailKeys.resize(paddedCells);
+    foodKeys.resize(paddedCells);
+
+    std::uint64_t state = seed;
+    for (size_t cell = 0; cell < paddedCells; cell++) {
+        bodyKeys[cell] = NextKey(state);
+        headKeys[cell] = NextKey(state);
+        tailKeys[cell] = NextKey(state);
+        foodKeys[cell] = NextKey(state);
+    }
+    for (std::uint64_t& key : directionKeys) {
+        key = NextKey(state);
+    }
+    // Sin crecimiento pendiente no se añade nada: una serpiente recién creada solo depende de sus celdas
+    growthKeys[0] = 0;
+    for (int cells = 1; cells <= MAX_PENDING_GROWTH; cells++) {
+        growthKeys[cells] = NextKey(state);
+    }
+}
+
+// Utilidades
+std::uint64_t ZobristHash::ComputeSnake(const Snake& snake) const {
+    const std::vector<Position>& segments = snake.GetSegments();
+    std::uint64_t hash = GetDirectionKey(snake.GetCurrentDirection()) ^ GetGrowthKey(snake.GetPendingGrowth());
+    if (!segments.empty()) {
+        hash ^= GetHeadKey(segments[0]) ^ GetTailKey(segments.back());
+    }
+    for (const Position& segment : segments) {
+        hash ^= GetBodyKey(segment);
+    }
+    return hash;
+}
+
+std::uint64_t ZobristHash::ComputeState(const GameSimulation& simulation) const {
+    return ComputeSnake(simulation.GetSnake()) ^ GetFoodKey(simulation.GetFood().GetPosition());
+}
@@ -1,5 +1,12 @@
 #include "Game.hpp"
+#include "InputSource.hpp"
+#include "ObservationEncoder.hpp"
+#include "PolicyNetwork.hpp"
+#include <cstdlib>
+#include <filesystem>
 #include <iostream>
+#include <memory>
+#include <string>
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
@@ -7,7 +14,91 @@
 #include <SFML/Network.hpp>
 
 int main(int argc, char* argv[]) {
-    Game game;
+    // --config <archivo>: configuración (por defecto snake.cfg si existe);
+    // se vigila y los cambios se aplican sin reiniciar
+    std::string configPath = GameConfig::DEFAULT_PATH;
+    bool isConfigExplicit = false;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == "--config") {
+            configPath = argv[i + 1];
+            isConfigExplicit = true;
+        }
+    }
+    
+    GameConfig config;
+    if (isConfigExplicit || std::filesystem::exists(configPath)) {
+        if (!GameConfig::LoadFromFile(configPath, config)) {
+            if (isConfigExplicit) {
+                return -1;
+            }
+            std::cerr << "Using default configuration" << std::endl;
+        }
+    }
+    
+    Game game(config);
+    game.WatchConfigFile(configPath);
+    
+    // --texture-budget <MB>: memoria máxima para texturas (equipos con poca RAM)
+    // --low-latency-audio: bloques de mezcla cortos para los efectos
+    // --audio-latency-report: histograma de latencia de los efectos al salir
+    // --input-latency-report: histograma tecla -> tick al salir
+    // --bot: la serpiente la maneja BotInputSource
+    // --policy <archivo>: la serpiente la maneja una red (PolicyInputSource)
+    // --input-script <archivo>: giros por tick leídos de un guion
+    // --rules <classic|wrap,no-self,multi-grow>: variante de reglas
+    // --tick-mode <normal|turbo|slow|fast>: velocidad inicial (T la cambia en partida)
+    // --metrics-port <n>: publica las métricas en http://127.0.0.1:<n>/metrics
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--config" && i + 1 < argc) {
+            i++;
+        } else if (arg == "--texture-budget" && i + 1 < argc) {
+            game.SetTextureMemoryBudget(static_cast<size_t>(std::atof(argv[++i]) * 1024.0 * 1024.0));
+        } else if (arg == "--low-latency-audio") {
+            game.SetLowLatencyAudio(true);
+        } else if (arg == "--audio-latency-report") {
+            game.SetAudioLatencyReport(true);
+        } else if (arg == "--input-latency-report") {
+            game.SetInputLatencyReport(true);
+        } else if (arg == "--bot") {
+            game.SetInputSource(std::make_unique<BotInputSource>());
+        } else if (arg == "--policy" && i + 1 < argc) {
+            auto network = std::make_shared<PolicyNetwork>();
+            if (!network->LoadFromFile(argv[++i])) {
+                return -1;
+            }
+            if (!PolicyInputSource::IsCompatible(*network)) {
+                std::cerr << "Policy input must be " << ObservationEncoder::PLANE_COUNT
+                          << " square planes of odd size: " << argv[i] << std::endl;
+                return -1;
+            }
+            game.SetInputSource(std::make_unique<PolicyInputSource>(network));
+        } else if (arg == "--input-script" && i + 1 < argc) {
+            auto script = std::make_unique<ScriptedInputSource>();
+            if (!script->LoadFromFile(argv[++i])) {
+                return -1;
+            }
+            game.SetInputSource(std::move(script));
+        } else if (arg == "--rules" && i + 1 < argc) {
+            GameRules rules;
+            if (!GameRules::FromString(argv[++i], rules)) {
+                std::cerr << "Unknown rules: " << argv[i] << std::endl;
+                return -1;
+            }
+            game.SetRules(rules);
+        } else if (arg == "--tick-mode" && i + 1 < argc) {
+            std::string mode = argv[++i];
+            if (mode == "turbo") {
+                game.SetTickMode(TickMode::TURBO);
+            } else if (mode == "slow") {
+                game.SetTickMode(TickMode::SLOW_MOTION);
+            } else if (mode == "fast") {
+                game.SetTickMode(TickMode::FAST_FORWARD);
+            }
+        } else if (arg == "--metrics-port" && i + 1 < argc) {
+            game.SetMetricsPort(std::atoi(argv[++i]));
+        }
+    }
     
     if (!game.Initialize()) {
         std::cerr << "Failed to initialize game!" << std::endl;
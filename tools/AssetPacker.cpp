@@ -0,0 +1,98 @@
+#include "AssetLoader.hpp"
+#include "AssetPack.hpp"
+#include "AudioManager.hpp"
+#include "GameRenderer.hpp"
+#include "SoftwareRasterizer.hpp"
+#include "ThreadPool.hpp"
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+namespace {
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [output] [options]\n"
+              << "  output              Pack file (default " << AssetPack::DEFAULT_PATH << ")\n"
+              << "  --no-prescale       Keep images at their original size\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string outputPath = AssetPack::DEFAULT_PATH;
+    bool prescale = true;
+    
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--no-prescale") {
+            prescale = false;
+        } else if (!arg.empty() && arg[0] != '-') {
+            outputPath = arg;
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+    
+    // Los mismos manifiestos que usa el juego para la carga sin pack
+    GameRenderer renderer;
+    AudioManager audioManager;
+    AssetLoader loader;
+    renderer.QueueAssets(loader);
+    audioManager.QueueAssets(loader);
+    
+    {
+        ThreadPool pool(ThreadPool::GetDefaultThreadCount());
+        loader.Start(pool);
+        while (!loader.WaitFor(std::chrono::milliseconds(100))) {
+        }
+    }
+    
+    AssetPackBuilder builder;
+    size_t failures = 0;
+    
+    for (const auto& asset : loader.GetAssets()) {
+        if (!asset->isLoaded) {
+            failures++;
+            continue;
+        }
+        
+        if (asset->type == AssetType::SOUND) {
+            builder.AddSound("sound/" + asset->name, asset->samples, asset->channelCount, asset->sampleRate);
+            continue;
+        }
+        
+        const sf::Vector2u size = asset->image.getSize();
+        RasterImage image;
+        SoftwareRasterizer::CreateImage(asset->image.getPixelsPtr(), static_cast<int>(size.x),
+                                        static_cast<int>(size.y), image);
+        
+        // Reducir al tamaño con el que se dibuja (nunca ampliar)
+        sf::Vector2i drawSize = renderer.GetImageDrawSize(asset->name);
+        if (prescale && drawSize.x > 0 && drawSize.x < image.width && drawSize.y < image.height) {
+            RasterImage scaled;
+            SoftwareRasterizer::DownscaleImage(image, drawSize.x, drawSize.y, scaled);
+            image = std::move(scaled);
+        }
+        
+        builder.AddImage("image/" + asset->name, image);
+        std::printf("%-24s %5dx%-5d\n", asset->name.c_str(), image.width, image.height);
+    }
+    
+    for (const auto& track : audioManager.GetMusicFiles()) {
+        if (!builder.AddFile("music/" + track.first, track.second)) {
+            failures++;
+        }
+    }
+    
+    if (!builder.Write(outputPath)) {
+        return 1;
+    }
+    
+    std::cout << "Wrote " << builder.GetEntryCount() << " entries to " << outputPath;
+    if (failures > 0) {
+        std::cout << " (" << failures << " assets failed to load)";
+    }
+    std::cout << std::endl;
+    return failures > 0 ? 1 : 0;
+}
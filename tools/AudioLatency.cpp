@@ -0,0 +1,111 @@
+#include "AudioManager.hpp"
+#include "AudioMixer.hpp"
+#include "Histogram.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// sf::SoundStream (SFML 2.5/2.6) revisa la cola cada 10 ms
+const int STREAM_POLL_MS = 10;
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --seconds <n>       Duration per mode (default 10)\n"
+              << "  --poll-ms <n>       Stream refill interval in milliseconds (default 10)\n";
+}
+
+// Si los WAV no se pudieron cargar, usar un tono sintético con el mismo nombre
+void EnsureClip(AudioMixer& mixer) {
+    if (mixer.HasClip("eat")) return;
+
+    std::vector<std::int16_t> tone(AudioMixer::OUTPUT_SAMPLE_RATE / 4);
+    for (size_t i = 0; i < tone.size(); i++) {
+        tone[i] = static_cast<std::int16_t>(8000.0 * std::sin(i * 0.05));
+    }
+    mixer.AddClip("eat", tone.data(), tone.size(), 1, AudioMixer::OUTPUT_SAMPLE_RATE);
+}
+
+void Measure(bool lowLatency, int seconds, int pollMilliseconds) {
+    AudioManager audio;
+    audio.SetLowLatencyMode(lowLatency);
+    audio.Initialize();
+    audio.LoadAudioAssets();
+    EnsureClip(*audio.GetMixer());
+    audio.GetMixer()->SetLatencyTracking(true);
+    audio.StartAudioThread();
+
+    const size_t bufferFrames = lowLatency ? MixerStream::LOW_LATENCY_BUFFER_FRAMES : MixerStream::BUFFER_FRAMES;
+
+    // Sustituto del hilo de sf::SoundStream (que sin dispositivo no pide datos):
+    // cada intervalo repone los bloques que el dispositivo ya habría reproducido
+    std::atomic<bool> streaming(true);
+    std::thread streamThread([&]() {
+        std::vector<std::int16_t> buffer(bufferFrames * AudioMixer::OUTPUT_CHANNELS);
+        auto start = std::chrono::steady_clock::now();
+        std::uint64_t submitted = 0;
+
+        while (streaming) {
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::uint64_t played = static_cast<std::uint64_t>(elapsed * AudioMixer::OUTPUT_SAMPLE_RATE) / bufferFrames;
+            while (submitted < played + MixerStream::QUEUED_BUFFERS) {
+                audio.GetMixer()->Mix(buffer.data(), bufferFrames);
+                submitted++;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(pollMilliseconds));
+        }
+    });
+
+    // Efectos a intervalos irregulares, como al comer en partida
+    std::mt19937 random(12345);
+    std::uniform_int_distribution<int> pause(20, 80);
+    auto end = std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+    while (std::chrono::steady_clock::now() < end) {
+        audio.PlaySoundEffect("eat");
+        std::this_thread::sleep_for(std::chrono::milliseconds(pause(random)));
+    }
+
+    streaming = false;
+    streamThread.join();
+
+    std::cout << (lowLatency ? "low latency" : "default") << ": " << bufferFrames << " frames per block, "
+              << "stream queue " << audio.GetOutputLatency().asMilliseconds() << " ms\n";
+    std::cout << "trigger -> first block submitted:\n";
+    audio.GetMixer()->GetTriggerLatency().Print(std::cout, "us");
+    std::cout << std::endl;
+
+    audio.Cleanup();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int seconds = 10;
+    int pollMilliseconds = STREAM_POLL_MS;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--seconds" && hasValue) {
+            seconds = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--poll-ms" && hasValue) {
+            pollMilliseconds = std::max(1, std::atoi(argv[++i]));
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    Measure(false, seconds, pollMilliseconds);
+    Measure(true, seconds, pollMilliseconds);
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include "GameSimulation.hpp"
+#include "InputSource.hpp"
+#include "Replay.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace {
+
+const int GRID_WIDTH = 50;
+const int GRID_HEIGHT = 35;
+
+struct SoakStats {
+    std::uint64_t rounds;
+    std::uint64_t ticks;
+    std::uint64_t inputs;
+    std::uint64_t mismatches;     // Partidas que la grabación no reproduce igual
+    double seconds;
+    double averageScore;
+};
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --ticks <n>         Simulated ticks per source (default 2000000)\n"
+              << "  --max-round <n>     Tick limit for one round (default 5000)\n"
+              << "  --no-verify         Skip replaying each round from its recording\n";
+}
+
+// Mismo paso que Game::Update: como mucho un giro, grabarlo y avanzar un tick
+bool PlayTick(InputSource& source, GameSimulation& simulation, Replay& replay, std::uint64_t& inputs) {
+    std::uint64_t tick = simulation.GetTickCount();
+    DirectionInput input;
+    if (source.Apply(simulation, input)) {
+        replay.RecordDirection(tick, input.direction);
+        inputs++;
+    }
+    simulation.Tick();
+    return !simulation.IsGameOver();
+}
+
+bool VerifyRound(const Replay& replay, const GameSimulation& played) {
+    GameSimulation simulation(replay.GetGridWidth(), replay.GetGridHeight());
+    simulation.SetRules(replay.GetRules());
+    simulation.Reset(replay.GetSeed());
+
+    ReplayInputSource source(replay);
+    DirectionInput input;
+    while (!simulation.IsGameOver() && simulation.GetTickCount() < replay.GetTickCount()) {
+        source.Apply(simulation, input);
+        simulation.Tick();
+    }
+
+    return simulation.GetScore() == played.GetScore() &&
+           simulation.GetTickCount() == played.GetTickCount() &&
+           simulation.GetSnake().GetHead() == played.GetSnake().GetHead();
+}
+
+SoakStats RunSoak(InputSource& source, std::uint64_t totalTicks, std::uint64_t maxRoundTicks, bool verify) {
+    SoakStats stats = {};
+    GameSimulation simulation(GRID_WIDTH, GRID_HEIGHT);
+    Replay replay;
+    std::uint64_t scoreSum = 0;
+    std::uint32_t seed = 1;
+
+    auto start = std::chrono::steady_clock::now();
+
+    while (stats.ticks < totalTicks) {
+        simulation.Reset(seed++);
+        replay.Begin(GRID_WIDTH, GRID_HEIGHT, simulation.GetSeed(), simulation.GetRules());
+        source.Reset();
+
+        while (PlayTick(source, simulation, replay, stats.inputs) &&
+               simulation.GetTickCount() < maxRoundTicks) {
+        }
+
+        replay.Finish(simulation.GetTickCount());
+        stats.ticks += simulation.GetTickCount();
+        stats.rounds++;
+        scoreSum += simulation.GetScore();
+
+        if (verify && !VerifyRound(replay, simulation)) {
+            stats.mismatches++;
+        }
+    }
+
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    stats.averageScore = static_cast<double>(scoreSum) / std::max<std::uint64_t>(1, stats.rounds);
+    return stats;
+}
+
+void PrintStats(const char* label, const SoakStats& stats) {
+    std::printf("%-8s %9llu %11llu %11llu %12.0f %12.0f %9.1f %10llu\n", label,
+                static_cast<unsigned long long>(stats.rounds),
+                static_cast<unsigned long long>(stats.ticks),
+                static_cast<unsigned long long>(stats.inputs),
+                stats.ticks / stats.seconds, stats.inputs / stats.seconds, stats.averageScore,
+                static_cast<unsigned long long>(stats.mismatches));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::uint64_t totalTicks = 2000000;
+    std::uint64_t maxRoundTicks = 5000;
+    bool verify = true;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--ticks" && hasValue) {
+            totalTicks = std::max(1LL, std::atoll(argv[++i]));
+        } else if (arg == "--max-round" && hasValue) {
+            maxRoundTicks = std::max(1LL, std::atoll(argv[++i]));
+        } else if (arg == "--no-verify") {
+            verify = false;
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    std::printf("%-8s %9s %11s %11s %12s %12s %9s %10s\n", "source", "rounds", "ticks", "inputs",
+                "ticks/s", "inputs/s", "avg score", "mismatch");
+
+    RandomInputSource random(12345);
+    PrintStats("random", RunSoak(random, totalTicks, maxRoundTicks, verify));
+
+    BotInputSource bot;
+    PrintStats("bot", RunSoak(bot, totalTicks, maxRoundTicks, verify));
+
+    // Guion generado: un giro cada 3 ticks recorriendo las cuatro direcciones
+    ScriptedInputSource script;
+    const Direction pattern[] = { Direction::UP, Direction::LEFT, Direction::DOWN, Direction::RIGHT };
+    for (std::uint64_t tick = 0; tick < maxRoundTicks; tick += 3) {
+        script.AddInput(tick, pattern[(tick / 3) % 4]);
+    }
+    PrintStats("script", RunSoak(script, totalTicks, maxRoundTicks, verify));
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include "Replay.hpp"
+#include "ReplayExporter.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace {
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " <replay file> [options]\n"
+              << "  --output <path>     Output file (y4m) or frame prefix (png)\n"
+              << "  --format y4m|png    Output format (default y4m)\n"
+              << "  --threads <n>       Render/encode workers (default: hardware threads)\n"
+              << "  --queue <n>         Maximum frames in flight (default 16)\n"
+              << "  --sweep             Measure frames per second for 1..N threads without writing\n";
+}
+
+bool RunExport(const Replay& replay, const ExportOptions& options, ExportStats& stats) {
+    ReplayExporter exporter(options);
+    return exporter.Export(replay, stats);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        PrintUsage(argv[0]);
+        return 2;
+    }
+
+    std::string replayPath = argv[1];
+    ExportOptions options;
+    options.threadCount = std::max(1u, std::thread::hardware_concurrency());
+    bool sweep = false;
+
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--output" && hasValue) {
+            options.outputPath = argv[++i];
+        } else if (arg == "--format" && hasValue) {
+            std::string format = argv[++i];
+            if (format == "y4m") {
+                options.format = ExportFormat::Y4M;
+            } else if (format == "png") {
+                options.format = ExportFormat::PNG_SEQUENCE;
+            } else {
+                std::cerr << "Unknown format: " << format << std::endl;
+                return 2;
+            }
+        } else if (arg == "--threads" && hasValue) {
+            options.threadCount = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--queue" && hasValue) {
+            options.queueCapacity = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--sweep") {
+            sweep = true;
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    Replay replay;
+    if (!replay.LoadFromFile(replayPath)) {
+        return 1;
+    }
+
+    if (sweep) {
+        // Mismo trabajo de renderizado y codificación, sin escribir a disco
+        int maxThreads = options.threadCount;
+        options.discardOutput = true;
+
+        std::printf("%8s %10s %12s %18s\n", "Threads", "Frames", "Frames/s", "Checksum");
+        for (int threads = 1; threads <= maxThreads; threads *= 2) {
+            options.threadCount = threads;
+            ExportStats stats;
+            if (!RunExport(replay, options, stats)) {
+                return 1;
+            }
+            std::printf("%8d %10llu %12.1f %18llx\n", threads,
+                        static_cast<unsigned long long>(stats.frames),
+                        stats.GetFramesPerSecond(),
+                        static_cast<unsigned long long>(stats.checksum));
+
+            if (threads < maxThreads && threads * 2 > maxThreads) {
+                threads = maxThreads / 2;
+            }
+        }
+        return 0;
+    }
+
+    if (options.outputPath.empty()) {
+        options.outputPath = (options.format == ExportFormat::Y4M) ? "replay.y4m" : "frame";
+    }
+
+    ExportStats stats;
+    if (!RunExport(replay, options, stats)) {
+        std::cerr << "Export failed" << std::endl;
+        return 1;
+    }
+
+    std::printf("Exported %llu frames in %.2f s (%.1f frames/s, %d threads), checksum %016llx\n",
+                static_cast<unsigned long long>(stats.frames), stats.seconds,
+                stats.GetFramesPerSecond(), options.threadCount,
+                static_cast<unsigned long long>(stats.checksum));
+    return 0;
+}
@@ -0,0 +1,193 @@
+#include "ScoreStore.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --records <n>       Scores in the generated store (default 10000000)\n"
+              << "  --repetitions <n>   Recoveries per configuration (default 3)\n"
+              << "  --directory <path>  Scratch directory, wiped before and after (default: system temp)\n";
+}
+
+// Descarta los archivos del almacén de la caché de páginas (arranque en frío)
+bool EvictFromPageCache(const std::string& directory) {
+#if defined(POSIX_FADV_DONTNEED)
+    bool evicted = true;
+    for (const std::string& path : { directory + "/scores.log", directory + "/scores.snap" }) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) continue;
+        fdatasync(fd);
+        if (posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) != 0) {
+            evicted = false;
+        }
+        close(fd);
+    }
+    return evicted;
+#else
+    (void)directory;
+    return false;
+#endif
+}
+
+std::vector<ScoreRecord> GenerateRecords(std::uint64_t count) {
+    std::vector<ScoreRecord> records(static_cast<size_t>(count));
+    std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (std::uint64_t i = 0; i < count; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        ScoreRecord& record = records[static_cast<size_t>(i)];
+        record.sequence = i + 1;
+        record.timestamp = 1700000000 + static_cast<std::int64_t>(i);
+        record.seed = state;
+        record.score = static_cast<std::int32_t>(state % 2000) * 10;
+        record.tickCount = static_cast<std::uint32_t>(state >> 40) % 20000;
+    }
+    return records;
+}
+
+double Median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    size_t middle = values.size() / 2;
+    return (values.size() % 2 == 1) ? values[middle] : (values[middle - 1] + values[middle]) / 2.0;
+}
+
+// Abre (y recupera) el almacén repetidas veces; el hilo de volcado no llega a escribir
+bool ReportRecovery(const char* label, const std::string& directory, bool cold, int repetitions,
+                    std::uint64_t expected) {
+    std::vector<double> seconds;
+    ScoreRecoveryStats stats;
+
+    for (int i = 0; i < repetitions; i++) {
+        ScoreStore store;
+        store.SetCompactThreshold(0);
+        if (cold) {
+            EvictFromPageCache(directory);
+        }
+        if (!store.Open(directory)) return false;
+        stats = store.GetRecoveryStats();
+        seconds.push_back(stats.seconds);
+        if (store.GetRecordCount() != expected) {
+            std::cerr << "Recovered " << store.GetRecordCount() << " scores, expected " << expected << std::endl;
+            return false;
+        }
+    }
+
+    double median = Median(seconds);
+    std::printf("%-16s %6s %12llu %12llu %12.1f %14.1f\n", label, cold ? "cold" : "warm",
+                static_cast<unsigned long long>(stats.snapshotRecords),
+                static_cast<unsigned long long>(stats.logRecords), median * 1000.0,
+                static_cast<double>(expected) / median / 1e6);
+    return true;
+}
+
+// Simula un apagón a mitad de escritura: media entrada al final del log
+bool CheckTornTail(const std::string& directory, std::uint64_t expected) {
+    ScoreStore store;
+    store.SetCompactThreshold(0);
+    if (!store.Open(directory)) return false;
+    for (int i = 0; i < 3; i++) {
+        store.Add(100 + i, 10, 1);
+    }
+    store.Close();
+
+    std::error_code error;
+    std::uint64_t size = std::filesystem::file_size(store.GetLogPath(), error);
+    std::filesystem::resize_file(store.GetLogPath(), size - 20, error);
+
+    if (!store.Open(directory)) return false;
+    bool isRecovered = store.GetRecordCount() == expected + 2 && store.GetRecoveryStats().discardedBytes == 16;
+    std::cout << "Torn tail: kept " << store.GetRecordCount() - expected << " of 3 new scores, discarded "
+              << store.GetRecoveryStats().discardedBytes << " bytes -> " << (isRecovered ? "OK" : "FAILED") << std::endl;
+    return isRecovered;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::uint64_t recordCount = 10000000;
+    int repetitions = 3;
+    std::string directory = (std::filesystem::temp_directory_path() / "snake-score-recovery").string();
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--records" && hasValue) {
+            recordCount = std::max(1ULL, std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--repetitions" && hasValue) {
+            repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--directory" && hasValue) {
+            directory = argv[++i];
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::remove_all(directory, error);
+    std::filesystem::create_directories(directory, error);
+
+    std::cout << "Generating " << recordCount << " scores in " << directory << std::endl;
+    if (!ScoreStore::WriteLog(directory + "/scores.log", GenerateRecords(recordCount))) {
+        return 1;
+    }
+    if (!EvictFromPageCache(directory)) {
+        std::cout << "Note: page cache eviction unavailable, cold runs may hit the cache\n";
+    }
+
+    std::printf("%-16s %6s %12s %12s %12s %14s\n", "store", "cache", "snapshot", "log", "ms(med)", "Mscores/s");
+    bool isOk = ReportRecovery("log only", directory, true, repetitions, recordCount) &&
+                ReportRecovery("log only", directory, false, repetitions, recordCount);
+
+    // Compactar y repetir: todo sale del snapshot
+    if (isOk) {
+        ScoreStore store;
+        store.SetCompactThreshold(0);
+        auto start = std::chrono::steady_clock::now();
+        isOk = store.Open(directory) && store.Compact();
+        double compactSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        store.Close();
+        isOk = isOk && ReportRecovery("snapshot", directory, true, repetitions, recordCount) &&
+               ReportRecovery("snapshot", directory, false, repetitions, recordCount);
+        std::printf("Compaction (open + snapshot + fsync): %.1f ms\n", compactSeconds * 1000.0);
+    }
+
+    // Coste de Add en el hilo del juego: encolar, sin E/S
+    if (isOk) {
+        ScoreStore store;
+        store.SetCompactThreshold(0);
+        isOk = store.Open(directory);
+        const int adds = 1000;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < adds; i++) {
+            store.Add(i, 100, static_cast<std::uint64_t>(i));
+        }
+        double addNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / adds;
+        auto flushStart = std::chrono::steady_clock::now();
+        isOk = isOk && store.Flush();
+        double flushMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - flushStart).count();
+        std::printf("Add on game thread: %.0f ns; flusher made them durable %.2f ms later\n", addNs, flushMs);
+        store.Close();
+        recordCount += adds;
+    }
+
+    isOk = isOk && CheckTornTail(directory, recordCount);
+
+    std::filesystem::remove_all(directory, error);
+    return isOk ? 0 : 1;
+}
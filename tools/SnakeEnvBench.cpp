@@ -0,0 +1,179 @@
+// Cliente de libsnakeenv: solo usa la API C de SnakeEnv.h, como lo haría
+// un binding de Python, y mide pasos/s y la latencia de cada paso del lote.
+#include "SnakeEnv.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const size_t ACTION_ROUNDS = 64;    // Pasos con acciones distintas antes de repetir
+const int WARMUP_STEPS = 50;
+
+struct BenchOptions {
+    std::uint32_t envCount;
+    std::uint32_t steps;
+    std::uint64_t seed;
+    SnakeEnvConfig config;
+};
+
+struct BenchResult {
+    double seconds;
+    std::vector<double> latencies;  // Microsegundos por llamada a snake_env_step
+    std::uint64_t episodes;
+    double rewardSum;
+};
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --envs <n>          Environments in the batch (default 4096)\n"
+              << "  --steps <n>         Batch steps to time (default 2000)\n"
+              << "  --width <n>         Grid width (default 16)\n"
+              << "  --height <n>        Grid height (default 16)\n"
+              << "  --seed <n>          Reset seed (default 1)\n";
+}
+
+// Acciones aleatorias pregeneradas: generarlas no entra en la medida
+std::vector<std::int8_t> CreateActions(std::uint32_t envCount) {
+    std::vector<std::int8_t> actions(static_cast<size_t>(envCount) * ACTION_ROUNDS);
+    std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (std::int8_t& action : actions) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        int value = static_cast<int>(state % 8);
+        action = static_cast<std::int8_t>(value < 4 ? value : -1);
+    }
+    return actions;
+}
+
+bool RunBench(SnakeEnv* env, const BenchOptions& options, bool withObservations, BenchResult& result) {
+    size_t envCount = options.envCount;
+
+    // Todos los buffers se reservan aquí; dentro del bucle no hay reservas
+    std::vector<float> observations(envCount * snake_env_observation_size(env));
+    std::vector<float> rewards(envCount);
+    std::vector<std::uint8_t> dones(envCount);
+    std::vector<std::int8_t> actions = CreateActions(options.envCount);
+    float* observationBuffer = withObservations ? observations.data() : nullptr;
+
+    if (snake_env_reset(env, options.seed, observationBuffer) != SNAKE_ENV_OK) {
+        std::cerr << "Failed to reset environment" << std::endl;
+        return false;
+    }
+
+    for (int step = 0; step < WARMUP_STEPS; step++) {
+        snake_env_step(env, &actions[(step % ACTION_ROUNDS) * envCount], observationBuffer, rewards.data(),
+                       dones.data());
+    }
+
+    result.latencies.assign(options.steps, 0.0);
+    result.episodes = 0;
+    result.rewardSum = 0.0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::uint32_t step = 0; step < options.steps; step++) {
+        auto before = std::chrono::steady_clock::now();
+        int status = snake_env_step(env, &actions[(step % ACTION_ROUNDS) * envCount], observationBuffer,
+                                    rewards.data(), dones.data());
+        auto after = std::chrono::steady_clock::now();
+
+        if (status != SNAKE_ENV_OK) {
+            std::cerr << "Failed to step environment (status " << status << ")" << std::endl;
+            return false;
+        }
+        result.latencies[step] = std::chrono::duration<double, std::micro>(after - before).count();
+
+        // Lo que haría quien entrena: leer los resultados del paso
+        for (size_t i = 0; i < envCount; i++) {
+            result.episodes += dones[i];
+            result.rewardSum += rewards[i];
+        }
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+double Percentile(const std::vector<double>& sorted, double fraction) {
+    size_t index = static_cast<size_t>(fraction * static_cast<double>(sorted.size() - 1));
+    return sorted[index];
+}
+
+void PrintResult(const char* label, const BenchOptions& options, BenchResult& result) {
+    std::vector<double>& latencies = result.latencies;
+    std::sort(latencies.begin(), latencies.end());
+
+    // El tiempo total incluye leer recompensas y finales; las latencias, solo la llamada
+    double envSteps = static_cast<double>(options.envCount) * options.steps;
+    std::printf("%-22s %12.3e %12.3e %10.1f %10.1f %10.1f %10.1f %10llu\n", label, envSteps / result.seconds,
+                options.steps / result.seconds, Percentile(latencies, 0.5), Percentile(latencies, 0.9),
+                Percentile(latencies, 0.99), latencies.back(), static_cast<unsigned long long>(result.episodes));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    options.envCount = 4096;
+    options.steps = 2000;
+    options.seed = 1;
+    snake_env_default_config(&options.config);
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--envs" && hasValue) {
+            options.envCount = static_cast<std::uint32_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--steps" && hasValue) {
+            options.steps = static_cast<std::uint32_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--width" && hasValue) {
+            options.config.width = std::atoi(argv[++i]);
+        } else if (arg == "--height" && hasValue) {
+            options.config.height = std::atoi(argv[++i]);
+        } else if (arg == "--seed" && hasValue) {
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (snake_env_abi_version() != SNAKE_ENV_ABI_VERSION) {
+        std::cerr << "Failed to load libsnakeenv: ABI version " << snake_env_abi_version() << ", expected "
+                  << SNAKE_ENV_ABI_VERSION << std::endl;
+        return 1;
+    }
+
+    SnakeEnv* env = snake_env_create(options.envCount, &options.config);
+    if (!env) {
+        std::cerr << "Failed to create environment: invalid configuration" << std::endl;
+        return 1;
+    }
+
+    std::printf("libsnakeenv ABI %u: %u envs, %dx%d grid, %u batch steps, %zu floats of observation per env\n\n",
+                snake_env_abi_version(), options.envCount, options.config.width, options.config.height,
+                options.steps, snake_env_observation_size(env));
+    std::printf("%-22s %12s %12s %10s %10s %10s %10s %10s\n", "mode", "env-steps/s", "batch/s", "p50 us",
+                "p90 us", "p99 us", "max us", "episodes");
+
+    BenchResult result;
+    int exitCode = 0;
+    if (RunBench(env, options, false, result)) {
+        PrintResult("step", options, result);
+    } else {
+        exitCode = 1;
+    }
+    if (RunBench(env, options, true, result)) {
+        PrintResult("step + observations", options, result);
+    } else {
+        exitCode = 1;
+    }
+
+    snake_env_destroy(env);
+    return exitCode;
+}
@@ -0,0 +1,383 @@
+#include "GameSimulation.hpp"
+#include "TranspositionTable.hpp"
+#include "ZobristHash.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const int GRID_WIDTH = 50;
+const int GRID_HEIGHT = 35;
+const int FOOD_VALUE = 1000;
+const int DEATH_VALUE = -1000;
+const int MIN_TABLE_DEPTH = 2;         // Con menos profundidad, buscar cuesta menos que consultar la tabla
+const std::uint64_t TABLE_OPERATIONS_PER_THREAD = 4000000;
+
+struct SearchOptions {
+    std::uint64_t games;
+    unsigned int threads;
+    std::uint32_t baseSeed;
+    std::uint64_t maxTicks;
+    int depth;
+    size_t tableBytes;
+    bool isTableEnabled;
+    GameRules rules;
+    bool isScalingRun;
+};
+
+/**
+ * Contadores de un hilo, en su propia línea de caché. found = la clave
+ * estaba en la tabla; used = además con la misma profundidad restante, así
+ * que el subárbol no se vuelve a buscar (esa es la tasa de aciertos).
+ */
+struct alignas(64) SearchStats {
+    std::uint64_t games;
+    std::uint64_t decisions;
+    std::uint64_t nodes;
+    std::uint64_t probes;
+    std::uint64_t found;
+    std::uint64_t used;
+    std::uint64_t mismatches;           // Hash incremental distinto del calculado desde cero
+    std::uint64_t scoreSum;
+
+    SearchStats() : games(0), decisions(0), nodes(0), probes(0), found(0), used(0), mismatches(0), scoreSum(0) {}
+
+    void Merge(const SearchStats& other) {
+        games += other.games;
+        decisions += other.decisions;
+        nodes += other.nodes;
+        probes += other.probes;
+        found += other.found;
+        used += other.used;
+        mismatches += other.mismatches;
+        scoreSum += other.scoreSum;
+    }
+};
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --games <n>         Games to play (default 16)\n"
+              << "  --threads <n>       Worker threads sharing one table (default: hardware threads)\n"
+              << "  --depth <n>         Lookahead in ticks, searched with iterative deepening (default 6)\n"
+              << "  --table-mb <n>      Transposition table size in MiB (default 64)\n"
+              << "  --no-table          Search without the table (baseline nodes/s)\n"
+              << "  --seed <n>          Base seed; game i uses seed + i (default 1)\n"
+              << "  --max-ticks <n>     Tick limit for one game (default 2000)\n"
+              << "  --rules <classic|wrap,no-self,multi-grow>  Rule variant (default classic)\n"
+              << "  --scaling           Repeat with 1, 2, 4 ... threads; also raw table operations/s\n";
+}
+
+/**
+ * Búsqueda exhaustiva de un jugador: el valor de un estado es el mejor de
+ * sus hijos. Comer es terminal (la comida siguiente depende del generador,
+ * que no entra en el hash) y las hojas valen menos cuanto más lejos está la
+ * comida. El valor solo depende del estado y de la profundidad restante, por
+ * eso la tabla únicamente corta con la misma profundidad y las partidas dan
+ * lo mismo con cualquier número de hilos.
+ *
+ * Con profundización iterativa, la iteración d-1 de un tick visita los
+ * estados que la iteración d del tick anterior dejó en la tabla.
+ */
+class Searcher {
+private:
+    const SearchOptions& options;
+    TranspositionTable* table;          // nullptr = sin tabla
+    SearchStats& stats;
+    std::vector<GameSimulation> stack;  // Un estado por ply; se reutiliza entre decisiones
+
+public:
+    Searcher(const SearchOptions& searchOptions, TranspositionTable* sharedTable, SearchStats& workerStats)
+        : options(searchOptions), table(sharedTable), stats(workerStats) {}
+
+    Direction Choose(const GameSimulation& simulation) {
+        if (stack.empty()) {
+            stack.assign(static_cast<size_t>(options.depth) + 1, simulation);
+        }
+        stack[0] = simulation;
+        if (table) {
+            table->NewSearch();
+        }
+
+        Direction best = simulation.GetSnake().GetCurrentDirection();
+        for (int depth = 1; depth <= options.depth; depth++) {
+            best = SearchRoot(depth);
+        }
+        return best;
+    }
+
+private:
+    Direction SearchRoot(int depth) {
+        Direction best = stack[0].GetSnake().GetCurrentDirection();
+        int bestValue = INT_MIN;
+        for (Direction direction : { Direction::UP, Direction::DOWN, Direction::LEFT, Direction::RIGHT }) {
+            if (!stack[0].GetSnake().IsValidDirection(direction)) continue;
+
+            int value = SearchChild(0, direction, depth - 1);
+            if (value > bestValue) {
+                bestValue = value;
+                best = direction;
+            }
+        }
+        return best;
+    }
+
+    int SearchChild(int ply, Direction direction, int remaining) {
+        GameSimulation& child = stack[ply + 1];
+        child = stack[ply];
+        child.ChangeDirection(direction);
+        TickResult result = child.Tick();
+        stats.nodes++;
+
+        if (result == TickResult::HIT_WALL || result == TickResult::HIT_SELF) {
+            return DEATH_VALUE - remaining;     // Mejor morir tarde
+        }
+        if (result == TickResult::ATE_FOOD || result == TickResult::BOARD_FILLED) {
+            return FOOD_VALUE + remaining;      // Mejor comer pronto
+        }
+        if (remaining == 0) {
+            const Position& head = child.GetSnake().GetHead();
+            const Position& food = child.GetFood().GetPosition();
+            return -(std::abs(head.x - food.x) + std::abs(head.y - food.y));
+        }
+
+        bool isTableUsed = table && remaining >= MIN_TABLE_DEPTH;
+        std::uint64_t key = child.GetStateHash();
+        TranspositionEntry entry;
+        if (isTableUsed) {
+            stats.probes++;
+            if (table->Probe(key, entry)) {
+                stats.found++;
+                if (entry.depth == remaining) {
+                    stats.used++;
+                    return entry.value;
+                }
+            }
+        }
+
+        int bestValue = INT_MIN;
+        int bestAction = -1;
+        for (Direction next : { Direction::UP, Direction::DOWN, Direction::LEFT, Direction::RIGHT }) {
+            if (!child.GetSnake().IsValidDirection(next)) continue;
+
+            int value = SearchChild(ply + 1, next, remaining - 1);
+            if (value > bestValue) {
+                bestValue = value;
+                bestAction = static_cast<int>(next);
+            }
+        }
+
+        if (isTableUsed) {
+            table->Store(key, TranspositionEntry(bestValue, remaining, bestAction));
+        }
+        return bestValue;
+    }
+};
+
+// Partidas i % T == worker; todos los hilos comparten la tabla y las claves
+void RunWorker(const SearchOptions& options, const ZobristHash& keys, TranspositionTable* table, unsigned int worker,
+               unsigned int workerCount, SearchStats& stats) {
+    GameSimulation simulation(GRID_WIDTH, GRID_HEIGHT);
+    simulation.SetRules(options.rules);
+    simulation.SetZobristHash(&keys);
+    Searcher searcher(options, table, stats);
+
+    for (std::uint64_t game = worker; game < options.games; game += workerCount) {
+        simulation.Reset(options.baseSeed + static_cast<std::uint32_t>(game));
+
+        while (!simulation.IsGameOver() && simulation.GetTickCount() < options.maxTicks) {
+            simulation.ChangeDirection(searcher.Choose(simulation));
+            simulation.Tick();
+            stats.decisions++;
+
+            if (!simulation.IsGameOver() && simulation.GetStateHash() != keys.ComputeState(simulation)) {
+                stats.mismatches++;
+            }
+        }
+
+        stats.scoreSum += static_cast<std::uint64_t>(simulation.GetScore());
+        stats.games++;
+    }
+}
+
+SearchStats RunBatch(const SearchOptions& options, unsigned int threadCount, double& seconds, double& occupancy) {
+    ZobristHash keys(GRID_WIDTH, GRID_HEIGHT);
+    TranspositionTable table(options.isTableEnabled ? options.tableBytes : 64);
+    std::vector<SearchStats> workerStats(threadCount);
+    std::vector<std::thread> workers;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int worker = 0; worker < threadCount; worker++) {
+        workers.emplace_back(RunWorker, std::cref(options), std::cref(keys),
+                             options.isTableEnabled ? &table : nullptr, worker, threadCount,
+                             std::ref(workerStats[worker]));
+    }
+    for (std::thread& thread : workers) {
+        thread.join();
+    }
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    occupancy = options.isTableEnabled ? table.GetOccupancy() : 0.0;
+
+    SearchStats total;
+    for (const SearchStats& stats : workerStats) {
+        total.Merge(stats);
+    }
+    return total;
+}
+
+double Percent(std::uint64_t part, std::uint64_t whole) {
+    return whole ? 100.0 * static_cast<double>(part) / static_cast<double>(whole) : 0.0;
+}
+
+void PrintReport(const SearchOptions& options, unsigned int threadCount, const SearchStats& stats, double seconds,
+                 double occupancy) {
+    std::printf("%llu games, depth %d, rules %s, %u threads, table %s\n",
+                static_cast<unsigned long long>(stats.games), options.depth, options.rules.ToString().c_str(),
+                threadCount,
+                options.isTableEnabled ? (std::to_string(options.tableBytes >> 20) + " MiB").c_str() : "off");
+    std::printf("%.2f s, %.0f decisions/s, %.0f nodes/s, %.0f nodes per decision, average score %.1f\n",
+                seconds, stats.decisions / seconds, stats.nodes / seconds,
+                stats.decisions ? static_cast<double>(stats.nodes) / stats.decisions : 0.0,
+                stats.games ? static_cast<double>(stats.scoreSum) / stats.games : 0.0);
+    if (options.isTableEnabled) {
+        std::printf("Table: %llu probes (%.0f/s), key found %.1f%%, subtree reused %.1f%%, occupancy %.0f%%\n",
+                    static_cast<unsigned long long>(stats.probes), stats.probes / seconds,
+                    Percent(stats.found, stats.probes), Percent(stats.used, stats.probes), 100.0 * occupancy);
+    }
+    std::printf("Hash check: %llu ticks, %llu mismatches\n", static_cast<unsigned long long>(stats.decisions),
+                static_cast<unsigned long long>(stats.mismatches));
+}
+
+// Consultas y escrituras (3:1) con claves aleatorias desde varios hilos sobre una sola tabla
+double MeasureTableOperations(TranspositionTable& table, unsigned int threadCount) {
+    std::vector<std::thread> workers;
+    std::vector<std::uint64_t> hits(threadCount * 8);     // Una línea de caché por hilo
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int worker = 0; worker < threadCount; worker++) {
+        workers.emplace_back([&table, &hits, worker]() {
+            std::uint64_t state = (worker + 1) * 0x9E3779B97F4A7C15ULL;
+            std::uint64_t found = 0;
+            TranspositionEntry entry;
+            for (std::uint64_t operation = 0; operation < TABLE_OPERATIONS_PER_THREAD; operation++) {
+                // Claves de un conjunto de 2^22 estados: se repiten y hay aciertos
+                state ^= state >> 12;
+                state ^= state << 25;
+                state ^= state >> 27;
+                std::uint64_t key = ((state * 0x2545F4914F6CDD1DULL) & ((1ULL << 22) - 1)) * 0xD6E8FEB86659FD93ULL;
+                if ((operation & 3) == 3) {
+                    table.Store(key, TranspositionEntry(static_cast<std::int32_t>(operation), 4));
+                } else {
+                    found += table.Probe(key, entry);
+                }
+            }
+            hits[worker * 8] = found;
+        });
+    }
+    for (std::thread& thread : workers) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(TABLE_OPERATIONS_PER_THREAD) * threadCount / seconds;
+}
+
+void PrintScaling(const SearchOptions& options) {
+    std::vector<unsigned int> threadCounts;
+    for (unsigned int threadCount = 1; threadCount < options.threads; threadCount *= 2) {
+        threadCounts.push_back(threadCount);
+    }
+    threadCounts.push_back(options.threads);
+
+    std::printf("%8s %10s %14s %14s %10s %9s %11s\n", "threads", "seconds", "nodes/s", "probes/s", "reused",
+                "speedup", "efficiency");
+    double baseSeconds = 0.0;
+    std::uint64_t baseScore = 0;
+    for (unsigned int threadCount : threadCounts) {
+        double seconds = 0.0;
+        double occupancy = 0.0;
+        SearchStats stats = RunBatch(options, threadCount, seconds, occupancy);
+        if (threadCount == 1) {
+            baseSeconds = seconds;
+            baseScore = stats.scoreSum;
+        } else if (stats.scoreSum != baseScore) {
+            std::cerr << "Results differ between 1 and " << threadCount << " threads" << std::endl;
+        }
+
+        double speedup = baseSeconds / seconds;
+        std::printf("%8u %10.2f %14.0f %14.0f %9.1f%% %8.2fx %10.0f%%\n", threadCount, seconds, stats.nodes / seconds,
+                    stats.probes / seconds, Percent(stats.used, stats.probes), speedup,
+                    100.0 * speedup / threadCount);
+    }
+
+    std::printf("\n%8s %16s %9s   (raw probe/store 3:1, %zu MiB table)\n", "threads", "operations/s", "speedup",
+                options.tableBytes >> 20);
+    TranspositionTable table(options.tableBytes);
+    double baseRate = 0.0;
+    for (unsigned int threadCount : threadCounts) {
+        double rate = MeasureTableOperations(table, threadCount);
+        if (threadCount == 1) baseRate = rate;
+        std::printf("%8u %16.0f %8.2fx\n", threadCount, rate, rate / baseRate);
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    SearchOptions options;
+    options.games = 16;
+    options.threads = std::max(1u, std::thread::hardware_concurrency());
+    options.baseSeed = 1;
+    options.maxTicks = 2000;
+    options.depth = 6;
+    options.tableBytes = static_cast<size_t>(64) << 20;
+    options.isTableEnabled = true;
+    options.isScalingRun = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--games" && hasValue) {
+            options.games = std::max(1LL, std::atoll(argv[++i]));
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = static_cast<unsigned int>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--depth" && hasValue) {
+            options.depth = std::min(std::max(1, std::atoi(argv[++i])), 32);
+        } else if (arg == "--table-mb" && hasValue) {
+            options.tableBytes = static_cast<size_t>(std::max(1, std::atoi(argv[++i]))) << 20;
+        } else if (arg == "--no-table") {
+            options.isTableEnabled = false;
+        } else if (arg == "--seed" && hasValue) {
+            options.baseSeed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--max-ticks" && hasValue) {
+            options.maxTicks = std::max(1LL, std::atoll(argv[++i]));
+        } else if (arg == "--rules" && hasValue) {
+            if (!GameRules::FromString(argv[++i], options.rules)) {
+                std::cerr << "Unknown rules: " << argv[i] << std::endl;
+                return 2;
+            }
+        } else if (arg == "--scaling") {
+            options.isScalingRun = true;
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (options.isScalingRun) {
+        PrintScaling(options);
+        return 0;
+    }
+
+    double seconds = 0.0;
+    double occupancy = 0.0;
+    SearchStats stats = RunBatch(options, options.threads, seconds, occupancy);
+    PrintReport(options, options.threads, stats, seconds, occupancy);
+    return stats.mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,244 @@
+#include "GameSimulation.hpp"
+#include "Histogram.hpp"
+#include "InputSource.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const int GRID_WIDTH = 50;
+const int GRID_HEIGHT = 35;
+
+enum class Controller {
+    BOT,
+    RANDOM
+};
+
+struct SimOptions {
+    std::uint64_t games;
+    unsigned int threads;
+    std::uint32_t baseSeed;
+    std::uint64_t maxTicks;         // Partidas que no terminan (bucles del bot) se cortan aquí
+    Controller controller;
+    GameRules rules;
+    bool isScalingRun;
+};
+
+/**
+ * Resultados de un hilo. Cada trabajador escribe solo los suyos (en su
+ * propia línea de caché) y el hilo principal los junta al final.
+ */
+struct alignas(64) WorkerStats {
+    Histogram scores;
+    Histogram lengths;
+    std::uint64_t games;
+    std::uint64_t ticks;
+    std::uint64_t wallDeaths;
+    std::uint64_t selfDeaths;
+    std::uint64_t boardsFilled;
+    std::uint64_t timeouts;
+
+    WorkerStats() : games(0), ticks(0), wallDeaths(0), selfDeaths(0), boardsFilled(0), timeouts(0) {}
+
+    void Merge(const WorkerStats& other) {
+        scores.Merge(other.scores);
+        lengths.Merge(other.lengths);
+        games += other.games;
+        ticks += other.ticks;
+        wallDeaths += other.wallDeaths;
+        selfDeaths += other.selfDeaths;
+        boardsFilled += other.boardsFilled;
+        timeouts += other.timeouts;
+    }
+};
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --games <n>         Games to play (default 10000)\n"
+              << "  --threads <n>       Worker threads (default: hardware threads)\n"
+              << "  --controller <bot|random>  Who plays (default bot)\n"
+              << "  --seed <n>          Base seed; game i uses seed + i (default 1)\n"
+              << "  --max-ticks <n>     Tick limit for one game (default 20000)\n"
+              << "  --rules <classic|wrap,no-self,multi-grow>  Rule variant (default classic)\n"
+              << "  --scaling           Repeat with 1, 2, 4 ... threads and report the speedup\n";
+}
+
+std::unique_ptr<InputSource> CreateController(Controller controller, std::uint32_t seed) {
+    if (controller == Controller::RANDOM) {
+        return std::make_unique<RandomInputSource>(seed, 20);
+    }
+    return std::make_unique<BotInputSource>();
+}
+
+// Mismo paso que Game::Update: entrada, tick y fin de partida según TickResult.
+// Sin estado compartido: simulación, controlador y resultados son del hilo.
+void RunWorker(const SimOptions& options, unsigned int worker, unsigned int workerCount, WorkerStats& stats) {
+    GameSimulation simulation(GRID_WIDTH, GRID_HEIGHT);
+    simulation.SetRules(options.rules);
+
+    // Reparto fijo (juego i al hilo i % T): los resultados no dependen de T
+    for (std::uint64_t game = worker; game < options.games; game += workerCount) {
+        std::uint32_t seed = options.baseSeed + static_cast<std::uint32_t>(game);
+        simulation.Reset(seed);
+        std::unique_ptr<InputSource> controller = CreateController(options.controller, seed);
+
+        TickResult result = TickResult::NONE;
+        DirectionInput input;
+        while (!simulation.IsGameOver() && simulation.GetTickCount() < options.maxTicks) {
+            controller->Apply(simulation, input);
+            result = simulation.Tick();
+        }
+
+        if (!simulation.IsGameOver()) {
+            stats.timeouts++;
+        } else if (result == TickResult::HIT_WALL) {
+            stats.wallDeaths++;
+        } else if (result == TickResult::HIT_SELF) {
+            stats.selfDeaths++;
+        } else if (result == TickResult::BOARD_FILLED) {
+            stats.boardsFilled++;
+        }
+
+        stats.scores.Record(static_cast<std::uint64_t>(simulation.GetScore()));
+        stats.lengths.Record(simulation.GetSnake().GetSegments().size());
+        stats.ticks += simulation.GetTickCount();
+        stats.games++;
+    }
+}
+
+// Lanza los trabajadores, espera y junta sus resultados
+WorkerStats RunBatch(const SimOptions& options, unsigned int threadCount, double& seconds) {
+    std::vector<WorkerStats> workerStats(threadCount);
+    std::vector<std::thread> workers;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int worker = 0; worker < threadCount; worker++) {
+        workers.emplace_back(RunWorker, std::cref(options), worker, threadCount, std::ref(workerStats[worker]));
+    }
+    for (std::thread& thread : workers) {
+        thread.join();
+    }
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    WorkerStats total;
+    for (const WorkerStats& stats : workerStats) {
+        total.Merge(stats);
+    }
+    return total;
+}
+
+double Percent(std::uint64_t part, std::uint64_t whole) {
+    return whole ? 100.0 * static_cast<double>(part) / static_cast<double>(whole) : 0.0;
+}
+
+void PrintReport(const SimOptions& options, unsigned int threadCount, const WorkerStats& stats, double seconds) {
+    std::printf("%llu games, %s controller, rules %s, %u threads, seeds %u..%llu\n",
+                static_cast<unsigned long long>(stats.games),
+                options.controller == Controller::BOT ? "bot" : "random", options.rules.ToString().c_str(),
+                threadCount, options.baseSeed,
+                static_cast<unsigned long long>(options.baseSeed + options.games - 1));
+    std::printf("%.2f s, %.0f games/s, %.0f ticks/s\n\n", seconds, stats.games / seconds, stats.ticks / seconds);
+
+    std::printf("Deaths: wall %llu (%.1f%%), self %llu (%.1f%%), board filled %llu, tick limit %llu\n\n",
+                static_cast<unsigned long long>(stats.wallDeaths), Percent(stats.wallDeaths, stats.games),
+                static_cast<unsigned long long>(stats.selfDeaths), Percent(stats.selfDeaths, stats.games),
+                static_cast<unsigned long long>(stats.boardsFilled),
+                static_cast<unsigned long long>(stats.timeouts));
+
+    std::cout << "Score:  ";
+    stats.scores.Print(std::cout, "pts");
+    std::cout << "\nLength: ";
+    stats.lengths.Print(std::cout, "cells");
+}
+
+// Mismo lote con 1, 2, 4 ... hilos: la eficiencia debería quedarse cerca del 100 %
+void PrintScaling(const SimOptions& options) {
+    std::printf("%8s %10s %14s %9s %11s\n", "threads", "seconds", "ticks/s", "speedup", "efficiency");
+
+    std::vector<unsigned int> threadCounts;
+    for (unsigned int threadCount = 1; threadCount < options.threads; threadCount *= 2) {
+        threadCounts.push_back(threadCount);
+    }
+    threadCounts.push_back(options.threads);
+
+    double baseSeconds = 0.0;
+    std::uint64_t baseTicks = 0;
+    for (unsigned int threadCount : threadCounts) {
+        double seconds = 0.0;
+        WorkerStats stats = RunBatch(options, threadCount, seconds);
+        if (threadCount == 1) {
+            baseSeconds = seconds;
+            baseTicks = stats.ticks;
+        } else if (stats.ticks != baseTicks) {
+            std::cerr << "Results differ between 1 and " << threadCount << " threads" << std::endl;
+        }
+
+        double speedup = baseSeconds / seconds;
+        std::printf("%8u %10.2f %14.0f %8.2fx %10.0f%%\n", threadCount, seconds, stats.ticks / seconds,
+                    speedup, 100.0 * speedup / threadCount);
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    SimOptions options;
+    options.games = 10000;
+    options.threads = std::max(1u, std::thread::hardware_concurrency());
+    options.baseSeed = 1;
+    options.maxTicks = 20000;
+    options.controller = Controller::BOT;
+    options.isScalingRun = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--games" && hasValue) {
+            options.games = std::max(1LL, std::atoll(argv[++i]));
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = static_cast<unsigned int>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--controller" && hasValue) {
+            std::string name = argv[++i];
+            if (name == "bot") {
+                options.controller = Controller::BOT;
+            } else if (name == "random") {
+                options.controller = Controller::RANDOM;
+            } else {
+                std::cerr << "Unknown controller: " << name << std::endl;
+                return 2;
+            }
+        } else if (arg == "--seed" && hasValue) {
+            options.baseSeed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--max-ticks" && hasValue) {
+            options.maxTicks = std::max(1LL, std::atoll(argv[++i]));
+        } else if (arg == "--rules" && hasValue) {
+            if (!GameRules::FromString(argv[++i], options.rules)) {
+                std::cerr << "Unknown rules: " << argv[i] << std::endl;
+                return 2;
+            }
+        } else if (arg == "--scaling") {
+            options.isScalingRun = true;
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (options.isScalingRun) {
+        PrintScaling(options);
+        return 0;
+    }
+
+    double seconds = 0.0;
+    WorkerStats stats = RunBatch(options, options.threads, seconds);
+    PrintReport(options, options.threads, stats, seconds);
+    return 0;
+}
@@ -0,0 +1,229 @@
+#include "PolicyTrainer.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct TrainOptions {
+    TrainerConfig config;
+    std::uint64_t generations;
+    unsigned int threads;
+    std::string outputDirectory;        // checkpoint.bin, best.policy y history.csv
+    std::uint64_t checkpointInterval;   // Generaciones entre checkpoints
+    bool isResume;
+    bool isScalingRun;
+};
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --generations <n>   Generations to run (default 100)\n"
+              << "  --population <n>    Genomes per generation (default 64)\n"
+              << "  --elite <n>         Genomes copied unchanged (default 4)\n"
+              << "  --games <n>         Seeded games per evaluation (default 32)\n"
+              << "  --sigma <x>         Mutation strength (default 0.02)\n"
+              << "  --crossover <x>     Uniform crossover rate (default 0)\n"
+              << "  --layers <spec>     Hidden layers, e.g. conv8,dense16 (default)\n"
+              << "  --radius <n>        View radius; the network sees (2r+1)^2 cells (default 4)\n"
+              << "  --rules <classic|wrap,no-self,multi-grow>  Rule variant (default classic)\n"
+              << "  --max-ticks <n>     Tick limit for one game (default 1000)\n"
+              << "  --seed <n>          Seed for the population and the games (default 1)\n"
+              << "  --threads <n>       Worker threads (default: hardware threads)\n"
+              << "  --output <dir>      Checkpoint directory (default training)\n"
+              << "  --checkpoint-every <n>  Generations between checkpoints (default 1)\n"
+              << "  --resume            Continue from <dir>/checkpoint.bin\n"
+              << "  --scaling           Evaluate one generation with 1, 2, 4 ... threads\n";
+}
+
+// "conv8,dense16": convoluciones 3x3 y densas, todas con ReLU
+bool ParseLayers(const std::string& text, std::vector<PolicyLayer>& layers) {
+    layers.clear();
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        PolicyLayerType type;
+        std::string count;
+        if (item.compare(0, 4, "conv") == 0) {
+            type = PolicyLayerType::CONV3X3;
+            count = item.substr(4);
+        } else if (item.compare(0, 5, "dense") == 0) {
+            type = PolicyLayerType::DENSE;
+            count = item.substr(5);
+        } else {
+            return false;
+        }
+
+        int outputs = std::atoi(count.c_str());
+        if (outputs <= 0) return false;
+        layers.emplace_back(type, outputs, true);
+    }
+    return true;
+}
+
+std::string CheckpointPath(const TrainOptions& options) {
+    return options.outputDirectory + "/checkpoint.bin";
+}
+
+// Checkpoint, mejor política y una línea por generación nueva en el CSV
+bool SaveProgress(const TrainOptions& options, const PolicyTrainer& trainer, size_t& loggedGenerations) {
+    std::string historyPath = options.outputDirectory + "/history.csv";
+    bool isNewFile = loggedGenerations == 0 || !std::filesystem::exists(historyPath);
+    std::ofstream history(historyPath, isNewFile ? std::ios::trunc : std::ios::app);
+    if (!history) {
+        std::cerr << "Failed to open training history: " << historyPath << std::endl;
+        return false;
+    }
+    if (isNewFile) {
+        history << "generation,best,mean,median,worst,evaluations,steps,seconds\n";
+        loggedGenerations = 0;
+    }
+    const std::vector<GenerationStats>& stats = trainer.GetHistory();
+    for (; loggedGenerations < stats.size(); loggedGenerations++) {
+        const GenerationStats& entry = stats[loggedGenerations];
+        history << entry.generation << ',' << entry.bestFitness << ',' << entry.meanFitness << ','
+                << entry.medianFitness << ',' << entry.worstFitness << ',' << entry.evaluations << ','
+                << entry.steps << ',' << entry.seconds << '\n';
+    }
+
+    return trainer.SaveCheckpoint(CheckpointPath(options)) &&
+           trainer.SaveBestPolicy(options.outputDirectory + "/best.policy");
+}
+
+// La misma generación con 1, 2, 4 ... hilos: aptitudes idénticas, más evaluaciones/s
+void PrintScaling(const TrainOptions& options, PolicyTrainer& trainer) {
+    std::printf("%8s %10s %12s %14s %9s %11s\n", "threads", "seconds", "evals/s", "steps/s", "speedup", "efficiency");
+
+    std::vector<unsigned int> threadCounts;
+    for (unsigned int threadCount = 1; threadCount < options.threads; threadCount *= 2) {
+        threadCounts.push_back(threadCount);
+    }
+    threadCounts.push_back(options.threads);
+
+    double baseSeconds = 0.0;
+    std::vector<float> baseFitness;
+    for (unsigned int threadCount : threadCounts) {
+        trainer.SetThreadCount(threadCount);
+        trainer.Evaluate();                 // Crea las arenas y calienta cachés
+        GenerationStats stats = trainer.Evaluate();
+        if (threadCount == 1) {
+            baseSeconds = stats.seconds;
+            baseFitness = trainer.GetFitness();
+        } else if (trainer.GetFitness() != baseFitness) {
+            std::cerr << "Results differ between 1 and " << threadCount << " threads" << std::endl;
+        }
+
+        double speedup = baseSeconds / stats.seconds;
+        std::printf("%8u %10.3f %12.1f %14.0f %8.2fx %10.0f%%\n", threadCount, stats.seconds,
+                    stats.evaluations / stats.seconds, stats.steps / stats.seconds, speedup,
+                    100.0 * speedup / threadCount);
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    TrainOptions options;
+    options.generations = 100;
+    options.threads = std::max(1u, std::thread::hardware_concurrency());
+    options.outputDirectory = "training";
+    options.checkpointInterval = 1;
+    options.isResume = false;
+    options.isScalingRun = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--generations" && hasValue) {
+            options.generations = std::max(1LL, std::atoll(argv[++i]));
+        } else if (arg == "--population" && hasValue) {
+            options.config.populationSize = std::max(2LL, std::atoll(argv[++i]));
+        } else if (arg == "--elite" && hasValue) {
+            options.config.eliteCount = std::max(0LL, std::atoll(argv[++i]));
+        } else if (arg == "--games" && hasValue) {
+            options.config.gamesPerEvaluation = std::max(1LL, std::atoll(argv[++i]));
+        } else if (arg == "--sigma" && hasValue) {
+            options.config.mutationStrength = std::strtof(argv[++i], nullptr);
+        } else if (arg == "--crossover" && hasValue) {
+            options.config.crossoverRate = std::strtof(argv[++i], nullptr);
+        } else if (arg == "--layers" && hasValue) {
+            if (!ParseLayers(argv[++i], options.config.hiddenLayers)) {
+                std::cerr << "Invalid layers: " << argv[i] << std::endl;
+                return 2;
+            }
+        } else if (arg == "--radius" && hasValue) {
+            options.config.viewRadius = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--rules" && hasValue) {
+            if (!GameRules::FromString(argv[++i], options.config.rules)) {
+                std::cerr << "Unknown rules: " << argv[i] << std::endl;
+                return 2;
+            }
+        } else if (arg == "--max-ticks" && hasValue) {
+            options.config.maxEpisodeTicks = static_cast<std::uint32_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--seed" && hasValue) {
+            options.config.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = static_cast<unsigned int>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--output" && hasValue) {
+            options.outputDirectory = argv[++i];
+        } else if (arg == "--checkpoint-every" && hasValue) {
+            options.checkpointInterval = std::max(1LL, std::atoll(argv[++i]));
+        } else if (arg == "--resume") {
+            options.isResume = true;
+        } else if (arg == "--scaling") {
+            options.isScalingRun = true;
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    PolicyTrainer trainer;
+    if (options.isResume ? !trainer.LoadCheckpoint(CheckpointPath(options)) : !trainer.Configure(options.config)) {
+        return 1;
+    }
+    trainer.SetThreadCount(options.threads);
+
+    if (options.isScalingRun) {
+        PrintScaling(options, trainer);
+        return 0;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(options.outputDirectory, error);
+    if (error) {
+        std::cerr << "Failed to create " << options.outputDirectory << ": " << error.message() << std::endl;
+        return 1;
+    }
+
+    const TrainerConfig& config = trainer.GetConfig();
+    std::printf("%zu parameters, population %zu, %zu games per evaluation, %zu threads, starting at generation %llu\n",
+                trainer.GetParameterCount(), config.populationSize, config.gamesPerEvaluation,
+                trainer.GetThreadCount(), static_cast<unsigned long long>(trainer.GetGeneration()));
+    std::printf("%6s %9s %9s %9s %10s %12s\n", "gen", "best", "mean", "median", "evals/s", "steps/s");
+
+    // Al reanudar, el CSV ya tiene las generaciones del checkpoint
+    size_t loggedGenerations = trainer.GetHistory().size();
+    std::uint64_t lastGeneration = trainer.GetGeneration() + options.generations;
+    while (trainer.GetGeneration() < lastGeneration) {
+        GenerationStats stats = trainer.RunGeneration();
+        std::printf("%6llu %9.3f %9.3f %9.3f %10.1f %12.0f\n", static_cast<unsigned long long>(stats.generation),
+                    stats.bestFitness, stats.meanFitness, stats.medianFitness, stats.evaluations / stats.seconds,
+                    stats.steps / stats.seconds);
+        std::fflush(stdout);
+
+        bool isLast = trainer.GetGeneration() == lastGeneration;
+        if ((isLast || trainer.GetGeneration() % options.checkpointInterval == 0) &&
+            !SaveProgress(options, trainer, loggedGenerations)) {
+            return 1;
+        }
+    }
+    return 0;
+}
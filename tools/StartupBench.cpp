@@ -0,0 +1,191 @@
+#include "AssetLoader.hpp"
+#include "AssetPack.hpp"
+#include "AudioManager.hpp"
+#include "GameRenderer.hpp"
+#include "TextureCache.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+struct StartupSample {
+    double decodeMs;
+    double totalMs;
+};
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --repetitions <n>   Runs per configuration (default 5)\n"
+              << "  --threads <n>       Pool size for the parallel loader (default: hardware threads)\n"
+              << "Rows labelled 'pack' load " << AssetPack::DEFAULT_PATH << " when it exists.\n"
+              << "Measures the windowed game's loading path up to the GPU upload, which needs a window.\n";
+}
+
+// Descarta los assets de la caché de páginas para simular un arranque en frío
+bool EvictFromPageCache(const AssetLoader& loader) {
+#if defined(POSIX_FADV_DONTNEED)
+    bool evicted = true;
+    for (const auto& asset : loader.GetAssets()) {
+        int fd = open(asset->path.c_str(), O_RDONLY);
+        if (fd < 0) continue;
+        if (posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) != 0) {
+            evicted = false;
+        }
+        close(fd);
+    }
+    return evicted;
+#else
+    (void)loader;
+    return false;
+#endif
+}
+
+StartupSample RunStartup(size_t threadCount, bool cold) {
+    // threadCount == 0 decodifica en el hilo actual, sin pool
+    using Clock = std::chrono::steady_clock;
+    
+    // Mismo camino que Game::LoadAssetsWithProgress con ventana
+    AssetLoader loader;
+    GameRenderer renderer;
+    AudioManager audioManager;
+    loader.SetDownscaleImages(true);
+    renderer.QueueAssets(loader);
+    audioManager.QueueAssets(loader);
+    
+    if (cold) {
+        EvictFromPageCache(loader);
+    }
+    
+    auto start = Clock::now();
+    if (threadCount == 0) {
+        loader.LoadAll();
+    } else {
+        ThreadPool pool(threadCount);
+        loader.Start(pool);
+        while (!loader.WaitFor(std::chrono::milliseconds(16))) {
+        }
+    }
+    auto decoded = Clock::now();
+    
+    // Lo que hace FinishLoading con ventana: copias reducidas en la caché. Las
+    // texturas y los buffers de OpenAL no se crean (se suben al primer uso)
+    TextureCache cache;
+    for (const auto& asset : loader.GetAssets()) {
+        if (asset->type != AssetType::IMAGE || !asset->isLoaded) continue;
+        cache.Register(asset->name, asset->path, renderer.GetImageDrawSize(asset->name));
+        cache.Stage(asset->name, asset->image.getPixelsPtr(), asset->image.getSize().x, asset->image.getSize().y);
+    }
+    auto finished = Clock::now();
+    
+    StartupSample sample;
+    sample.decodeMs = std::chrono::duration<double, std::milli>(decoded - start).count();
+    sample.totalMs = std::chrono::duration<double, std::milli>(finished - start).count();
+    return sample;
+}
+
+StartupSample RunPackStartup(const std::string& packPath, bool cold) {
+    using Clock = std::chrono::steady_clock;
+    
+    // Sin ventana ni rasterizador LoadFromPack solo enlaza el pack, como en el juego
+    GameRenderer renderer;
+    
+#if defined(POSIX_FADV_DONTNEED)
+    if (cold) {
+        int fd = open(packPath.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            close(fd);
+        }
+    }
+#else
+    (void)cold;
+#endif
+    
+    auto start = Clock::now();
+    AssetPack pack;
+    pack.Open(packPath);
+    auto opened = Clock::now();
+    renderer.LoadFromPack(pack);
+    auto finished = Clock::now();
+    
+    StartupSample sample;
+    sample.decodeMs = std::chrono::duration<double, std::milli>(opened - start).count();
+    sample.totalMs = std::chrono::duration<double, std::milli>(finished - start).count();
+    return sample;
+}
+
+double Median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    size_t middle = values.size() / 2;
+    return (values.size() % 2 == 1) ? values[middle] : (values[middle - 1] + values[middle]) / 2.0;
+}
+
+void Report(const char* label, size_t threadCount, bool cold, int repetitions, const std::string& packPath = "") {
+    std::vector<double> decode;
+    std::vector<double> total;
+    for (int i = 0; i < repetitions; i++) {
+        StartupSample sample = packPath.empty() ? RunStartup(threadCount, cold) : RunPackStartup(packPath, cold);
+        decode.push_back(sample.decodeMs);
+        total.push_back(sample.totalMs);
+    }
+    
+    std::printf("%-12s %8zu %6s %14.2f %14.2f %12.2f\n", label, std::max<size_t>(threadCount, 1), cold ? "cold" : "warm",
+                Median(decode), Median(total), *std::min_element(total.begin(), total.end()));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int repetitions = 5;
+    size_t threadCount = ThreadPool::GetDefaultThreadCount();
+    
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        
+        if (arg == "--repetitions" && hasValue) {
+            repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--threads" && hasValue) {
+            threadCount = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+    
+    {
+        AssetLoader probe;
+        GameRenderer().QueueAssets(probe);
+        if (!EvictFromPageCache(probe)) {
+            std::cout << "Note: page cache eviction unavailable, cold runs may hit the cache\n";
+        }
+    }
+    
+    std::printf("%-12s %8s %6s %14s %14s %12s\n", "loader", "threads", "cache",
+                "decode ms(med)", "total ms(med)", "total ms(min)");
+    Report("sequential", 0, true, repetitions);
+    Report("parallel", threadCount, true, repetitions);
+    Report("sequential", 0, false, repetitions);
+    Report("parallel", threadCount, false, repetitions);
+    
+    // Con pack, "decode" es solo abrir y mapear el archivo
+    if (std::ifstream(AssetPack::DEFAULT_PATH)) {
+        Report("pack", 0, true, repetitions, AssetPack::DEFAULT_PATH);
+        Report("pack", 0, false, repetitions, AssetPack::DEFAULT_PATH);
+    } else {
+        std::cout << "No asset pack found; run 'make pack' to include it\n";
+    }
+    return 0;
+}
@@ -0,0 +1,131 @@
+#include "AssetLoader.hpp"
+#include "AssetPack.hpp"
+#include "GameRenderer.hpp"
+#include "TextureCache.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct ReportConfig {
+    const char* label;
+    bool lazy;
+    bool downscale;
+    size_t budgetBytes;
+};
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --budget <MB>       Memory budget for the budgeted run (default 8)\n"
+              << "  --cycles <n>        Start / play / game over cycles to simulate (default 3)\n";
+}
+
+// Texturas que dibuja cada pantalla del juego
+std::vector<std::string> GetScreenTextures(const std::vector<std::string>& all, const std::string& screen) {
+    std::vector<std::string> names;
+    for (const std::string& name : all) {
+        bool isDigit = name.find("num_") == 0;
+        bool isPlayfield = name == "background" || name == "food" || name.find("snake_") == 0;
+
+        if ((screen == "start" && name == "start_screen") ||
+            (screen == "play" && (isPlayfield || isDigit)) ||
+            (screen == "game_over" && (name == "game_over" || isDigit))) {
+            names.push_back(name);
+        }
+    }
+    return names;
+}
+
+void RunReport(const ReportConfig& config, const AssetLoader& manifest, const AssetPack* pack, int cycles) {
+    GameRenderer layout;
+    TextureCache cache;
+    cache.SetPack(pack);
+    cache.SetDownscaleOnLoad(config.downscale);
+    cache.SetMemoryBudget(config.budgetBytes);
+
+    // Como en el juego: sin pack, la caché parte de las imágenes ya decodificadas
+    std::vector<std::string> names;
+    for (const auto& asset : manifest.GetAssets()) {
+        names.push_back(asset->name);
+        cache.Register(asset->name, asset->path, layout.GetImageDrawSize(asset->name));
+        if (!pack && asset->isLoaded) {
+            cache.Stage(asset->name, asset->image.getPixelsPtr(), asset->image.getSize().x, asset->image.getSize().y);
+        }
+    }
+
+    // Comportamiento anterior: todo residente desde el arranque
+    if (!config.lazy) {
+        for (const std::string& name : names) {
+            cache.Acquire(name);
+        }
+    }
+
+    const char* screens[] = { "start", "play", "game_over" };
+    for (int cycle = 0; cycle < cycles; cycle++) {
+        for (const char* screen : screens) {
+            // Unos cuantos frames por pantalla
+            for (int frame = 0; frame < 10; frame++) {
+                cache.BeginFrame();
+                for (const std::string& name : GetScreenTextures(names, screen)) {
+                    cache.Acquire(name);
+                }
+            }
+        }
+    }
+
+    const TextureCacheStats& stats = cache.GetStats();
+    std::printf("%-22s %12.2f %12.2f %8llu %10llu\n", config.label,
+                stats.peakResidentBytes / (1024.0 * 1024.0), stats.residentBytes / (1024.0 * 1024.0),
+                static_cast<unsigned long long>(stats.loads), static_cast<unsigned long long>(stats.evictions));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    double budgetMb = 8.0;
+    int cycles = 3;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--budget" && hasValue) {
+            budgetMb = std::atof(argv[++i]);
+        } else if (arg == "--cycles" && hasValue) {
+            cycles = std::max(1, std::atoi(argv[++i]));
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    // Mismo manifiesto de imágenes que el juego
+    AssetLoader manifest;
+    GameRenderer().QueueAssets(manifest);
+
+    AssetPack pack;
+    const AssetPack* packPointer = nullptr;
+    if (std::ifstream(AssetPack::DEFAULT_PATH) && pack.Open(AssetPack::DEFAULT_PATH)) {
+        packPointer = &pack;
+        std::cout << "Using " << AssetPack::DEFAULT_PATH << "\n";
+    } else {
+        manifest.LoadAll();
+    }
+
+    const size_t budgetBytes = static_cast<size_t>(budgetMb * 1024.0 * 1024.0);
+    const ReportConfig configs[] = {
+        { "eager, full size", false, false, 0 },
+        { "lazy, downscaled", true, true, 0 },
+        { "lazy, downscaled, LRU", true, true, budgetBytes },
+    };
+
+    std::printf("%-22s %12s %12s %8s %10s\n", "policy", "peak MiB", "final MiB", "loads", "evictions");
+    for (const ReportConfig& config : configs) {
+        RunReport(config, manifest, packPointer, cycles);
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include "GameSimulation.hpp"
+#include "Histogram.hpp"
+#include "InputSource.hpp"
+#include "TickScheduler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct JitterReport {
+    Histogram intervalError;    // |intervalo real - nominal|, µs
+    Histogram lateness;         // Del planificador, µs
+    std::uint64_t skipped;
+};
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --ticks <n>         Ticks per configuration (default 1000)\n"
+              << "  --hz <n>            Tick rate (default 100)\n"
+              << "  --load-threads <n>  Busy threads for the loaded runs (default: hardware threads)\n";
+}
+
+// Carga de fondo: hilos que nunca duermen
+void BurnCpu(const std::atomic<bool>& running) {
+    volatile std::uint64_t sink = 0;
+    while (running.load(std::memory_order_relaxed)) {
+        for (int i = 0; i < 10000; i++) {
+            sink = sink * 6364136223846793005ULL + 1;
+        }
+    }
+}
+
+JitterReport Measure(bool isPrecise, int loadThreads, int ticks, int hz) {
+    std::atomic<bool> loading(true);
+    std::vector<std::thread> load;
+    for (int i = 0; i < loadThreads; i++) {
+        load.emplace_back(BurnCpu, std::cref(loading));
+    }
+
+    TickScheduler scheduler(std::chrono::microseconds(1000000 / hz));
+    if (!isPrecise) {
+        scheduler.SetSpinThreshold(TickScheduler::Duration::zero());
+    }
+
+    // Cada tick hace el trabajo de un Update con un bot al mando
+    GameSimulation simulation(50, 35);
+    simulation.Reset(1);
+    BotInputSource bot;
+    DirectionInput input;
+
+    JitterReport report;
+    const auto nominal = std::chrono::duration_cast<std::chrono::microseconds>(scheduler.GetInterval()).count();
+    auto lastTick = TickScheduler::Clock::now();
+    int done = 0;
+
+    scheduler.Start();
+    while (done < ticks) {
+        scheduler.WaitForNextTick();
+        int due = scheduler.CollectDueTicks();
+        if (due == 0) continue;
+
+        auto now = TickScheduler::Clock::now();
+        if (done > 0) {
+            auto interval = std::chrono::duration_cast<std::chrono::microseconds>(now - lastTick).count();
+            report.intervalError.Record(static_cast<std::uint64_t>(std::abs(interval - nominal)));
+        }
+        lastTick = now;
+
+        for (int i = 0; i < due; i++) {
+            bot.Apply(simulation, input);
+            simulation.Tick();
+            if (simulation.IsGameOver()) simulation.Reset(simulation.GetSeed() + 1);
+        }
+        done += due;
+    }
+
+    report.lateness = scheduler.GetLateness();
+    report.skipped = scheduler.GetSkippedTicks();
+
+    loading = false;
+    for (auto& thread : load) {
+        thread.join();
+    }
+    return report;
+}
+
+void PrintReport(const char* label, const JitterReport& report) {
+    std::printf("%-14s %9llu %9llu %9llu %11llu %11llu %11llu %8llu\n", label,
+                static_cast<unsigned long long>(report.intervalError.GetPercentile(50.0)),
+                static_cast<unsigned long long>(report.intervalError.GetPercentile(99.0)),
+                static_cast<unsigned long long>(report.intervalError.GetMax()),
+                static_cast<unsigned long long>(report.lateness.GetPercentile(50.0)),
+                static_cast<unsigned long long>(report.lateness.GetPercentile(99.0)),
+                static_cast<unsigned long long>(report.lateness.GetMax()),
+                static_cast<unsigned long long>(report.skipped));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int ticks = 1000;
+    int hz = 100;
+    int loadThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--ticks" && hasValue) {
+            ticks = std::max(2, std::atoi(argv[++i]));
+        } else if (arg == "--hz" && hasValue) {
+            hz = std::min(std::max(1, std::atoi(argv[++i])), 100000);
+        } else if (arg == "--load-threads" && hasValue) {
+            loadThreads = std::max(0, std::atoi(argv[++i]));
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    std::printf("%d Hz, %d ticks per row, %d load threads; all values in microseconds\n", hz, ticks, loadThreads);
+    std::printf("%-14s %9s %9s %9s %11s %11s %11s %8s\n", "wait", "jit p50", "jit p99", "jit max",
+                "late p50", "late p99", "late max", "skipped");
+    PrintReport("sleep", Measure(false, 0, ticks, hz));
+    PrintReport("hybrid", Measure(true, 0, ticks, hz));
+    PrintReport("sleep+load", Measure(false, loadThreads, ticks, hz));
+    PrintReport("hybrid+load", Measure(true, loadThreads, ticks, hz));
+    return 0;
+}
@@ -0,0 +1,138 @@
+#include "AudioManager.hpp"
+#include "AudioMixer.hpp"
+#include "GameSimulation.hpp"
+#include "Histogram.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct LatencyReport {
+    double p50Us;
+    double p99Us;
+    double p999Us;
+    double maxUs;
+    std::uint64_t dropped;
+};
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --ticks <n>         Updates per mode (default 20000)\n"
+              << "  --tick-us <n>       Pause between updates in microseconds (default 500)\n";
+}
+
+// Si los WAV no se pudieron cargar, usar tonos sintéticos con los mismos nombres
+void EnsureClips(AudioMixer& mixer) {
+    const char* names[] = { "eat", "crash", "gameover", "start" };
+    std::vector<std::int16_t> tone(AudioMixer::OUTPUT_SAMPLE_RATE);
+    for (size_t i = 0; i < tone.size(); i++) {
+        tone[i] = static_cast<std::int16_t>(8000.0 * std::sin(i * 0.05));
+    }
+
+    for (const char* name : names) {
+        if (!mixer.HasClip(name)) {
+            mixer.AddClip(name, tone.data(), tone.size(), 1, AudioMixer::OUTPUT_SAMPLE_RATE);
+        }
+    }
+}
+
+LatencyReport Measure(bool queued, int ticks, int tickMicroseconds) {
+    AudioManager audio;
+    audio.Initialize();
+    audio.LoadAudioAssets();
+    EnsureClips(*audio.GetMixer());
+
+    // Sustituto del hilo de OpenAL (que sin dispositivo no pide datos): un
+    // buffer cada 1024 frames, con las voces que el bucle mantiene ocupadas
+    std::atomic<bool> mixing(true);
+    std::thread mixThread([&audio, &mixing]() {
+        std::vector<std::int16_t> buffer(MixerStream::BUFFER_FRAMES * AudioMixer::OUTPUT_CHANNELS);
+        const auto period = std::chrono::microseconds(1000000 * MixerStream::BUFFER_FRAMES / AudioMixer::OUTPUT_SAMPLE_RATE);
+        while (mixing) {
+            audio.GetMixer()->Mix(buffer.data(), MixerStream::BUFFER_FRAMES);
+            std::this_thread::sleep_for(period);
+        }
+    });
+
+    if (queued) {
+        audio.StartAudioThread();
+    }
+
+    GameSimulation simulation(50, 35);
+    simulation.Reset(12345);
+    Histogram samples;     // Nanosegundos
+
+    for (int tick = 0; tick < ticks; tick++) {
+        auto start = std::chrono::steady_clock::now();
+
+        // Mismo trabajo que Game::Update / EndGame, con audio en cada tick
+        simulation.Tick();
+        audio.PlaySoundEffect("eat");
+        if (simulation.IsGameOver()) {
+            audio.StopMusic();
+            audio.PlaySoundEffect("crash");
+            audio.PlaySoundEffect("gameover");
+            simulation.Reset(12345 + tick);
+            audio.PlayMusic("background");
+        }
+        if (tick % 7 == 0) {
+            audio.PauseMusic();
+            audio.ResumeMusic();
+        }
+
+        samples.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        std::this_thread::sleep_for(std::chrono::microseconds(tickMicroseconds));
+    }
+
+    mixing = false;
+    mixThread.join();
+
+    LatencyReport report;
+    report.dropped = audio.GetDroppedCommandCount();
+    audio.Cleanup();
+
+    report.p50Us = samples.GetPercentile(50.0) / 1000.0;
+    report.p99Us = samples.GetPercentile(99.0) / 1000.0;
+    report.p999Us = samples.GetPercentile(99.9) / 1000.0;
+    report.maxUs = samples.GetMax() / 1000.0;
+    return report;
+}
+
+void PrintReport(const char* label, const LatencyReport& report) {
+    std::printf("%-8s %10.2f %10.2f %10.2f %10.2f %9llu\n", label, report.p50Us, report.p99Us,
+                report.p999Us, report.maxUs, static_cast<unsigned long long>(report.dropped));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int ticks = 20000;
+    int tickMicroseconds = 500;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--ticks" && hasValue) {
+            ticks = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--tick-us" && hasValue) {
+            tickMicroseconds = std::max(0, std::atoi(argv[++i]));
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    std::printf("%-8s %10s %10s %10s %10s %9s\n", "audio", "p50 us", "p99 us", "p99.9 us", "max us", "dropped");
+    PrintReport("direct", Measure(false, ticks, tickMicroseconds));
+    PrintReport("queued", Measure(true, ticks, tickMicroseconds));
+    return 0;
+}